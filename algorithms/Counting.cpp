@@ -0,0 +1,23 @@
+#include "Counting.h"
+
+void dsaa::OperationCounter::reset() noexcept
+{
+	m_comparisons = 0;
+	m_dereferences = 0;
+	m_copies = 0;
+	m_moves = 0;
+	m_assignments = 0;
+	m_swaps = 0;
+}
+
+dsaa::OperationCounts dsaa::OperationCounter::counts() const noexcept
+{
+	OperationCounts result;
+	result.comparisons = m_comparisons.load(std::memory_order_relaxed);
+	result.dereferences = m_dereferences.load(std::memory_order_relaxed);
+	result.copies = m_copies.load(std::memory_order_relaxed);
+	result.moves = m_moves.load(std::memory_order_relaxed);
+	result.assignments = m_assignments.load(std::memory_order_relaxed);
+	result.swaps = m_swaps.load(std::memory_order_relaxed);
+	return result;
+}
\ No newline at end of file
@@ -0,0 +1,249 @@
+#ifndef DSAA_COUNTING_H
+#define DSAA_COUNTING_H
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include "dsaaTypedefs.h"
+
+namespace dsaa
+{
+	// Whether the counting adapters count by default. Build with DSAA_COUNT_OPERATIONS (scons count_operations=yes) to enable them,
+	// otherwise they only forward to what they wrap and compile down to it.
+#ifdef COUNT_OPERATIONS
+	inline constexpr bool counting_enabled = true;
+#else
+	inline constexpr bool counting_enabled = false;
+#endif //!COUNT_OPERATIONS
+
+	// A snapshot of the OperationCounter.
+	struct OperationCounts
+	{
+		// Calls to a CountingCompare and comparison operators of CountedElement.
+		size_t comparisons = 0;
+		// Elements accessed through a CountingIterator.
+		size_t dereferences = 0;
+		// Copy and move constructions of CountedElement.
+		size_t copies = 0;
+		size_t moves = 0;
+		// Copy and move assignments of CountedElement, the writes of an algorithm.
+		size_t assignments = 0;
+		// Swaps found by argument dependent lookup, e.g. by std::iter_swap, of CountedElement or CountingIterator.
+		size_t swaps = 0;
+	};
+
+	// Counts the operations of the adapters. The counters are atomic since the parallel sorts compare and move from several threads.
+	class OperationCounter final
+	{
+	public:
+		OperationCounter() noexcept : m_comparisons(0), m_dereferences(0), m_copies(0), m_moves(0), m_assignments(0), m_swaps(0) {}
+		OperationCounter(const OperationCounter &) = delete;
+		OperationCounter &operator=(const OperationCounter &) = delete;
+
+		void reset() noexcept;
+		NODISCARD OperationCounts counts() const noexcept;
+
+		void count_comparison() noexcept { m_comparisons.fetch_add(1, std::memory_order_relaxed); }
+		void count_dereference() noexcept { m_dereferences.fetch_add(1, std::memory_order_relaxed); }
+		void count_copy() noexcept { m_copies.fetch_add(1, std::memory_order_relaxed); }
+		void count_move() noexcept { m_moves.fetch_add(1, std::memory_order_relaxed); }
+		void count_assignment() noexcept { m_assignments.fetch_add(1, std::memory_order_relaxed); }
+		void count_swap() noexcept { m_swaps.fetch_add(1, std::memory_order_relaxed); }
+
+	private:
+		std::atomic<size_t> m_comparisons;
+		std::atomic<size_t> m_dereferences;
+		std::atomic<size_t> m_copies;
+		std::atomic<size_t> m_moves;
+		std::atomic<size_t> m_assignments;
+		std::atomic<size_t> m_swaps;
+	};
+
+	// The counter every adapter counts in, global so that adapters default constructed by an algorithm count as well.
+	inline OperationCounter operation_counter;
+
+	// Comparator counting its calls, then calling Compare.
+	template <typename Compare = std::less<>, bool Enabled = counting_enabled>
+	class CountingCompare
+	{
+	public:
+		CountingCompare(Compare p_compare = Compare()) : m_compare(std::move(p_compare)) {}
+
+		template <typename Lhs, typename Rhs>
+		CONSTEXPR bool operator()(Lhs &&p_lhs, Rhs &&p_rhs) const
+		{
+			if constexpr (Enabled)
+				operation_counter.count_comparison();
+			return m_compare(std::forward<Lhs>(p_lhs), std::forward<Rhs>(p_rhs));
+		}
+
+		NODISCARD const Compare &base() const noexcept { return m_compare; }
+
+	private:
+		Compare m_compare;
+	};
+
+	// Iterator counting the elements accessed through it, then behaving like Iterator.
+	// Dereferencing returns the element itself rather than a proxy, so that `auto key = *iter` copies as in the algorithms,
+	// hence a read cannot be told from a write: wrap the elements in CountedElement to count the writes.
+	template <typename Iterator, bool Enabled = counting_enabled>
+	class CountingIterator
+	{
+	public:
+		using iterator_category = typename std::iterator_traits<Iterator>::iterator_category;
+		using value_type = typename std::iterator_traits<Iterator>::value_type;
+		using difference_type = typename std::iterator_traits<Iterator>::difference_type;
+		using pointer = typename std::iterator_traits<Iterator>::pointer;
+		using reference = typename std::iterator_traits<Iterator>::reference;
+
+		CONSTEXPR CountingIterator() : m_iterator() {}
+		CONSTEXPR explicit CountingIterator(Iterator p_iterator) : m_iterator(std::move(p_iterator)) {}
+
+		NODISCARD CONSTEXPR const Iterator &base() const noexcept { return m_iterator; }
+
+		CONSTEXPR reference operator*() const
+		{
+			if constexpr (Enabled)
+				operation_counter.count_dereference();
+			return *m_iterator;
+		}
+		CONSTEXPR pointer operator->() const
+		{
+			if constexpr (Enabled)
+				operation_counter.count_dereference();
+			if constexpr (std::is_pointer_v<Iterator>)
+				return m_iterator;
+			else
+				return m_iterator.operator->();
+		}
+		CONSTEXPR reference operator[](difference_type p_offset) const
+		{
+			if constexpr (Enabled)
+				operation_counter.count_dereference();
+			return m_iterator[p_offset];
+		}
+
+		CONSTEXPR CountingIterator &operator++()
+		{
+			++m_iterator;
+			return *this;
+		}
+		CONSTEXPR CountingIterator operator++(int) { return CountingIterator(m_iterator++); }
+		CONSTEXPR CountingIterator &operator--()
+		{
+			--m_iterator;
+			return *this;
+		}
+		CONSTEXPR CountingIterator operator--(int) { return CountingIterator(m_iterator--); }
+		CONSTEXPR CountingIterator &operator+=(difference_type p_offset)
+		{
+			m_iterator += p_offset;
+			return *this;
+		}
+		CONSTEXPR CountingIterator &operator-=(difference_type p_offset)
+		{
+			m_iterator -= p_offset;
+			return *this;
+		}
+
+		friend CONSTEXPR CountingIterator operator+(const CountingIterator &p_iterator, difference_type p_offset) { return CountingIterator(p_iterator.m_iterator + p_offset); }
+		friend CONSTEXPR CountingIterator operator+(difference_type p_offset, const CountingIterator &p_iterator) { return CountingIterator(p_iterator.m_iterator + p_offset); }
+		friend CONSTEXPR CountingIterator operator-(const CountingIterator &p_iterator, difference_type p_offset) { return CountingIterator(p_iterator.m_iterator - p_offset); }
+		friend CONSTEXPR difference_type operator-(const CountingIterator &p_lhs, const CountingIterator &p_rhs) { return p_lhs.m_iterator - p_rhs.m_iterator; }
+
+		friend CONSTEXPR bool operator==(const CountingIterator &p_lhs, const CountingIterator &p_rhs) { return p_lhs.m_iterator == p_rhs.m_iterator; }
+		friend CONSTEXPR bool operator!=(const CountingIterator &p_lhs, const CountingIterator &p_rhs) { return p_lhs.m_iterator != p_rhs.m_iterator; }
+		friend CONSTEXPR bool operator<(const CountingIterator &p_lhs, const CountingIterator &p_rhs) { return p_lhs.m_iterator < p_rhs.m_iterator; }
+		friend CONSTEXPR bool operator>(const CountingIterator &p_lhs, const CountingIterator &p_rhs) { return p_lhs.m_iterator > p_rhs.m_iterator; }
+		friend CONSTEXPR bool operator<=(const CountingIterator &p_lhs, const CountingIterator &p_rhs) { return p_lhs.m_iterator <= p_rhs.m_iterator; }
+		friend CONSTEXPR bool operator>=(const CountingIterator &p_lhs, const CountingIterator &p_rhs) { return p_lhs.m_iterator >= p_rhs.m_iterator; }
+
+		// Found by an unqualified iter_swap and std::ranges::iter_swap: one swap and no dereference.
+		// std::iter_swap dereferences both iterators instead, then swaps the elements.
+		friend CONSTEXPR void iter_swap(const CountingIterator &p_lhs, const CountingIterator &p_rhs)
+		{
+			if constexpr (Enabled)
+				operation_counter.count_swap();
+			using std::iter_swap;
+			iter_swap(p_lhs.m_iterator, p_rhs.m_iterator);
+		}
+
+	private:
+		// Mutable for the iterators that only dereference when non const.
+		mutable Iterator m_iterator;
+	};
+
+	template <bool Enabled = counting_enabled, typename Iterator>
+	NODISCARD CONSTEXPR CountingIterator<Iterator, Enabled> make_counting_iterator(Iterator p_iterator)
+	{
+		return CountingIterator<Iterator, Enabled>(std::move(p_iterator));
+	}
+
+	// Element counting its copies, moves, assignments, comparisons and swaps, like TestObject counts the live objects.
+	template <typename T, bool Enabled = counting_enabled>
+	class CountedElement
+	{
+	public:
+		CONSTEXPR CountedElement() : m_value() {}
+		CONSTEXPR CountedElement(T p_value) noexcept(std::is_nothrow_move_constructible_v<T>) : m_value(std::move(p_value)) {}
+		CONSTEXPR CountedElement(const CountedElement &p_other) noexcept(std::is_nothrow_copy_constructible_v<T>) : m_value(p_other.m_value)
+		{
+			if constexpr (Enabled)
+				operation_counter.count_copy();
+		}
+		CONSTEXPR CountedElement(CountedElement &&p_other) noexcept(std::is_nothrow_move_constructible_v<T>) : m_value(std::move(p_other.m_value))
+		{
+			if constexpr (Enabled)
+				operation_counter.count_move();
+		}
+
+		CONSTEXPR CountedElement &operator=(const CountedElement &p_other)
+		{
+			if constexpr (Enabled)
+				operation_counter.count_assignment();
+			m_value = p_other.m_value;
+			return *this;
+		}
+		CONSTEXPR CountedElement &operator=(CountedElement &&p_other) noexcept(std::is_nothrow_move_assignable_v<T>)
+		{
+			if constexpr (Enabled)
+				operation_counter.count_assignment();
+			m_value = std::move(p_other.m_value);
+			return *this;
+		}
+
+		NODISCARD CONSTEXPR T &value() noexcept { return m_value; }
+		NODISCARD CONSTEXPR const T &value() const noexcept { return m_value; }
+
+		friend CONSTEXPR bool operator==(const CountedElement &p_lhs, const CountedElement &p_rhs) { return count_comparison(), p_lhs.m_value == p_rhs.m_value; }
+		friend CONSTEXPR bool operator!=(const CountedElement &p_lhs, const CountedElement &p_rhs) { return count_comparison(), p_lhs.m_value != p_rhs.m_value; }
+		friend CONSTEXPR bool operator<(const CountedElement &p_lhs, const CountedElement &p_rhs) { return count_comparison(), p_lhs.m_value < p_rhs.m_value; }
+		friend CONSTEXPR bool operator>(const CountedElement &p_lhs, const CountedElement &p_rhs) { return count_comparison(), p_lhs.m_value > p_rhs.m_value; }
+		friend CONSTEXPR bool operator<=(const CountedElement &p_lhs, const CountedElement &p_rhs) { return count_comparison(), p_lhs.m_value <= p_rhs.m_value; }
+		friend CONSTEXPR bool operator>=(const CountedElement &p_lhs, const CountedElement &p_rhs) { return count_comparison(), p_lhs.m_value >= p_rhs.m_value; }
+
+		// Found by std::iter_swap: one swap, neither a move nor an assignment.
+		friend CONSTEXPR void swap(CountedElement &p_lhs, CountedElement &p_rhs) noexcept(std::is_nothrow_swappable_v<T>)
+		{
+			if constexpr (Enabled)
+				operation_counter.count_swap();
+			using std::swap;
+			swap(p_lhs.m_value, p_rhs.m_value);
+		}
+
+	private:
+		static CONSTEXPR void count_comparison() noexcept
+		{
+			if constexpr (Enabled)
+				operation_counter.count_comparison();
+		}
+
+		T m_value;
+	};
+}
+
+#endif // !DSAA_COUNTING_H
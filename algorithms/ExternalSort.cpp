@@ -0,0 +1,49 @@
+#include "ExternalSort.h"
+
+#include <atomic>
+#include <cstdint>
+#include <random>
+#include <system_error>
+
+namespace
+{
+	std::atomic<uint64_t> s_temporary_count(0);
+}
+
+dsaa::detail::TemporaryFile::TemporaryFile(const std::filesystem::path &p_directory)
+	: m_path()
+{
+	// Tells apart the files of processes sharing the directory.
+	static const uint64_t process_tag(std::random_device{}());
+	m_path = (p_directory / ("dsaa-sort-" + std::to_string(process_tag) + "-" + std::to_string(s_temporary_count.fetch_add(1)) + ".run")).string();
+}
+
+dsaa::detail::TemporaryFile::TemporaryFile(TemporaryFile &&p_other) noexcept
+	: m_path(std::move(p_other.m_path))
+{
+	p_other.m_path.clear();
+}
+
+dsaa::detail::TemporaryFile &dsaa::detail::TemporaryFile::operator=(TemporaryFile &&p_other) noexcept
+{
+	if (this != &p_other)
+	{
+		remove();
+		m_path = std::move(p_other.m_path);
+		p_other.m_path.clear();
+	}
+	return *this;
+}
+
+dsaa::detail::TemporaryFile::~TemporaryFile()
+{
+	remove();
+}
+
+void dsaa::detail::TemporaryFile::remove() noexcept
+{
+	if (m_path.empty())
+		return;
+	std::error_code error;
+	std::filesystem::remove(m_path, error);
+}
@@ -0,0 +1,383 @@
+#ifndef DSAA_EXTERNAL_SORT_H
+#define DSAA_EXTERNAL_SORT_H
+
+#include <algorithm>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ParallelSort.h"
+#include "arrays/DynamicArray.h"
+#include "memory/Serialize.h"
+#include "dsaaTypedefs.h"
+
+namespace dsaa
+{
+	struct ExternalSortOptions
+	{
+		// Bytes of memory for the records being sorted, then for the buffers of the merge.
+		size_t memory_budget = size_t(256) << 20;
+		// Bytes transferred at once by every run reader and by the writer.
+		size_t io_buffer_size = size_t(1) << 20;
+		// Directory of the sorted runs. Empty means std::filesystem::temp_directory_path().
+		std::string temp_directory = std::string();
+		// Options of the parallel sort of every chunk.
+		ParallelSortOptions sort = ParallelSortOptions();
+	};
+
+	struct ExternalSortResult
+	{
+		size_t records = 0;
+		// Sorted runs written by the first pass, 0 when the input was sorted in memory.
+		size_t runs = 0;
+		// Passes merging runs, the last one writing the output.
+		size_t merge_passes = 0;
+	};
+
+	// Sorts the file at p_input, a headerless sequence of Record written as raw bytes, into the file at p_output. Stable.
+	// The input is read in chunks that fit the memory budget, the next chunk being read while the current one is sorted
+	// by parallel_merge_sort and written to a temporary run file. The runs are then merged through a loser tree, as many at
+	// a time as the budget has buffers for. Readers and the writer are double buffered, one block is transferred by another
+	// thread while the other is used. p_input and p_output may be the same file.
+	// Throws std::runtime_error when a file can not be read or written. Temporary files are removed in every case.
+	template <typename Record, typename Compare = std::less<Record>>
+	ExternalSortResult external_sort(const std::string &p_input, const std::string &p_output, Compare p_compare = Compare(), const ExternalSortOptions &p_options = ExternalSortOptions());
+
+	namespace detail
+	{
+		// Name of a file in a directory, the file being removed when this is destroyed.
+		class TemporaryFile final
+		{
+		public:
+			// Picks a new name in p_directory. The file is created by whoever writes it first.
+			explicit TemporaryFile(const std::filesystem::path &p_directory);
+			TemporaryFile(const TemporaryFile &) = delete;
+			TemporaryFile(TemporaryFile &&p_other) noexcept;
+			TemporaryFile &operator=(const TemporaryFile &) = delete;
+			TemporaryFile &operator=(TemporaryFile &&p_other) noexcept;
+			~TemporaryFile();
+
+			NODISCARD const std::string &path() const noexcept { return m_path; }
+
+		private:
+			void remove() noexcept;
+
+			std::string m_path;
+		};
+
+		// Reads up to p_count records. Throws when the stream fails or ends inside a record.
+		template <typename Record>
+		size_t read_records(std::istream &p_stream, Record *p_records, size_t p_count);
+		template <typename Record>
+		void write_records(std::ostream &p_stream, const Record *p_records, size_t p_count);
+
+		// Sequential reader of the records of a file. The next block is read by another thread while the current one is consumed.
+		template <typename Record>
+		class RecordReader final
+		{
+		public:
+			RecordReader(const std::string &p_path, size_t p_buffer_records);
+			RecordReader(const RecordReader &) = delete;
+			RecordReader &operator=(const RecordReader &) = delete;
+
+			NODISCARD bool done() const noexcept { return m_position == m_size; }
+			// Returns the current record. Requires !done().
+			NODISCARD const Record &front() const noexcept { return m_front.data()[m_position]; }
+			void pop();
+
+		private:
+			void start_read();
+
+			std::ifstream m_stream;
+			DynamicArray<Record> m_front;
+			DynamicArray<Record> m_back;
+			size_t m_position;
+			size_t m_size;
+			// Declared last to be destroyed, so waited for, first.
+			std::future<size_t> m_pending;
+		};
+
+		// Sequential writer of records to a file. A full block is written by another thread while the next one is filled.
+		template <typename Record>
+		class RecordWriter final
+		{
+		public:
+			RecordWriter(const std::string &p_path, size_t p_buffer_records);
+			RecordWriter(const RecordWriter &) = delete;
+			RecordWriter &operator=(const RecordWriter &) = delete;
+
+			void push(const Record &p_record);
+			// Writes the buffered records and closes the file. Without it, the file is incomplete.
+			void close();
+
+		private:
+			void flush();
+			void wait();
+
+			std::ofstream m_stream;
+			DynamicArray<Record> m_front;
+			DynamicArray<Record> m_back;
+			size_t m_size;
+			std::future<void> m_pending;
+		};
+
+		// Tournament tree over k sources, every inner node keeping the loser of the match played there, so replacing
+		// the winner replays only the log k matches on its path. Exhausted sources lose every match, and ties are won
+		// by the lower source, which keeps a merge of consecutive runs stable.
+		template <typename Source, typename Compare>
+		class LoserTree final
+		{
+		public:
+			LoserTree(std::vector<Source *> p_sources, Compare p_compare);
+
+			NODISCARD bool empty() const noexcept { return m_sources[m_losers[0]]->done(); }
+			NODISCARD Source &winner() const noexcept { return *m_sources[m_losers[0]]; }
+			// Finds the new winner once the current one advanced.
+			void replay();
+
+		private:
+			NODISCARD bool beats(size_t p_lhs, size_t p_rhs) const;
+
+			std::vector<Source *> m_sources;
+			// Node 0 holds the winner, nodes 1 to k - 1 the losers. The leaves, k to 2k - 1, are the sources themselves.
+			std::vector<size_t> m_losers;
+			Compare m_compare;
+		};
+
+		// Merges the runs [p_first, p_last) into the file at p_path.
+		template <typename Record, typename Compare>
+		void merge_run_files(const TemporaryFile *p_first, const TemporaryFile *p_last, const std::string &p_path, size_t p_buffer_records, Compare p_compare);
+	}
+}
+
+template <typename Record, typename Compare>
+dsaa::ExternalSortResult dsaa::external_sort(const std::string &p_input, const std::string &p_output, Compare p_compare, const ExternalSortOptions &p_options)
+{
+	static_assert(std::is_trivially_copyable_v<Record>, "external_sort reads records as raw bytes.");
+
+	const std::uintmax_t bytes(std::filesystem::file_size(p_input));
+	if (bytes % sizeof(Record))
+		throw std::runtime_error(p_input + " is not a whole number of records.");
+
+	ExternalSortResult result;
+	result.records = bytes / sizeof(Record);
+	const std::filesystem::path directory(p_options.temp_directory.empty() ? std::filesystem::temp_directory_path() : std::filesystem::path(p_options.temp_directory));
+	std::vector<detail::TemporaryFile> runs;
+
+	// Two chunks, the one being read and the one being sorted, and the scratch space of the merge sort.
+	const size_t chunk_records(std::min<size_t>(std::max<size_t>(p_options.memory_budget / (3 * sizeof(Record)), 1), result.records));
+	detail::with_task_pool(p_options.sort, [&](TaskPool &p_pool)
+						   {
+							   ParallelSortOptions sort_options(p_options.sort);
+							   sort_options.pool = &p_pool;
+							   DynamicArray<Record> chunk(chunk_records, default_init), next;
+							   if (chunk_records < result.records)
+								   next.resize_default_init(chunk_records);
+
+							   auto input(detail::open_file<std::ifstream>(p_input, std::ios::in));
+							   size_t size(detail::read_records(input, chunk.data(), chunk_records));
+							   if (size == result.records)
+							   {
+								   // Sorted in memory, the input is closed first in case it is also the output.
+								   input.close();
+								   parallel_merge_sort(chunk.data(), chunk.data() + size, p_compare, sort_options);
+								   auto output(detail::open_file<std::ofstream>(p_output, std::ios::out | std::ios::trunc));
+								   detail::write_records(output, chunk.data(), size);
+								   return;
+							   }
+
+							   while (size)
+							   {
+								   std::future<size_t> next_size(std::async(std::launch::async, [&]()
+																			{ return detail::read_records(input, next.data(), chunk_records); }));
+								   parallel_merge_sort(chunk.data(), chunk.data() + size, p_compare, sort_options);
+								   runs.emplace_back(directory);
+								   auto run(detail::open_file<std::ofstream>(runs.back().path(), std::ios::out | std::ios::trunc));
+								   detail::write_records(run, chunk.data(), size);
+								   size = next_size.get();
+								   std::swap(chunk, next);
+							   } });
+	result.runs = runs.size();
+	if (runs.empty())
+		return result;
+
+	// Every reader and the writer hold two blocks.
+	const size_t buffer_records(std::max<size_t>(p_options.io_buffer_size / sizeof(Record), 1));
+	const size_t fan_in(std::max<size_t>(p_options.memory_budget / (2 * buffer_records * sizeof(Record)), 3) - 1);
+	while (fan_in < runs.size())
+	{
+		std::vector<detail::TemporaryFile> merged;
+		merged.reserve((runs.size() + fan_in - 1) / fan_in);
+		for (size_t first(0); first < runs.size(); first += fan_in)
+		{
+			const size_t last(std::min(first + fan_in, runs.size()));
+			merged.emplace_back(directory);
+			detail::merge_run_files<Record>(runs.data() + first, runs.data() + last, merged.back().path(), buffer_records, p_compare);
+		}
+		runs = std::move(merged);
+		++result.merge_passes;
+	}
+	detail::merge_run_files<Record>(runs.data(), runs.data() + runs.size(), p_output, buffer_records, p_compare);
+	++result.merge_passes;
+	return result;
+}
+
+template <typename Record>
+size_t dsaa::detail::read_records(std::istream &p_stream, Record *p_records, size_t p_count)
+{
+	p_stream.read(reinterpret_cast<char *>(p_records), static_cast<std::streamsize>(p_count * sizeof(Record)));
+	const size_t bytes(static_cast<size_t>(p_stream.gcount()));
+	if (p_stream.bad() || bytes % sizeof(Record))
+		throw std::runtime_error("Can not read whole records.");
+	return bytes / sizeof(Record);
+}
+
+template <typename Record>
+void dsaa::detail::write_records(std::ostream &p_stream, const Record *p_records, size_t p_count)
+{
+	if (!p_stream.write(reinterpret_cast<const char *>(p_records), static_cast<std::streamsize>(p_count * sizeof(Record))))
+		throw std::runtime_error("Can not write records.");
+}
+
+template <typename Record>
+dsaa::detail::RecordReader<Record>::RecordReader(const std::string &p_path, size_t p_buffer_records)
+	: m_stream(open_file<std::ifstream>(p_path, std::ios::in)), m_front(p_buffer_records, default_init), m_back(p_buffer_records, default_init), m_position(0), m_size(0), m_pending()
+{
+	m_size = read_records(m_stream, m_front.data(), m_front.size());
+	start_read();
+}
+
+template <typename Record>
+void dsaa::detail::RecordReader<Record>::pop()
+{
+	if (++m_position != m_size || !m_pending.valid())
+		return;
+	m_size = m_pending.get();
+	m_position = 0;
+	std::swap(m_front, m_back);
+	start_read();
+}
+
+template <typename Record>
+void dsaa::detail::RecordReader<Record>::start_read()
+{
+	// A short block means the file ended.
+	if (m_size == m_front.size())
+		m_pending = std::async(std::launch::async, [this]()
+							   { return read_records(m_stream, m_back.data(), m_back.size()); });
+}
+
+template <typename Record>
+dsaa::detail::RecordWriter<Record>::RecordWriter(const std::string &p_path, size_t p_buffer_records)
+	: m_stream(open_file<std::ofstream>(p_path, std::ios::out | std::ios::trunc)), m_front(p_buffer_records, default_init), m_back(p_buffer_records, default_init), m_size(0), m_pending()
+{
+}
+
+template <typename Record>
+void dsaa::detail::RecordWriter<Record>::push(const Record &p_record)
+{
+	m_front.data()[m_size] = p_record;
+	if (++m_size == m_front.size())
+		flush();
+}
+
+template <typename Record>
+void dsaa::detail::RecordWriter<Record>::close()
+{
+	flush();
+	wait();
+	m_stream.close();
+	if (!m_stream)
+		throw std::runtime_error("Can not write records.");
+}
+
+template <typename Record>
+void dsaa::detail::RecordWriter<Record>::flush()
+{
+	if (!m_size)
+		return;
+	wait();
+	std::swap(m_front, m_back);
+	m_pending = std::async(std::launch::async, [this, size = m_size]()
+						   { write_records(m_stream, m_back.data(), size); });
+	m_size = 0;
+}
+
+template <typename Record>
+void dsaa::detail::RecordWriter<Record>::wait()
+{
+	if (m_pending.valid())
+		m_pending.get();
+}
+
+template <typename Source, typename Compare>
+dsaa::detail::LoserTree<Source, Compare>::LoserTree(std::vector<Source *> p_sources, Compare p_compare)
+	: m_sources(std::move(p_sources)), m_losers(m_sources.size()), m_compare(p_compare)
+{
+	const size_t count(m_sources.size());
+	std::vector<size_t> winners(2 * count);
+	for (size_t i(0); i != count; ++i)
+		winners[count + i] = i;
+	for (size_t node(count - 1); node; --node)
+	{
+		const size_t lhs(winners[2 * node]), rhs(winners[2 * node + 1]);
+		const bool lhs_wins(beats(lhs, rhs));
+		winners[node] = lhs_wins ? lhs : rhs;
+		m_losers[node] = lhs_wins ? rhs : lhs;
+	}
+	m_losers[0] = winners[1];
+}
+
+template <typename Source, typename Compare>
+void dsaa::detail::LoserTree<Source, Compare>::replay()
+{
+	size_t winner(m_losers[0]);
+	for (size_t node((winner + m_sources.size()) / 2); node; node /= 2)
+		if (beats(m_losers[node], winner))
+			std::swap(m_losers[node], winner);
+	m_losers[0] = winner;
+}
+
+template <typename Source, typename Compare>
+bool dsaa::detail::LoserTree<Source, Compare>::beats(size_t p_lhs, size_t p_rhs) const
+{
+	const Source &lhs(*m_sources[p_lhs]), &rhs(*m_sources[p_rhs]);
+	if (lhs.done() || rhs.done())
+		return !lhs.done();
+	if (m_compare(rhs.front(), lhs.front()))
+		return false;
+	return p_lhs < p_rhs || m_compare(lhs.front(), rhs.front());
+}
+
+template <typename Record, typename Compare>
+void dsaa::detail::merge_run_files(const TemporaryFile *p_first, const TemporaryFile *p_last, const std::string &p_path, size_t p_buffer_records, Compare p_compare)
+{
+	std::vector<std::unique_ptr<RecordReader<Record>>> readers;
+	std::vector<RecordReader<Record> *> sources;
+	for (; p_first != p_last; ++p_first)
+	{
+		readers.emplace_back(new RecordReader<Record>(p_first->path(), p_buffer_records));
+		sources.push_back(readers.back().get());
+	}
+
+	LoserTree<RecordReader<Record>, Compare> tree(std::move(sources), p_compare);
+	RecordWriter<Record> writer(p_path, p_buffer_records);
+	while (!tree.empty())
+	{
+		RecordReader<Record> &winner(tree.winner());
+		writer.push(winner.front());
+		winner.pop();
+		tree.replay();
+	}
+	writer.close();
+}
+
+#endif // !DSAA_EXTERNAL_SORT_H
@@ -1,20 +1,42 @@
 #ifndef DSAA_GENERIC_H
 #define DSAA_GENERIC_H
 
+#include <algorithm>
 #include <functional>
 #include <cmath>
+#include <iterator>
+#include <utility>
+#include <vector>
 
 #include "Random.h"
 #include "BinaryTree.h"
+#include "arrays/DynamicArray.h"
 
 namespace dsaa
 {
     template <typename RIterator, typename Compare = std::less<typename std::iterator_traits<RIterator>::value_type>>
     RIterator merge(RIterator p_first, RIterator p_mid, RIterator p_last, Compare p_compare = Compare());
 
+    // Stable merge of the sorted ranges [p_first, p_mid) and [p_mid, p_last) without allocating:
+    // [p_first, p_mid) is moved to p_buffer, which must hold p_mid - p_first elements, and merged back.
+    template <typename RIterator, typename BufferIterator, typename Compare = std::less<typename std::iterator_traits<RIterator>::value_type>>
+    RIterator buffered_merge(RIterator p_first, RIterator p_mid, RIterator p_last, BufferIterator p_buffer, Compare p_compare = Compare());
+
+    namespace detail
+    {
+        // Merges the left run, moved to [p_buffer_first, p_buffer_last), with the right run [p_mid, p_last) into p_first.
+        template <typename RIterator, typename BufferIterator, typename Compare>
+        void merge_from_buffer(BufferIterator p_buffer_first, BufferIterator p_buffer_last, RIterator p_first, RIterator p_mid, RIterator p_last, Compare p_compare);
+    }
+
     template <typename RIterator, typename Compare = std::less<typename std::iterator_traits<RIterator>::value_type>>
     RIterator lomuto_partition(RIterator p_first, RIterator p_last, Compare p_compare = Compare());
 
+    // Same contract as lomuto_partition, but every element is swapped and only the boundary advance depends on the comparison,
+    // so the loop has no branch to mispredict on random input.
+    template <typename RIterator, typename Compare = std::less<typename std::iterator_traits<RIterator>::value_type>>
+    RIterator branchless_lomuto_partition(RIterator p_first, RIterator p_last, Compare p_compare = Compare());
+
     template <typename RIterator, typename Compare = std::less<typename std::iterator_traits<RIterator>::value_type>>
     RIterator hoare_partition(RIterator p_first, RIterator p_last, Compare p_compare = Compare());
 
@@ -24,50 +46,73 @@ namespace dsaa
     template <typename RIterator, typename Compare = std::less<typename std::iterator_traits<RIterator>::value_type>>
     RIterator randomized_hoare_partition(RIterator p_first, RIterator p_last, Compare p_compare = Compare());
 
+    // Branchless classifier of a k-way partition, k a power of two: the k - 1 sorted splitters are laid out as an implicit search tree,
+    // the children of node i being nodes 2i and 2i + 1, so a value descends log2(k) levels adding the result of one comparison to
+    // the node index at each, with no branch to mispredict. Values equal to a splitter are put in buckets of their own:
+    // bucket 2i holds the values greater than splitter i - 1 and less than splitter i, bucket 2i + 1 the values equal to splitter i.
+    template <typename Value, typename Compare = std::less<Value>>
+    class SplitterTree
+    {
+    public:
+        // [p_first, p_last) holds 2^n - 1 sorted splitters, n > 0, which may be equal.
+        template <typename IIterator>
+        SplitterTree(IIterator p_first, IIterator p_last, Compare p_compare = Compare());
+
+        // Number of buckets, the equality ones included.
+        NODISCARD size_t bucket_count() const noexcept { return 2 * m_leaf_count; }
+        // Returns the bucket of p_value.
+        NODISCARD size_t operator()(const Value &p_value) const;
+
+    private:
+        // Node i at m_tree[i], m_tree[0] is unused.
+        DynamicArray<Value> m_tree;
+        DynamicArray<Value> m_sorted;
+        size_t m_leaf_count;
+        size_t m_levels;
+        Compare m_compare;
+    };
+
     bool is_prime(size_t p_number);
 }
 
 template <typename RIterator, typename Compare>
 RIterator dsaa::merge(RIterator p_first, RIterator p_mid, RIterator p_last, Compare p_compare)
 {
-    if (p_first == p_last)
-        return p_first;
-    size_t arr1_size = p_mid - p_first;
-    size_t arr2_size = p_last - p_mid;
-    std::vector<typename std::iterator_traits<RIterator>::value_type> left(arr1_size);
-    std::vector<typename std::iterator_traits<RIterator>::value_type> right(arr2_size);
-
-    for (size_t i(0); i < arr1_size; ++i)
-        left[i] = *(p_first + i);
+    if (p_first == p_mid || p_mid == p_last)
+        return p_last;
+    // Only the left run needs room of its own.
+    std::vector<typename std::iterator_traits<RIterator>::value_type> left;
+    left.reserve(p_mid - p_first);
+    for (RIterator iter(p_first); iter != p_mid; ++iter)
+        left.push_back(std::move(*iter));
+    dsaa::detail::merge_from_buffer(left.begin(), left.end(), p_first, p_mid, p_last, p_compare);
+    return p_last;
+}
 
-    for (size_t i(0); i < arr2_size; ++i)
-        right[i] = *(p_mid + i);
+template <typename RIterator, typename BufferIterator, typename Compare>
+RIterator dsaa::buffered_merge(RIterator p_first, RIterator p_mid, RIterator p_last, BufferIterator p_buffer, Compare p_compare)
+{
+    if (p_first == p_mid || p_mid == p_last)
+        return p_last;
+    BufferIterator buffer_last(std::move(p_first, p_mid, p_buffer));
+    dsaa::detail::merge_from_buffer(p_buffer, buffer_last, p_first, p_mid, p_last, p_compare);
+    return p_last;
+}
 
-    size_t i(0), m(0);
-    for (RIterator k(p_first); k != p_last; ++k)
+template <typename RIterator, typename BufferIterator, typename Compare>
+void dsaa::detail::merge_from_buffer(BufferIterator p_buffer_first, BufferIterator p_buffer_last, RIterator p_first, RIterator p_mid, RIterator p_last, Compare p_compare)
+{
+    // The output never overtakes the right run: it trails by the number of elements left in the buffer.
+    while (p_buffer_first != p_buffer_last && p_mid != p_last)
     {
-        if (arr1_size <= i)
-        {
-            *k = right[m];
-            ++m;
-        }
-        else if (arr2_size <= m)
-        {
-            *k = left[i];
-            ++i;
-        }
-        else if (p_compare(left[i], right[m]))
-        {
-            *k = left[i];
-            ++i;
-        }
+        // Ties are taken from the left run to keep the merge stable.
+        if (p_compare(*p_mid, *p_buffer_first))
+            *p_first = std::move(*p_mid++);
         else
-        {
-            *k = right[m];
-            ++m;
-        }
+            *p_first = std::move(*p_buffer_first++);
+        ++p_first;
     }
-    return p_last;
+    std::move(p_buffer_first, p_buffer_last, p_first);
 }
 
 template <typename RIterator, typename Compare>
@@ -85,18 +130,33 @@ RIterator dsaa::lomuto_partition(RIterator p_first, RIterator p_last, Compare p_
                 is_first = false;
             else
                 ++i;
-            std::swap(*i, *k);
+            std::iter_swap(i, k);
         }
     }
     // Special case we never ever do swap.
     if (is_first)
-        std::swap(*i, *(p_last - 1));
+        std::iter_swap(i, p_last - 1);
     else
-        std::swap(*++i, *(p_last - 1));
+        std::iter_swap(++i, p_last - 1);
 
     return i;
 }
 
+template <typename RIterator, typename Compare>
+RIterator dsaa::branchless_lomuto_partition(RIterator p_first, RIterator p_last, Compare p_compare)
+{
+    RIterator pivot(p_last - 1);
+    RIterator result(p_first);
+    for (RIterator iter(p_first); iter != pivot; ++iter)
+    {
+        const bool less(p_compare(*iter, *pivot));
+        std::iter_swap(iter, result);
+        result += less;
+    }
+    std::iter_swap(result, pivot);
+    return result;
+}
+
 template <typename RIterator, typename Compare>
 RIterator dsaa::hoare_partition(RIterator p_first, RIterator p_last, Compare p_compare)
 {
@@ -124,7 +184,7 @@ RIterator dsaa::hoare_partition(RIterator p_first, RIterator p_last, Compare p_c
         // Return when all element has been put in correct side.
         if (k <= i)
             return k;
-        std::swap(*i, *k);
+        std::iter_swap(i, k);
     }
 }
 
@@ -133,7 +193,7 @@ RIterator dsaa::randomized_lomuto_partition(RIterator p_first, RIterator p_last,
 {
     size_t i(0);
     i = dsaa::random::random_range_int(0, static_cast<int>((p_last - p_first) - 1));
-    std::swap(*(p_first + i), *(p_last - 1));
+    std::iter_swap(p_first + i, p_last - 1);
     return dsaa::lomuto_partition(p_first, p_last, p_compare);
 }
 
@@ -142,8 +202,36 @@ RIterator dsaa::randomized_hoare_partition(RIterator p_first, RIterator p_last,
 {
     size_t i(0);
     i = dsaa::random::random_range_int(0, static_cast<int>((p_last - p_first) - 1));
-    std::swap(*p_first, *(p_first + i));
+    std::iter_swap(p_first, p_first + i);
     return dsaa::hoare_partition(p_first, p_last, p_compare);
 }
 
+template <typename Value, typename Compare>
+template <typename IIterator>
+dsaa::SplitterTree<Value, Compare>::SplitterTree(IIterator p_first, IIterator p_last, Compare p_compare)
+    : m_tree(), m_sorted(p_first, p_last), m_leaf_count(m_sorted.size() + 1), m_levels(0), m_compare(p_compare)
+{
+    while (size_t(1) << m_levels < m_leaf_count)
+        ++m_levels;
+    // Node i at depth d is the (i - 2^d)-th of its level, and the in-order rank of the j-th node of depth d is (2j + 1) 2^(levels - d - 1) - 1.
+    m_tree.reserve(m_leaf_count);
+    m_tree.insert_last(m_sorted[0]);
+    for (size_t depth(0); depth != m_levels; ++depth)
+        for (size_t j(0); j != size_t(1) << depth; ++j)
+            m_tree.insert_last(m_sorted[((2 * j + 1) << (m_levels - depth - 1)) - 1]);
+}
+
+template <typename Value, typename Compare>
+size_t dsaa::SplitterTree<Value, Compare>::operator()(const Value &p_value) const
+{
+    const Value *tree(m_tree.data());
+    size_t node(1);
+    for (size_t level(0); level != m_levels; ++level)
+        node = 2 * node + static_cast<size_t>(m_compare(tree[node], p_value));
+    // The bucket holds the values greater than splitter bucket - 1 and not greater than splitter bucket, the last one has no upper splitter.
+    const size_t bucket(node - m_leaf_count), last(m_leaf_count - 1);
+    const bool equal((bucket < last) & !m_compare(p_value, m_sorted.data()[bucket < last ? bucket : last - 1]));
+    return 2 * bucket + static_cast<size_t>(equal);
+}
+
 #endif //!DSAA_GENERIC_H
@@ -61,7 +61,7 @@ void dsaa::heapify(RIterator p_first, RIterator p_last, RIterator p_position, Co
 
         if (key_index != previous_key_index)
         {
-            std::swap(*previous_key_index, *key_index);
+            std::iter_swap(previous_key_index, key_index);
             previous_key_index = key_index;
         }
         else
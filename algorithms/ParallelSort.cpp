@@ -0,0 +1 @@
+#include "ParallelSort.h"
\ No newline at end of file
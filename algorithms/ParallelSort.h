@@ -0,0 +1,755 @@
+#ifndef DSAA_PARALLEL_SORT_H
+#define DSAA_PARALLEL_SORT_H
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "Sort.h"
+#include "TaskPool.h"
+#include "arrays/DynamicArray.h"
+#include "arrays/SmallDynamicArray.h"
+
+namespace dsaa
+{
+	struct ParallelSortOptions
+	{
+		// Number of threads, the calling one included. 0 means std::thread::hardware_concurrency().
+		size_t thread_count = 0;
+		// Ranges of at most this many elements are sorted or merged serially.
+		size_t grain_size = size_t(1) << 14;
+		// Pool to run on instead of starting thread_count threads for the call.
+		TaskPool *pool = nullptr;
+	};
+
+	// Parallel introsort. Partitions exactly as dsaa::sort does and forks the smaller side of every partition
+	// larger than the grain, so the result is always the same as dsaa::sort's. Not stable.
+	template <typename RIterator, typename Compare = std::less<typename std::iterator_traits<RIterator>::value_type>>
+	RIterator parallel_sort(RIterator p_first, RIterator p_last, Compare p_compare = Compare(), const ParallelSortOptions &p_options = ParallelSortOptions());
+
+	// Parallel stable merge sort: both halves are sorted in parallel and merged by a parallel merge.
+	// Being stable, the result is the same for every thread count and grain size.
+	template <typename RIterator, typename Compare = std::less<typename std::iterator_traits<RIterator>::value_type>>
+	RIterator parallel_merge_sort(RIterator p_first, RIterator p_last, Compare p_compare = Compare(), const ParallelSortOptions &p_options = ParallelSortOptions());
+
+	// In-place MSD radix sort (American flag sort) by the bytes of p_key(element), compared as unsigned char like std::string.
+	// The key may be anything convertible to std::string_view, or a contiguous container of 1-byte elements such as
+	// std::vector<unsigned char>. Wider elements do not compile, their native byte layout does not order them by value.
+	// Buckets larger than the grain are sorted in parallel, small ones by insertion sort. Not stable.
+	template <typename RIterator, typename KeyExtractor = identity_key>
+	RIterator msd_radix_sort(RIterator p_first, RIterator p_last, KeyExtractor p_key = KeyExtractor(), const ParallelSortOptions &p_options = ParallelSortOptions());
+
+	// Stable counting sort of records by a small integer or enum key: copies [p_first, p_last) to p_result, which must hold as many
+	// records, in ascending order of p_key(record), which must be in [0, p_key_count). Returns the end of the output.
+	// Records are counted in uint32_t histograms, then scattered straight to their place in the output, calling p_key twice per record.
+	// Inputs larger than the grain are split in one chunk per thread, each counted and scattered in parallel with its own histogram.
+	// Pass std::make_move_iterator(p_first) to move the records instead.
+	template <typename RIterator, typename OIterator, typename KeyExtractor>
+	OIterator counting_sort_by_key(RIterator p_first, RIterator p_last, OIterator p_result, KeyExtractor p_key, size_t p_key_count, const ParallelSortOptions &p_options = ParallelSortOptions());
+
+	// Bucket sort for any distribution: bucket boundaries are splitters picked from a sorted random sample of the input, sample sort style,
+	// so skewed inputs still get buckets of about the same size. Values equal to a splitter go to a bucket of their own, which needs no
+	// sorting, so heavy duplicates cost nothing. Every element is classified by a binary search among the splitters, then the buckets
+	// are laid out contiguously in one buffer by counting their sizes first, sorted with dsaa::sort and moved back.
+	// Inputs larger than the grain are classified and scattered in one chunk per thread, and their buckets are sorted in parallel.
+	// Not stable.
+	template <typename RIterator, typename Compare = std::less<typename std::iterator_traits<RIterator>::value_type>>
+	RIterator bucket_sort(RIterator p_first, RIterator p_last, Compare p_compare = Compare(), const ParallelSortOptions &p_options = ParallelSortOptions());
+
+	// Parallel sample sort: up to 255 splitters, picked from a sorted random sample holding 16 times as many elements, split the input in
+	// buckets sorted independently, recursively while they are larger than 4096 elements, so every element is moved once per level,
+	// from the range to a buffer of the same size and back. Elements are classified by a SplitterTree, with no branch to mispredict.
+	// Values equal to a splitter go to a bucket of their own, which needs no sorting, so heavy duplicates cost nothing.
+	// Inputs larger than the grain are split in one chunk per thread, each thread counting the bucket sizes of its chunk, then moving
+	// its elements to its own slice of every bucket, and the buckets are sorted in parallel. Not stable.
+	template <typename RIterator, typename Compare = std::less<typename std::iterator_traits<RIterator>::value_type>>
+	RIterator sample_sort(RIterator p_first, RIterator p_last, Compare p_compare = Compare(), const ParallelSortOptions &p_options = ParallelSortOptions());
+
+	namespace detail
+	{
+		// Inputs up to this size are sorted by dsaa::sort in bucket_sort.
+		inline constexpr std::ptrdiff_t bucket_sort_threshold = 1024;
+		// Elements per bucket bucket_sort aims for.
+		inline constexpr size_t bucket_sort_bucket_size = 512;
+		// Most splitters bucket_sort uses, so that the 2 * splitters + 1 buckets are numbered by a uint16_t.
+		inline constexpr size_t bucket_sort_max_splitters = 2048;
+		// Sample elements drawn per splitter.
+		inline constexpr size_t bucket_sort_oversampling = 16;
+
+		// Returns the distinct splitters of bucket_sort, picked evenly from a sorted random sample of [p_first, p_last).
+		// The sample is drawn by an engine seeded with the size of the range, so the buckets are the same from one run to the next.
+		template <typename RIterator, typename Compare>
+		NODISCARD DynamicArray<typename std::iterator_traits<RIterator>::value_type> bucket_sort_splitters(RIterator p_first, RIterator p_last, Compare p_compare);
+
+		// Returns the bucket of p_value among p_splitter_count sorted distinct splitters: 2 * i for the values between splitters i - 1 and i,
+		// 2 * i + 1 for the values equal to splitter i.
+		template <typename Value, typename Compare>
+		NODISCARD uint16_t bucket_sort_bucket(const Value &p_value, const Value *p_splitters, size_t p_splitter_count, Compare p_compare);
+
+		// Sorts [p_first, p_last) in p_chunk_count chunks forked to p_group, or serially when it is nullptr.
+		template <typename RIterator, typename Compare>
+		void bucket_sort(TaskGroup *p_group, size_t p_chunk_count, RIterator p_first, RIterator p_last, Compare p_compare, std::ptrdiff_t p_grain);
+
+		// Ranges up to this size are sorted by dsaa::sort in sample_sort.
+		inline constexpr std::ptrdiff_t sample_sort_threshold = 4096;
+		// Most buckets sample_sort splits a range in, equality buckets aside, so that its 2 * 256 buckets are numbered by a uint16_t.
+		inline constexpr size_t sample_sort_max_buckets = 256;
+		// Sample elements drawn per bucket.
+		inline constexpr size_t sample_sort_oversampling = 16;
+		// Levels of buckets after which sample_sort sorts the buckets with dsaa::sort whatever their size.
+		inline constexpr size_t sample_sort_max_levels = 4;
+
+		// Sorts the p_last - p_first elements at p_buffer if p_in_buffer, at p_first otherwise, to [p_first, p_last), in p_chunk_count
+		// chunks forked to p_group, or serially when it is nullptr.
+		template <typename RIterator, typename Pointer, typename Compare>
+		void sample_sort(TaskGroup *p_group, size_t p_chunk_count, RIterator p_first, RIterator p_last, Pointer p_buffer, bool p_in_buffer, size_t p_levels, Compare p_compare, std::ptrdiff_t p_grain);
+
+		// Histograms of counting_sort_by_key up to this many keys are kept on the stack.
+		inline constexpr size_t counting_sort_inline_keys = 256;
+
+		// Returns p_key as a counting_sort_by_key bucket.
+		template <typename Key>
+		NODISCARD size_t counting_sort_bucket(Key p_key, size_t p_key_count) NOEXCEPT;
+
+		// Runs p_function with the pool p_options asks for.
+		template <typename Function>
+		void with_task_pool(const ParallelSortOptions &p_options, Function p_function);
+
+		template <typename RIterator, typename Compare>
+		void parallel_introsort_loop(TaskGroup &p_group, RIterator p_first, RIterator p_last, size_t p_depth_limit, Compare p_compare, std::ptrdiff_t p_grain);
+
+		template <typename RIterator1, typename RIterator2, typename OIterator, typename Compare>
+		void parallel_move_merge(TaskPool &p_pool, RIterator1 p_first1, RIterator1 p_last1, RIterator2 p_first2, RIterator2 p_last2, OIterator p_result, Compare p_compare, std::ptrdiff_t p_grain);
+
+		// Buckets up to this size are insertion sorted by msd_radix_sort.
+		inline constexpr std::ptrdiff_t msd_radix_sort_threshold = 32;
+
+		// Returns the bytes of a msd_radix_sort key: a string, or a contiguous container of 1-byte elements.
+		template <typename Key>
+		NODISCARD std::string_view radix_bytes(const Key &p_key) noexcept;
+
+		// Sorts [p_first, p_last), whose keys share their first p_depth bytes. Buckets larger than p_grain are forked to p_group.
+		template <typename RIterator, typename KeyExtractor>
+		void american_flag_sort(TaskGroup *p_group, RIterator p_first, RIterator p_last, size_t p_depth, KeyExtractor p_key, std::ptrdiff_t p_grain);
+
+		// Sorts [p_first, p_last) using p_buffer, which holds at least as many elements, as scratch space.
+		template <typename RIterator, typename Pointer, typename Compare>
+		void parallel_merge_sort(TaskPool &p_pool, RIterator p_first, RIterator p_last, Pointer p_buffer, Compare p_compare, std::ptrdiff_t p_grain);
+	}
+}
+
+template <typename Function>
+void dsaa::detail::with_task_pool(const ParallelSortOptions &p_options, Function p_function)
+{
+	if (p_options.pool)
+		p_function(*p_options.pool);
+	else
+	{
+		TaskPool pool(p_options.thread_count);
+		p_function(pool);
+	}
+}
+
+template <typename RIterator, typename Compare>
+void dsaa::detail::parallel_introsort_loop(TaskGroup &p_group, RIterator p_first, RIterator p_last, size_t p_depth_limit, Compare p_compare, std::ptrdiff_t p_grain)
+{
+	// Same steps as introsort_loop, only the smaller side is forked instead of called.
+	while (p_grain < p_last - p_first && p_depth_limit)
+	{
+		--p_depth_limit;
+		RIterator cut(introsort_partition(p_first, p_last, p_compare));
+		if (cut - p_first < p_last - cut)
+		{
+			p_group.run([&p_group, p_first, cut, p_depth_limit, p_compare, p_grain]()
+						{ parallel_introsort_loop(p_group, p_first, cut, p_depth_limit, p_compare, p_grain); });
+			p_first = cut;
+		}
+		else
+		{
+			p_group.run([&p_group, cut, p_last, p_depth_limit, p_compare, p_grain]()
+						{ parallel_introsort_loop(p_group, cut, p_last, p_depth_limit, p_compare, p_grain); });
+			p_last = cut;
+		}
+	}
+	introsort_loop(p_first, p_last, p_depth_limit, p_compare);
+}
+
+template <typename RIterator, typename Compare>
+RIterator dsaa::parallel_sort(RIterator p_first, RIterator p_last, Compare p_compare, const ParallelSortOptions &p_options)
+{
+	if (p_last - p_first < 2)
+		return p_last;
+
+	// Never fork below the size introsort finishes with insertion sort.
+	const std::ptrdiff_t grain(std::max<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(p_options.grain_size), detail::introsort_threshold));
+	const size_t depth_limit(detail::introsort_depth_limit(p_last - p_first));
+	if (p_last - p_first <= grain)
+	{
+		detail::introsort_loop(p_first, p_last, depth_limit, p_compare);
+		return p_last;
+	}
+
+	detail::with_task_pool(p_options, [&](TaskPool &p_pool)
+						   {
+							   TaskGroup group(p_pool);
+							   detail::parallel_introsort_loop(group, p_first, p_last, depth_limit, p_compare, grain);
+							   group.wait(); });
+	return p_last;
+}
+
+template <typename Key>
+std::string_view dsaa::detail::radix_bytes(const Key &p_key) noexcept
+{
+	if constexpr (std::is_convertible_v<const Key &, std::string_view>)
+		return std::string_view(p_key);
+	else
+	{
+		// Wider elements would be sorted by their native byte layout rather than by value, e.g. little-endian integers.
+		static_assert(sizeof(*std::data(p_key)) == 1 && std::is_trivially_copyable_v<std::remove_pointer_t<decltype(std::data(p_key))>>,
+					  "msd_radix_sort needs string keys or contiguous containers of 1-byte elements.");
+		return std::string_view(reinterpret_cast<const char *>(std::data(p_key)), std::size(p_key));
+	}
+}
+
+template <typename RIterator, typename KeyExtractor>
+void dsaa::detail::american_flag_sort(TaskGroup *p_group, RIterator p_first, RIterator p_last, size_t p_depth, KeyExtractor p_key, std::ptrdiff_t p_grain)
+{
+	using value_type = typename std::iterator_traits<RIterator>::value_type;
+	// Bucket 0 holds the keys that end at p_depth, bucket b + 1 those whose byte at p_depth is b.
+	constexpr size_t buckets(257);
+	auto bucket([&p_key, &p_depth](const value_type &p_elem) -> size_t
+				{
+					const auto &key(std::invoke(p_key, p_elem));
+					const std::string_view bytes(radix_bytes(key));
+					return p_depth < bytes.size() ? static_cast<unsigned char>(bytes[p_depth]) + size_t(1) : 0; });
+
+	while (true)
+	{
+		const std::ptrdiff_t size(p_last - p_first);
+		if (size <= msd_radix_sort_threshold)
+		{
+			dsaa::insertion_sort(p_first, p_last, [&p_key, p_depth](const value_type &p_lhs, const value_type &p_rhs)
+								 {
+									 const auto &lhs(std::invoke(p_key, p_lhs));
+									 const auto &rhs(std::invoke(p_key, p_rhs));
+									 const std::string_view lhs_bytes(radix_bytes(lhs)), rhs_bytes(radix_bytes(rhs));
+									 return lhs_bytes.substr(std::min(p_depth, lhs_bytes.size())) < rhs_bytes.substr(std::min(p_depth, rhs_bytes.size())); });
+			return;
+		}
+
+		std::ptrdiff_t counts[buckets] = {};
+		for (RIterator iter(p_first); iter != p_last; ++iter)
+			++counts[bucket(*iter)];
+
+		// A common byte needs no permutation. Skip the whole common prefix in one pass instead of a byte per pass.
+		const size_t first_bucket(bucket(*p_first));
+		if (counts[first_bucket] == size)
+		{
+			if (!first_bucket)
+				return;
+			const auto &first_key(std::invoke(p_key, *p_first));
+			const std::string_view first_bytes(radix_bytes(first_key));
+			size_t common(first_bytes.size());
+			for (RIterator iter(p_first + 1); iter != p_last && p_depth + 1 < common; ++iter)
+			{
+				const auto &key(std::invoke(p_key, *iter));
+				const std::string_view bytes(radix_bytes(key));
+				const size_t length(std::min(common, bytes.size()));
+				size_t i(p_depth + 1);
+				while (i < length && bytes[i] == first_bytes[i])
+					++i;
+				common = i;
+			}
+			p_depth = std::max(common, p_depth + 1);
+			continue;
+		}
+
+		std::ptrdiff_t heads[buckets], tails[buckets];
+		std::ptrdiff_t offset(0);
+		for (size_t b(0); b != buckets; ++b)
+		{
+			heads[b] = offset;
+			offset += counts[b];
+			tails[b] = offset;
+		}
+
+		// Cycle every misplaced element to the next free slot of its bucket.
+		for (size_t b(0); b != buckets; ++b)
+			while (heads[b] < tails[b])
+			{
+				for (size_t target(bucket(p_first[heads[b]])); target != b; target = bucket(p_first[heads[b]]))
+					std::iter_swap(p_first + heads[b], p_first + heads[target]++);
+				++heads[b];
+			}
+
+		// Bucket 0 is done: its keys are equal. The largest other bucket is sorted by the next iteration,
+		// so every recursion at least halves the range and the stack stays O(log n).
+		const size_t largest(std::max_element(counts + 1, counts + buckets) - counts);
+		RIterator bucket_first(p_first + counts[0]), next_first(p_first), next_last(p_first);
+		for (size_t b(1); b != buckets; ++b)
+		{
+			RIterator bucket_last(bucket_first + counts[b]);
+			if (b == largest)
+			{
+				next_first = bucket_first;
+				next_last = bucket_last;
+			}
+			else if (1 < counts[b])
+			{
+				if (p_group && p_grain < counts[b])
+					p_group->run([p_group, bucket_first, bucket_last, p_depth, p_key, p_grain]()
+								 { american_flag_sort(p_group, bucket_first, bucket_last, p_depth + 1, p_key, p_grain); });
+				else
+					american_flag_sort(p_group, bucket_first, bucket_last, p_depth + 1, p_key, p_grain);
+			}
+			bucket_first = bucket_last;
+		}
+		p_first = next_first;
+		p_last = next_last;
+		++p_depth;
+	}
+}
+
+template <typename RIterator, typename KeyExtractor>
+RIterator dsaa::msd_radix_sort(RIterator p_first, RIterator p_last, KeyExtractor p_key, const ParallelSortOptions &p_options)
+{
+	const std::ptrdiff_t grain(std::max<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(p_options.grain_size), detail::msd_radix_sort_threshold));
+	if (p_last - p_first <= grain)
+	{
+		detail::american_flag_sort(static_cast<TaskGroup *>(nullptr), p_first, p_last, 0, p_key, grain);
+		return p_last;
+	}
+
+	detail::with_task_pool(p_options, [&](TaskPool &p_pool)
+						   {
+							   TaskGroup group(p_pool);
+							   detail::american_flag_sort(&group, p_first, p_last, 0, p_key, grain);
+							   group.wait(); });
+	return p_last;
+}
+
+template <typename Key>
+size_t dsaa::detail::counting_sort_bucket(Key p_key, size_t p_key_count) NOEXCEPT
+{
+	static_assert(std::is_integral_v<Key> || std::is_enum_v<Key>, "counting_sort_by_key needs integer or enum keys.");
+	// Negative keys wrap around to large buckets.
+	const size_t result(static_cast<size_t>(p_key));
+#ifdef PARAM_CHECK
+	if (p_key_count <= result)
+		throw std::out_of_range("counting_sort_by_key key out of range.");
+#else
+	(void)p_key_count;
+#endif
+	return result;
+}
+
+template <typename RIterator, typename OIterator, typename KeyExtractor>
+OIterator dsaa::counting_sort_by_key(RIterator p_first, RIterator p_last, OIterator p_result, KeyExtractor p_key, size_t p_key_count, const ParallelSortOptions &p_options)
+{
+	using difference_type = typename std::iterator_traits<OIterator>::difference_type;
+
+	const size_t size(static_cast<size_t>(p_last - p_first)), grain(std::max<size_t>(p_options.grain_size, 1)), max_chunk(std::numeric_limits<uint32_t>::max());
+	if (size <= grain && size <= max_chunk)
+	{
+		// The counts become the next output position of every key.
+		SmallDynamicArray<uint32_t, detail::counting_sort_inline_keys> positions(p_key_count, 0);
+		for (RIterator iter(p_first); iter != p_last; ++iter)
+			++positions[detail::counting_sort_bucket(std::invoke(p_key, *iter), p_key_count)];
+		uint32_t position(0);
+		for (uint32_t &count : positions)
+			position += std::exchange(count, position);
+		for (RIterator iter(p_first); iter != p_last; ++iter)
+			p_result[static_cast<difference_type>(positions[detail::counting_sort_bucket(std::invoke(p_key, *iter), p_key_count)]++)] = *iter;
+		return p_result + static_cast<difference_type>(size);
+	}
+
+	detail::with_task_pool(p_options, [&](TaskPool &p_pool)
+						   {
+							   // Chunk c is [p_first + size * c / chunk_count, p_first + size * (c + 1) / chunk_count), none larger than uint32_t counts.
+							   const size_t chunk_count(std::max((size + max_chunk - 1) / max_chunk, std::min(p_pool.thread_count(), (size + grain - 1) / grain)));
+							   auto chunk_first([&](size_t p_chunk)
+												{ return p_first + static_cast<std::ptrdiff_t>(size / chunk_count * p_chunk + size % chunk_count * p_chunk / chunk_count); });
+
+							   // Histogram of chunk c in row c.
+							   DynamicArray<uint32_t> counts(chunk_count * p_key_count, 0);
+							   TaskGroup group(p_pool);
+							   for (size_t chunk(0); chunk != chunk_count; ++chunk)
+								   group.run([&, chunk]()
+											 {
+												 uint32_t *row(counts.data() + chunk * p_key_count);
+												 for (RIterator iter(chunk_first(chunk)), last(chunk_first(chunk + 1)); iter != last; ++iter)
+													 ++row[detail::counting_sort_bucket(std::invoke(p_key, *iter), p_key_count)]; });
+							   group.wait();
+
+							   // Records of a key go after the smaller keys and after the same key in the previous chunks.
+							   DynamicArray<size_t> positions(chunk_count * p_key_count, dsaa::default_init);
+							   size_t position(0);
+							   for (size_t key(0); key != p_key_count; ++key)
+								   for (size_t chunk(0); chunk != chunk_count; ++chunk)
+								   {
+									   positions[chunk * p_key_count + key] = position;
+									   position += counts[chunk * p_key_count + key];
+								   }
+
+							   for (size_t chunk(0); chunk != chunk_count; ++chunk)
+								   group.run([&, chunk]()
+											 {
+												 size_t *row(positions.data() + chunk * p_key_count);
+												 for (RIterator iter(chunk_first(chunk)), last(chunk_first(chunk + 1)); iter != last; ++iter)
+													 p_result[static_cast<difference_type>(row[detail::counting_sort_bucket(std::invoke(p_key, *iter), p_key_count)]++)] = *iter; });
+							   group.wait(); });
+	return p_result + static_cast<difference_type>(size);
+}
+
+template <typename RIterator, typename Compare>
+dsaa::DynamicArray<typename std::iterator_traits<RIterator>::value_type> dsaa::detail::bucket_sort_splitters(RIterator p_first, RIterator p_last, Compare p_compare)
+{
+	const size_t size(static_cast<size_t>(p_last - p_first));
+	const size_t splitter_count(std::clamp<size_t>(size / bucket_sort_bucket_size, 1, bucket_sort_max_splitters));
+
+	std::minstd_rand engine(static_cast<std::minstd_rand::result_type>(size));
+	std::uniform_int_distribution<size_t> distribution(0, size - 1);
+	DynamicArray<typename std::iterator_traits<RIterator>::value_type> sample;
+	sample.reserve(splitter_count * bucket_sort_oversampling);
+	for (size_t i(0); i != splitter_count * bucket_sort_oversampling; ++i)
+		sample.insert_last(p_first[static_cast<std::ptrdiff_t>(distribution(engine))]);
+	dsaa::sort(sample.begin(), sample.end(), p_compare);
+
+	DynamicArray<typename std::iterator_traits<RIterator>::value_type> result;
+	result.reserve(splitter_count);
+	for (size_t i(0); i != splitter_count; ++i)
+	{
+		auto &candidate(sample[i * bucket_sort_oversampling + bucket_sort_oversampling / 2]);
+		if (result.empty() || p_compare(result[result.size() - 1], candidate))
+			result.insert_last(std::move(candidate));
+	}
+	return result;
+}
+
+template <typename Value, typename Compare>
+uint16_t dsaa::detail::bucket_sort_bucket(const Value &p_value, const Value *p_splitters, size_t p_splitter_count, Compare p_compare)
+{
+	// Branchless upper bound: the halving does not depend on the comparisons, which compile to conditional moves.
+	const Value *base(p_splitters);
+	for (size_t count(p_splitter_count); 1 < count; count -= count / 2)
+		base = p_compare(p_value, base[count / 2]) ? base : base + count / 2;
+	const size_t greater(static_cast<size_t>(base - p_splitters) + !p_compare(p_value, *base));
+	return static_cast<uint16_t>(greater && !p_compare(p_splitters[greater - 1], p_value) ? 2 * greater - 1 : 2 * greater);
+}
+
+template <typename RIterator, typename Compare>
+void dsaa::detail::bucket_sort(TaskGroup *p_group, size_t p_chunk_count, RIterator p_first, RIterator p_last, Compare p_compare, std::ptrdiff_t p_grain)
+{
+	const size_t size(static_cast<size_t>(p_last - p_first));
+	const auto splitters(bucket_sort_splitters(p_first, p_last, p_compare));
+	const size_t bucket_count(2 * splitters.size() + 1);
+	// Chunk c is [size * c / p_chunk_count, size * (c + 1) / p_chunk_count).
+	auto chunk_first([size, p_chunk_count](size_t p_chunk)
+					 { return size / p_chunk_count * p_chunk + size % p_chunk_count * p_chunk / p_chunk_count; });
+	auto for_each_chunk([p_group, p_chunk_count](auto p_task)
+						{
+							if (!p_group)
+								return p_task(0);
+							for (size_t chunk(0); chunk != p_chunk_count; ++chunk)
+								p_group->run([p_task, chunk]()
+											 { p_task(chunk); });
+							p_group->wait(); });
+
+	// First pass: the bucket of every element and the size of every bucket in every chunk, chunk c in row c.
+	DynamicArray<uint16_t> buckets(size, dsaa::default_init);
+	DynamicArray<size_t> positions(p_chunk_count * bucket_count, 0);
+	for_each_chunk([&](size_t p_chunk)
+				   {
+					   size_t *row(positions.data() + p_chunk * bucket_count);
+					   for (size_t i(chunk_first(p_chunk)), last(chunk_first(p_chunk + 1)); i != last; ++i)
+						   ++row[buckets[i] = bucket_sort_bucket(p_first[static_cast<std::ptrdiff_t>(i)], splitters.data(), splitters.size(), p_compare)]; });
+
+	// The elements of a bucket go after the smaller buckets and after the same bucket in the previous chunks.
+	DynamicArray<size_t> bucket_first(bucket_count + 1, dsaa::default_init);
+	size_t position(0);
+	for (size_t bucket(0); bucket != bucket_count; ++bucket)
+	{
+		bucket_first[bucket] = position;
+		for (size_t chunk(0); chunk != p_chunk_count; ++chunk)
+			position += std::exchange(positions[chunk * bucket_count + bucket], position);
+	}
+	bucket_first[bucket_count] = size;
+
+	// Second pass: every element to its bucket in the buffer.
+	auto buffer(make_sort_buffer(p_first, p_last));
+	for_each_chunk([&](size_t p_chunk)
+				   {
+					   size_t *row(positions.data() + p_chunk * bucket_count);
+					   for (size_t i(chunk_first(p_chunk)), last(chunk_first(p_chunk + 1)); i != last; ++i)
+						   buffer[row[buckets[i]]++] = std::move(p_first[static_cast<std::ptrdiff_t>(i)]); });
+
+	// Buckets are sorted in the buffer and moved back, the consecutive ones holding about p_grain elements together in one task.
+	auto sort_buckets([&](size_t p_first_bucket, size_t p_last_bucket)
+					  {
+						  for (size_t bucket(p_first_bucket); bucket != p_last_bucket; ++bucket)
+						  {
+							  auto first(buffer.data() + bucket_first[bucket]), last(buffer.data() + bucket_first[bucket + 1]);
+							  // Odd buckets hold the values equal to a splitter.
+							  if (bucket % 2 == 0)
+								  dsaa::sort(first, last, p_compare);
+							  std::move(first, last, p_first + static_cast<std::ptrdiff_t>(bucket_first[bucket]));
+						  } });
+	if (!p_group)
+		return sort_buckets(0, bucket_count);
+	for (size_t first_bucket(0), last_bucket(0); first_bucket != bucket_count; first_bucket = last_bucket)
+	{
+		while (last_bucket != bucket_count && bucket_first[last_bucket] - bucket_first[first_bucket] < static_cast<size_t>(p_grain))
+			++last_bucket;
+		p_group->run([&sort_buckets, first_bucket, last_bucket]()
+					 { sort_buckets(first_bucket, last_bucket); });
+	}
+	p_group->wait();
+}
+
+template <typename RIterator, typename Compare>
+RIterator dsaa::bucket_sort(RIterator p_first, RIterator p_last, Compare p_compare, const ParallelSortOptions &p_options)
+{
+	if (p_last - p_first <= detail::bucket_sort_threshold)
+	{
+		dsaa::sort(p_first, p_last, p_compare);
+		return p_last;
+	}
+
+	const std::ptrdiff_t grain(std::max<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(p_options.grain_size), detail::bucket_sort_threshold));
+	if (p_last - p_first <= grain)
+	{
+		detail::bucket_sort(static_cast<TaskGroup *>(nullptr), 1, p_first, p_last, p_compare, grain);
+		return p_last;
+	}
+
+	detail::with_task_pool(p_options, [&](TaskPool &p_pool)
+						   {
+							   TaskGroup group(p_pool);
+							   const size_t chunk_count(std::min(p_pool.thread_count(), static_cast<size_t>((p_last - p_first + grain - 1) / grain)));
+							   detail::bucket_sort(&group, chunk_count, p_first, p_last, p_compare, grain); });
+	return p_last;
+}
+
+template <typename RIterator, typename Pointer, typename Compare>
+void dsaa::detail::sample_sort(TaskGroup *p_group, size_t p_chunk_count, RIterator p_first, RIterator p_last, Pointer p_buffer, bool p_in_buffer, size_t p_levels, Compare p_compare, std::ptrdiff_t p_grain)
+{
+	using value_type = typename std::iterator_traits<RIterator>::value_type;
+	const size_t size(static_cast<size_t>(p_last - p_first));
+	if (p_last - p_first <= sample_sort_threshold || !p_levels)
+	{
+		if (p_in_buffer)
+			std::move(p_buffer, p_buffer + size, p_first);
+		dsaa::sort(p_first, p_last, p_compare);
+		return;
+	}
+
+	// The fewest buckets bringing them down to the threshold, as far as the maximum.
+	size_t leaf_count(2);
+	while (leaf_count != sample_sort_max_buckets && leaf_count * sample_sort_threshold < size)
+		leaf_count *= 2;
+
+	// Splitters picked evenly from a sorted random sample, drawn by an engine seeded with the size as in bucket_sort.
+	std::minstd_rand engine(static_cast<std::minstd_rand::result_type>(size));
+	std::uniform_int_distribution<size_t> distribution(0, size - 1);
+	DynamicArray<value_type> sample;
+	sample.reserve(leaf_count * sample_sort_oversampling);
+	for (size_t i(0); i != leaf_count * sample_sort_oversampling; ++i)
+	{
+		const std::ptrdiff_t index(static_cast<std::ptrdiff_t>(distribution(engine)));
+		sample.insert_last(p_in_buffer ? p_buffer[index] : p_first[index]);
+	}
+	dsaa::sort(sample.begin(), sample.end(), p_compare);
+	DynamicArray<value_type> splitters;
+	splitters.reserve(leaf_count - 1);
+	for (size_t i(1); i != leaf_count; ++i)
+		splitters.insert_last(std::move(sample[i * sample_sort_oversampling]));
+	const SplitterTree<value_type, Compare> classify(splitters.begin(), splitters.end(), p_compare);
+	const size_t bucket_count(classify.bucket_count());
+
+	// Chunk c is [size * c / p_chunk_count, size * (c + 1) / p_chunk_count).
+	auto chunk_first([size, p_chunk_count](size_t p_chunk)
+					 { return size / p_chunk_count * p_chunk + size % p_chunk_count * p_chunk / p_chunk_count; });
+	auto for_each_chunk([p_group, p_chunk_count](auto p_task)
+						{
+							if (!p_group)
+								return p_task(0);
+							for (size_t chunk(0); chunk != p_chunk_count; ++chunk)
+								p_group->run([p_task, chunk]()
+											 { p_task(chunk); });
+							p_group->wait(); });
+
+	// First pass: the bucket of every element and the size of every bucket in every chunk, chunk c in row c.
+	DynamicArray<uint16_t> buckets(size, dsaa::default_init);
+	DynamicArray<size_t> positions(p_chunk_count * bucket_count, 0);
+	auto count([&](auto p_source)
+			   { for_each_chunk([&](size_t p_chunk)
+								{
+									size_t *row(positions.data() + p_chunk * bucket_count);
+									for (size_t i(chunk_first(p_chunk)), last(chunk_first(p_chunk + 1)); i != last; ++i)
+										++row[buckets[i] = static_cast<uint16_t>(classify(p_source[static_cast<std::ptrdiff_t>(i)]))]; }); });
+	if (p_in_buffer)
+		count(p_buffer);
+	else
+		count(p_first);
+
+	// The elements of a bucket go after the smaller buckets and after the same bucket in the previous chunks,
+	// so every chunk moves its elements to a slice of the bucket of its own.
+	DynamicArray<size_t> bucket_first(bucket_count + 1, dsaa::default_init);
+	size_t position(0);
+	for (size_t bucket(0); bucket != bucket_count; ++bucket)
+	{
+		bucket_first[bucket] = position;
+		for (size_t chunk(0); chunk != p_chunk_count; ++chunk)
+			position += std::exchange(positions[chunk * bucket_count + bucket], position);
+	}
+	bucket_first[bucket_count] = size;
+
+	// Second pass: every element to its bucket, in the range if it was in the buffer and the other way round.
+	auto distribute([&](auto p_source, auto p_destination)
+					{ for_each_chunk([&](size_t p_chunk)
+									 {
+										 size_t *row(positions.data() + p_chunk * bucket_count);
+										 for (size_t i(chunk_first(p_chunk)), last(chunk_first(p_chunk + 1)); i != last; ++i)
+											 p_destination[static_cast<std::ptrdiff_t>(row[buckets[i]]++)] = std::move(p_source[static_cast<std::ptrdiff_t>(i)]); }); });
+	if (p_in_buffer)
+		distribute(p_buffer, p_first);
+	else
+		distribute(p_first, p_buffer);
+
+	// Buckets are sorted one level down, the consecutive ones holding about p_grain elements together in one task.
+	auto sort_buckets([&](size_t p_first_bucket, size_t p_last_bucket)
+					  {
+						  for (size_t bucket(p_first_bucket); bucket != p_last_bucket; ++bucket)
+						  {
+							  const std::ptrdiff_t first(static_cast<std::ptrdiff_t>(bucket_first[bucket])), last(static_cast<std::ptrdiff_t>(bucket_first[bucket + 1]));
+							  // Odd buckets hold the values equal to a splitter, only to be moved back from the buffer.
+							  if (bucket % 2 == 0)
+								  detail::sample_sort(static_cast<TaskGroup *>(nullptr), 1, p_first + first, p_first + last, p_buffer + first, !p_in_buffer, p_levels - 1, p_compare, p_grain);
+							  else if (!p_in_buffer)
+								  std::move(p_buffer + first, p_buffer + last, p_first + first);
+						  } });
+	if (!p_group)
+		return sort_buckets(0, bucket_count);
+	for (size_t first_bucket(0), last_bucket(0); first_bucket != bucket_count; first_bucket = last_bucket)
+	{
+		while (last_bucket != bucket_count && bucket_first[last_bucket] - bucket_first[first_bucket] < static_cast<size_t>(p_grain))
+			++last_bucket;
+		p_group->run([&sort_buckets, first_bucket, last_bucket]()
+					 { sort_buckets(first_bucket, last_bucket); });
+	}
+	p_group->wait();
+}
+
+template <typename RIterator, typename Compare>
+RIterator dsaa::sample_sort(RIterator p_first, RIterator p_last, Compare p_compare, const ParallelSortOptions &p_options)
+{
+	if (p_last - p_first <= detail::sample_sort_threshold)
+	{
+		dsaa::sort(p_first, p_last, p_compare);
+		return p_last;
+	}
+
+	const std::ptrdiff_t grain(std::max<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(p_options.grain_size), detail::sample_sort_threshold));
+	auto buffer(detail::make_sort_buffer(p_first, p_last));
+	if (p_last - p_first <= grain)
+	{
+		detail::sample_sort(static_cast<TaskGroup *>(nullptr), 1, p_first, p_last, buffer.data(), false, detail::sample_sort_max_levels, p_compare, grain);
+		return p_last;
+	}
+
+	detail::with_task_pool(p_options, [&](TaskPool &p_pool)
+						   {
+							   TaskGroup group(p_pool);
+							   const size_t chunk_count(std::min(p_pool.thread_count(), static_cast<size_t>((p_last - p_first + grain - 1) / grain)));
+							   detail::sample_sort(&group, chunk_count, p_first, p_last, buffer.data(), false, detail::sample_sort_max_levels, p_compare, grain); });
+	return p_last;
+}
+
+template <typename RIterator1, typename RIterator2, typename OIterator, typename Compare>
+void dsaa::detail::parallel_move_merge(TaskPool &p_pool, RIterator1 p_first1, RIterator1 p_last1, RIterator2 p_first2, RIterator2 p_last2, OIterator p_result, Compare p_compare, std::ptrdiff_t p_grain)
+{
+	const std::ptrdiff_t size1(p_last1 - p_first1), size2(p_last2 - p_first2);
+	if (size1 + size2 <= p_grain)
+	{
+		move_merge(p_first1, p_last1, p_first2, p_last2, p_result, p_compare);
+		return;
+	}
+
+	// Split the larger range at its middle and the other one where that element lands.
+	// Equal elements of the first range stay in front of those of the second one.
+	RIterator1 mid1;
+	RIterator2 mid2;
+	if (size2 <= size1)
+	{
+		mid1 = p_first1 + size1 / 2;
+		mid2 = std::lower_bound(p_first2, p_last2, *mid1, p_compare);
+	}
+	else
+	{
+		mid2 = p_first2 + size2 / 2;
+		mid1 = std::upper_bound(p_first1, p_last1, *mid2, p_compare);
+	}
+
+	OIterator result_mid(p_result + ((mid1 - p_first1) + (mid2 - p_first2)));
+	TaskGroup group(p_pool);
+	group.run([&p_pool, p_first1, mid1, p_first2, mid2, p_result, p_compare, p_grain]()
+			  { parallel_move_merge(p_pool, p_first1, mid1, p_first2, mid2, p_result, p_compare, p_grain); });
+	parallel_move_merge(p_pool, mid1, p_last1, mid2, p_last2, result_mid, p_compare, p_grain);
+	group.wait();
+}
+
+template <typename RIterator, typename Pointer, typename Compare>
+void dsaa::detail::parallel_merge_sort(TaskPool &p_pool, RIterator p_first, RIterator p_last, Pointer p_buffer, Compare p_compare, std::ptrdiff_t p_grain)
+{
+	const std::ptrdiff_t size(p_last - p_first);
+	if (size <= p_grain)
+	{
+		merge_sort_in_place(p_first, p_last, p_buffer, p_compare);
+		return;
+	}
+
+	RIterator mid(p_first + size / 2);
+
+	{
+		TaskGroup group(p_pool);
+		group.run([&p_pool, p_first, mid, p_buffer, p_compare, p_grain]()
+				  { parallel_merge_sort(p_pool, p_first, mid, p_buffer, p_compare, p_grain); });
+		parallel_merge_sort(p_pool, mid, p_last, p_buffer + size / 2, p_compare, p_grain);
+		group.wait();
+	}
+
+	parallel_move_merge(p_pool, p_first, mid, mid, p_last, p_buffer, p_compare, p_grain);
+
+	// Move back in grain sized chunks.
+	TaskGroup group(p_pool);
+	for (std::ptrdiff_t i(0); i < size; i += p_grain)
+	{
+		const std::ptrdiff_t count(std::min(p_grain, size - i));
+		group.run([p_buffer, p_first, i, count]()
+				  { std::move(p_buffer + i, p_buffer + i + count, p_first + i); });
+	}
+	group.wait();
+}
+
+template <typename RIterator, typename Compare>
+RIterator dsaa::parallel_merge_sort(RIterator p_first, RIterator p_last, Compare p_compare, const ParallelSortOptions &p_options)
+{
+	if (p_last - p_first < 2)
+		return p_last;
+
+	const std::ptrdiff_t grain(std::max<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(p_options.grain_size), detail::introsort_threshold));
+	auto buffer(detail::make_sort_buffer(p_first, p_last));
+	detail::with_task_pool(p_options, [&](TaskPool &p_pool)
+						   { detail::parallel_merge_sort(p_pool, p_first, p_last, buffer.data(), p_compare, grain); });
+	return p_last;
+}
+
+#endif // !DSAA_PARALLEL_SORT_H
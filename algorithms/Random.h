@@ -53,7 +53,7 @@ dsaa::DynamicArray<IntType> dsaa::random::random_range_ints(size_t p_size, IntTy
     std::random_device device;
     std::mt19937 engine(device());
     std::uniform_int_distribution<IntType> distribution(p_first, p_last); // distribution in range [p_first, p_last]
-    dsaa::DynamicArray<IntType> result(p_size);
+    dsaa::DynamicArray<IntType> result(p_size, dsaa::default_init); // Every element is written below.
 
     for (size_t i(0); p_size != i; ++i)
         result[i] = distribution(engine);
@@ -66,7 +66,7 @@ dsaa::DynamicArray<RealType> dsaa::random::random_range_reals(size_t p_size, Rea
     std::random_device device;
     std::mt19937 engine(device());
     std::uniform_real_distribution<RealType> distribution(p_begin, p_end); // distribution in range [p_begin, p_end)
-    dsaa::DynamicArray<RealType> result(p_size);
+    dsaa::DynamicArray<RealType> result(p_size, dsaa::default_init); // Every element is written below.
 
     for (size_t i(0); p_size != i; ++i)
         result[i] = distribution(engine);
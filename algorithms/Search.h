@@ -55,7 +55,7 @@ RIterator dsaa::binary_search(RIterator p_first, RIterator p_last, Value p_value
 		{
 			if (*low == p_value)
 				return low;
-			if (*high == p_value)
+			if (high != p_last && *high == p_value)
 				return high;
 			return p_last;
 		}
@@ -0,0 +1,496 @@
+#include "SimdSort.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <limits>
+
+#include "Sort.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define DSAA_SIMD_SORT_AVX2
+#include <immintrin.h>
+// Only the kernels are compiled for AVX2, the rest of the program keeps running on any x86 processor.
+#define DSAA_TARGET_AVX2 __attribute__((target("avx2,popcnt")))
+#endif
+
+namespace
+{
+	template <typename T>
+	T median_of_3(T p_a, T p_b, T p_c) noexcept
+	{
+		return std::max(std::min(p_a, p_b), std::min(std::max(p_a, p_b), p_c));
+	}
+
+	template <typename T>
+	T choose_pivot(const T *p_first, const T *p_last) noexcept
+	{
+		const std::ptrdiff_t size(p_last - p_first);
+		const T *mid(p_first + size / 2);
+		if (size <= dsaa::detail::ninther_threshold)
+			return median_of_3(*p_first, *mid, *(p_last - 1));
+		const std::ptrdiff_t step(size / 8);
+		return median_of_3(median_of_3(p_first[0], p_first[step], p_first[2 * step]),
+						   median_of_3(mid[-step], mid[0], mid[step]),
+						   median_of_3(p_last[-1 - 2 * step], p_last[-1 - step], p_last[-1]));
+	}
+
+	// Returns whether p_value goes in front of p_pivot: when it is less, or with Inclusive when the pivot is not less.
+	template <bool Inclusive, typename T>
+	bool goes_left(T p_value, T p_pivot) noexcept
+	{
+		return Inclusive ? !(p_pivot < p_value) : p_value < p_pivot;
+	}
+
+	// Moves the elements that go left of p_pivot to the front without data dependent branches.
+	template <bool Inclusive, typename T>
+	T *scalar_partition(T *p_first, T *p_last, T p_pivot) noexcept
+	{
+		T *result(p_first);
+		for (T *iter(p_first); iter != p_last; ++iter)
+		{
+			const T value(*iter);
+			const bool left(goes_left<Inclusive>(value, p_pivot));
+			*iter = *result;
+			*result = value;
+			result += left;
+		}
+		return result;
+	}
+
+	// Moves the NaNs behind every other element and returns where they start. The kernels only see the elements in
+	// front: a NaN pivot would leave a partition that makes no progress, and vector min and max do not treat NaN symmetrically.
+	template <typename T>
+	T *move_nans_back(T *p_first, T *p_last) noexcept
+	{
+		if constexpr (std::is_floating_point_v<T>)
+		{
+			T *result(p_first);
+			for (T *iter(p_first); iter != p_last; ++iter)
+			{
+				const T value(*iter);
+				*iter = *result;
+				*result = value;
+				result += value == value;
+			}
+			return result;
+		}
+		else
+			return p_last;
+	}
+
+	struct ScalarKernel
+	{
+		static constexpr std::ptrdiff_t small_size = dsaa::detail::introsort_threshold;
+
+		template <bool Inclusive, typename T>
+		static T *partition(T *p_first, T *p_last, T p_pivot) noexcept { return scalar_partition<Inclusive>(p_first, p_last, p_pivot); }
+
+		template <typename T>
+		static void small_sort(T *p_first, T *p_last) { dsaa::insertion_sort(p_first, p_last, std::less<T>()); }
+	};
+
+	template <typename Kernel, typename T>
+	void simd_introsort_loop(T *p_first, T *p_last, size_t p_depth_limit)
+	{
+		while (Kernel::small_size < p_last - p_first)
+		{
+			if (!p_depth_limit)
+			{
+				// Heap sort.
+				dsaa::detail::introsort_loop(p_first, p_last, 0, std::less<T>());
+				return;
+			}
+			--p_depth_limit;
+
+			const T pivot(choose_pivot(p_first, p_last));
+			T *cut(Kernel::template partition<false>(p_first, p_last, pivot));
+			if (cut == p_first)
+			{
+				// Nothing is less than the pivot, so the elements equal to it are in place.
+				p_first = Kernel::template partition<true>(p_first, p_last, pivot);
+				continue;
+			}
+			if (cut - p_first < p_last - cut)
+			{
+				simd_introsort_loop<Kernel>(p_first, cut, p_depth_limit);
+				p_first = cut;
+			}
+			else
+			{
+				simd_introsort_loop<Kernel>(cut, p_last, p_depth_limit);
+				p_last = cut;
+			}
+		}
+		Kernel::small_sort(p_first, p_last);
+	}
+
+#if defined(DSAA_SIMD_SORT_AVX2)
+	// One layer of a sorting network on a vector: every lane is compared with its partner lane,
+	// the lower lane of a pair keeps the minimum and the upper one the maximum. Indices are in 32-bit lanes.
+	struct NetworkLayer
+	{
+		alignas(32) int32_t partners[8]{};
+		alignas(32) int32_t max_lanes[8]{};
+	};
+
+	struct Avx2Tables
+	{
+		// Lane indices moving the elements selected by a mask to the front, in order, and the others behind them.
+		alignas(32) int32_t compress8[256][8]{};
+		alignas(32) int32_t compress4[16][8]{};
+		alignas(32) int32_t iota[8]{};
+		// Bitonic sort of one vector, the merge of a bitonic vector, and the reversal of a vector, for 8 and 4 elements.
+		NetworkLayer sort8[6]{};
+		NetworkLayer merge8[3]{};
+		NetworkLayer reverse8{};
+		NetworkLayer sort4[3]{};
+		NetworkLayer merge4[2]{};
+		NetworkLayer reverse4{};
+	};
+
+	constexpr NetworkLayer make_layer(std::array<int32_t, 8> p_partners, int32_t p_elements) noexcept
+	{
+		NetworkLayer layer{};
+		const int32_t width(8 / p_elements);
+		for (int32_t element(0); element != p_elements; ++element)
+			for (int32_t lane(0); lane != width; ++lane)
+			{
+				layer.partners[element * width + lane] = p_partners[element] * width + lane;
+				layer.max_lanes[element * width + lane] = p_partners[element] < element ? -1 : 0;
+			}
+		return layer;
+	}
+
+	constexpr void make_compress(int32_t (&p_table)[8], int32_t p_mask, int32_t p_elements) noexcept
+	{
+		const int32_t width(8 / p_elements);
+		int32_t lane(0);
+		for (int32_t selected(1); 0 <= selected; --selected)
+			for (int32_t element(0); element != p_elements; ++element)
+				if (((p_mask >> element) & 1) == selected)
+					for (int32_t part(0); part != width; ++part)
+						p_table[lane++] = element * width + part;
+	}
+
+	constexpr Avx2Tables make_avx2_tables() noexcept
+	{
+		Avx2Tables tables{};
+		for (int32_t mask(0); mask != 256; ++mask)
+			make_compress(tables.compress8[mask], mask, 8);
+		for (int32_t mask(0); mask != 16; ++mask)
+			make_compress(tables.compress4[mask], mask, 4);
+		for (int32_t lane(0); lane != 8; ++lane)
+			tables.iota[lane] = lane;
+
+		tables.sort8[0] = make_layer({1, 0, 3, 2, 5, 4, 7, 6}, 8);
+		tables.sort8[1] = make_layer({3, 2, 1, 0, 7, 6, 5, 4}, 8);
+		tables.sort8[2] = make_layer({1, 0, 3, 2, 5, 4, 7, 6}, 8);
+		tables.sort8[3] = make_layer({7, 6, 5, 4, 3, 2, 1, 0}, 8);
+		tables.sort8[4] = make_layer({2, 3, 0, 1, 6, 7, 4, 5}, 8);
+		tables.sort8[5] = make_layer({1, 0, 3, 2, 5, 4, 7, 6}, 8);
+		tables.merge8[0] = make_layer({4, 5, 6, 7, 0, 1, 2, 3}, 8);
+		tables.merge8[1] = make_layer({2, 3, 0, 1, 6, 7, 4, 5}, 8);
+		tables.merge8[2] = make_layer({1, 0, 3, 2, 5, 4, 7, 6}, 8);
+		tables.reverse8 = make_layer({7, 6, 5, 4, 3, 2, 1, 0}, 8);
+
+		tables.sort4[0] = make_layer({1, 0, 3, 2}, 4);
+		tables.sort4[1] = make_layer({3, 2, 1, 0}, 4);
+		tables.sort4[2] = make_layer({1, 0, 3, 2}, 4);
+		tables.merge4[0] = make_layer({2, 3, 0, 1}, 4);
+		tables.merge4[1] = make_layer({1, 0, 3, 2}, 4);
+		tables.reverse4 = make_layer({3, 2, 1, 0}, 4);
+		return tables;
+	}
+
+	constexpr Avx2Tables avx2_tables(make_avx2_tables());
+
+	DSAA_TARGET_AVX2 inline __m256i load(const void *p_source) noexcept
+	{
+		return _mm256_loadu_si256(static_cast<const __m256i *>(p_source));
+	}
+
+	DSAA_TARGET_AVX2 inline void store(void *p_destination, __m256i p_vector) noexcept
+	{
+		_mm256_storeu_si256(static_cast<__m256i *>(p_destination), p_vector);
+	}
+
+	// Comparisons and min/max of the element types, on vectors seen as 32-bit lanes.
+	template <typename T>
+	struct Avx2Ops;
+
+	template <>
+	struct Avx2Ops<int32_t>
+	{
+		static constexpr std::ptrdiff_t elements = 8;
+
+		DSAA_TARGET_AVX2 static __m256i set1(int32_t p_value) noexcept { return _mm256_set1_epi32(p_value); }
+		template <bool Inclusive>
+		DSAA_TARGET_AVX2 static int left_mask(__m256i p_vector, __m256i p_pivot) noexcept
+		{
+			if (Inclusive)
+				return ~_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(p_vector, p_pivot))) & 0xFF;
+			return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(p_pivot, p_vector)));
+		}
+		DSAA_TARGET_AVX2 static __m256i min(__m256i p_lhs, __m256i p_rhs) noexcept { return _mm256_min_epi32(p_lhs, p_rhs); }
+		DSAA_TARGET_AVX2 static __m256i max(__m256i p_lhs, __m256i p_rhs) noexcept { return _mm256_max_epi32(p_lhs, p_rhs); }
+	};
+
+	template <>
+	struct Avx2Ops<float>
+	{
+		static constexpr std::ptrdiff_t elements = 8;
+
+		DSAA_TARGET_AVX2 static __m256i set1(float p_value) noexcept { return _mm256_castps_si256(_mm256_set1_ps(p_value)); }
+		template <bool Inclusive>
+		DSAA_TARGET_AVX2 static int left_mask(__m256i p_vector, __m256i p_pivot) noexcept
+		{
+			const __m256 vector(_mm256_castsi256_ps(p_vector)), pivot(_mm256_castsi256_ps(p_pivot));
+			if (Inclusive)
+				return ~_mm256_movemask_ps(_mm256_cmp_ps(pivot, vector, _CMP_LT_OQ)) & 0xFF;
+			return _mm256_movemask_ps(_mm256_cmp_ps(vector, pivot, _CMP_LT_OQ));
+		}
+		DSAA_TARGET_AVX2 static __m256i min(__m256i p_lhs, __m256i p_rhs) noexcept
+		{
+			return _mm256_castps_si256(_mm256_min_ps(_mm256_castsi256_ps(p_lhs), _mm256_castsi256_ps(p_rhs)));
+		}
+		DSAA_TARGET_AVX2 static __m256i max(__m256i p_lhs, __m256i p_rhs) noexcept
+		{
+			return _mm256_castps_si256(_mm256_max_ps(_mm256_castsi256_ps(p_lhs), _mm256_castsi256_ps(p_rhs)));
+		}
+	};
+
+	template <>
+	struct Avx2Ops<int64_t>
+	{
+		static constexpr std::ptrdiff_t elements = 4;
+
+		DSAA_TARGET_AVX2 static __m256i set1(int64_t p_value) noexcept { return _mm256_set1_epi64x(p_value); }
+		template <bool Inclusive>
+		DSAA_TARGET_AVX2 static int left_mask(__m256i p_vector, __m256i p_pivot) noexcept
+		{
+			if (Inclusive)
+				return ~_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(p_vector, p_pivot))) & 0xF;
+			return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(p_pivot, p_vector)));
+		}
+		// AVX2 has no 64-bit min and max, blend on the comparison instead.
+		DSAA_TARGET_AVX2 static __m256i min(__m256i p_lhs, __m256i p_rhs) noexcept
+		{
+			return _mm256_blendv_epi8(p_lhs, p_rhs, _mm256_cmpgt_epi64(p_lhs, p_rhs));
+		}
+		DSAA_TARGET_AVX2 static __m256i max(__m256i p_lhs, __m256i p_rhs) noexcept
+		{
+			return _mm256_blendv_epi8(p_rhs, p_lhs, _mm256_cmpgt_epi64(p_lhs, p_rhs));
+		}
+	};
+
+	template <>
+	struct Avx2Ops<double>
+	{
+		static constexpr std::ptrdiff_t elements = 4;
+
+		DSAA_TARGET_AVX2 static __m256i set1(double p_value) noexcept { return _mm256_castpd_si256(_mm256_set1_pd(p_value)); }
+		template <bool Inclusive>
+		DSAA_TARGET_AVX2 static int left_mask(__m256i p_vector, __m256i p_pivot) noexcept
+		{
+			const __m256d vector(_mm256_castsi256_pd(p_vector)), pivot(_mm256_castsi256_pd(p_pivot));
+			if (Inclusive)
+				return ~_mm256_movemask_pd(_mm256_cmp_pd(pivot, vector, _CMP_LT_OQ)) & 0xF;
+			return _mm256_movemask_pd(_mm256_cmp_pd(vector, pivot, _CMP_LT_OQ));
+		}
+		DSAA_TARGET_AVX2 static __m256i min(__m256i p_lhs, __m256i p_rhs) noexcept
+		{
+			return _mm256_castpd_si256(_mm256_min_pd(_mm256_castsi256_pd(p_lhs), _mm256_castsi256_pd(p_rhs)));
+		}
+		DSAA_TARGET_AVX2 static __m256i max(__m256i p_lhs, __m256i p_rhs) noexcept
+		{
+			return _mm256_castpd_si256(_mm256_max_pd(_mm256_castsi256_pd(p_lhs), _mm256_castsi256_pd(p_rhs)));
+		}
+	};
+
+	template <typename T>
+	struct Avx2Kernel
+	{
+		using Ops = Avx2Ops<T>;
+		static constexpr std::ptrdiff_t lanes = Ops::elements;
+		static constexpr std::ptrdiff_t small_size = 2 * lanes;
+
+		// Vector quicksort partition: vectors are read from whichever end has less free room and every one is split
+		// by a single permutation, its left elements stored at the front and its right elements at the back.
+		template <bool Inclusive>
+		DSAA_TARGET_AVX2 static T *partition(T *p_first, T *p_last, T p_pivot) noexcept
+		{
+			if (p_last - p_first < 2 * lanes)
+				return scalar_partition<Inclusive>(p_first, p_last, p_pivot);
+
+			const __m256i pivot(Ops::set1(p_pivot));
+			// The two outer vectors wait in registers, so both ends always have room for a full store.
+			const __m256i first_vector(load(p_first)), last_vector(load(p_last - lanes));
+			T *read_left(p_first + lanes), *read_right(p_last - lanes);
+			T *write_left(p_first), *write_right(p_last);
+			while (lanes <= read_right - read_left)
+			{
+				__m256i vector;
+				if (read_left - write_left <= write_right - read_right)
+				{
+					vector = load(read_left);
+					read_left += lanes;
+				}
+				else
+				{
+					read_right -= lanes;
+					vector = load(read_right);
+				}
+				const int mask(Ops::template left_mask<Inclusive>(vector, pivot));
+				const __m256i compressed(compress(vector, mask));
+				const std::ptrdiff_t count(__builtin_popcount(static_cast<unsigned>(mask)));
+				store(write_left, compressed);
+				store(write_right - lanes, compressed);
+				write_left += count;
+				write_right -= lanes - count;
+			}
+
+			// Once the last few elements are read, [write_left, write_right) is a single gap.
+			T tail[lanes];
+			const std::ptrdiff_t tail_size(read_right - read_left);
+			std::copy(read_left, read_right, tail);
+			for (std::ptrdiff_t i(0); i != tail_size; ++i)
+			{
+				if (goes_left<Inclusive>(tail[i], p_pivot))
+					*write_left++ = tail[i];
+				else
+					*--write_right = tail[i];
+			}
+			// The gap is as large as the two vectors now, so stores must not spill over.
+			masked_partition_store<Inclusive>(first_vector, pivot, write_left, write_right);
+			masked_partition_store<Inclusive>(last_vector, pivot, write_left, write_right);
+			return write_left;
+		}
+
+		// Sorts up to two vectors of elements in registers.
+		DSAA_TARGET_AVX2 static void small_sort(T *p_first, T *p_last) noexcept
+		{
+			const std::ptrdiff_t size(p_last - p_first);
+			if (size < 2)
+				return;
+			alignas(32) T block[2 * lanes];
+			std::fill(block, block + 2 * lanes, std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity() : std::numeric_limits<T>::max());
+			std::copy(p_first, p_last, block);
+
+			__m256i low(sort_vector(load(block)));
+			if (lanes < size)
+			{
+				// Both sorted vectors form a bitonic sequence with the second one reversed, its halves are merged apart.
+				__m256i high(_mm256_permutevar8x32_epi32(sort_vector(load(block + lanes)), load(reverse_layer().partners)));
+				const __m256i minimum(Ops::min(low, high));
+				high = merge_vector(Ops::max(low, high));
+				low = merge_vector(minimum);
+				store(block + lanes, high);
+			}
+			store(block, low);
+			std::copy(block, block + size, p_first);
+		}
+
+	private:
+		DSAA_TARGET_AVX2 static __m256i compress(__m256i p_vector, int p_mask) noexcept
+		{
+			if constexpr (lanes == 8)
+				return _mm256_permutevar8x32_epi32(p_vector, load(avx2_tables.compress8[p_mask]));
+			else
+				return _mm256_permutevar8x32_epi32(p_vector, load(avx2_tables.compress4[p_mask]));
+		}
+
+		template <bool Inclusive>
+		DSAA_TARGET_AVX2 static void masked_partition_store(__m256i p_vector, __m256i p_pivot, T *&p_write_left, T *&p_write_right) noexcept
+		{
+			const int mask(Ops::template left_mask<Inclusive>(p_vector, p_pivot));
+			const __m256i compressed(compress(p_vector, mask));
+			const int count(__builtin_popcount(static_cast<unsigned>(mask)));
+			const __m256i left_lanes(_mm256_cmpgt_epi32(_mm256_set1_epi32(count * static_cast<int>(8 / lanes)), load(avx2_tables.iota)));
+			_mm256_maskstore_epi32(reinterpret_cast<int *>(p_write_left), left_lanes, compressed);
+			_mm256_maskstore_epi32(reinterpret_cast<int *>(p_write_right - lanes), _mm256_xor_si256(left_lanes, _mm256_set1_epi32(-1)), compressed);
+			p_write_left += count;
+			p_write_right -= lanes - count;
+		}
+
+		DSAA_TARGET_AVX2 static __m256i apply(__m256i p_vector, const NetworkLayer &p_layer) noexcept
+		{
+			const __m256i partner(_mm256_permutevar8x32_epi32(p_vector, load(p_layer.partners)));
+			return _mm256_blendv_epi8(Ops::min(p_vector, partner), Ops::max(p_vector, partner), load(p_layer.max_lanes));
+		}
+
+		static const NetworkLayer &reverse_layer() noexcept { return lanes == 8 ? avx2_tables.reverse8 : avx2_tables.reverse4; }
+
+		DSAA_TARGET_AVX2 static __m256i sort_vector(__m256i p_vector) noexcept
+		{
+			if constexpr (lanes == 8)
+			{
+				for (const NetworkLayer &layer : avx2_tables.sort8)
+					p_vector = apply(p_vector, layer);
+			}
+			else
+			{
+				for (const NetworkLayer &layer : avx2_tables.sort4)
+					p_vector = apply(p_vector, layer);
+			}
+			return p_vector;
+		}
+
+		DSAA_TARGET_AVX2 static __m256i merge_vector(__m256i p_vector) noexcept
+		{
+			if constexpr (lanes == 8)
+			{
+				for (const NetworkLayer &layer : avx2_tables.merge8)
+					p_vector = apply(p_vector, layer);
+			}
+			else
+			{
+				for (const NetworkLayer &layer : avx2_tables.merge4)
+					p_vector = apply(p_vector, layer);
+			}
+			return p_vector;
+		}
+	};
+#endif // DSAA_SIMD_SORT_AVX2
+}
+
+bool dsaa::simd_sort_uses_avx2() noexcept
+{
+#if defined(DSAA_SIMD_SORT_AVX2)
+	static const bool supported(__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt"));
+	return supported;
+#else
+	return false;
+#endif
+}
+
+template <typename T>
+void dsaa::detail::simd_sort(T *p_first, T *p_last)
+{
+#if defined(DSAA_SIMD_SORT_AVX2)
+	if (simd_sort_uses_avx2())
+	{
+		p_last = move_nans_back(p_first, p_last);
+		simd_introsort_loop<Avx2Kernel<T>>(p_first, p_last, introsort_depth_limit(p_last - p_first));
+		return;
+	}
+#endif
+	scalar_simd_sort(p_first, p_last);
+}
+
+template <typename T>
+void dsaa::detail::scalar_simd_sort(T *p_first, T *p_last)
+{
+	p_last = move_nans_back(p_first, p_last);
+	simd_introsort_loop<ScalarKernel>(p_first, p_last, introsort_depth_limit(p_last - p_first));
+}
+
+template void dsaa::detail::simd_sort<int32_t>(int32_t *, int32_t *);
+template void dsaa::detail::simd_sort<int64_t>(int64_t *, int64_t *);
+template void dsaa::detail::simd_sort<float>(float *, float *);
+template void dsaa::detail::simd_sort<double>(double *, double *);
+template void dsaa::detail::scalar_simd_sort<int32_t>(int32_t *, int32_t *);
+template void dsaa::detail::scalar_simd_sort<int64_t>(int64_t *, int64_t *);
+template void dsaa::detail::scalar_simd_sort<float>(float *, float *);
+template void dsaa::detail::scalar_simd_sort<double>(double *, double *);
@@ -0,0 +1,50 @@
+#ifndef DSAA_SIMD_SORT_H
+#define DSAA_SIMD_SORT_H
+
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+#include "dsaaTypedefs.h"
+
+namespace dsaa
+{
+	// Returns whether simd_sort runs its AVX2 kernels on this processor.
+	NODISCARD bool simd_sort_uses_avx2() noexcept;
+
+	// Sorts a contiguous range of int32_t, int64_t, float or double in ascending order. Not stable.
+	// Introsort whose partition and small range sort are AVX2 kernels when the processor has them: a compressing vector
+	// partition and an in-register bitonic sorting network. Otherwise a branchless scalar partition and insertion sort are used.
+	// NaNs are moved behind every other value by a scalar pass first, in unspecified order; only the rest is sorted.
+	template <typename CIterator>
+	CIterator simd_sort(CIterator p_first, CIterator p_last);
+
+	namespace detail
+	{
+		// Defined for int32_t, int64_t, float and double.
+		template <typename T>
+		void simd_sort(T *p_first, T *p_last);
+		// The portable kernel simd_sort falls back to, defined for the same types.
+		template <typename T>
+		void scalar_simd_sort(T *p_first, T *p_last);
+	}
+}
+
+template <typename CIterator>
+CIterator dsaa::simd_sort(CIterator p_first, CIterator p_last)
+{
+	using value_type = typename std::iterator_traits<CIterator>::value_type;
+	static_assert(std::contiguous_iterator<CIterator>, "simd_sort needs contiguous iterators.");
+	static_assert(std::is_same_v<value_type, int32_t> || std::is_same_v<value_type, int64_t> || std::is_same_v<value_type, float> || std::is_same_v<value_type, double>,
+				  "simd_sort sorts int32_t, int64_t, float or double.");
+
+	if (p_first != p_last)
+	{
+		value_type *first(std::to_address(p_first));
+		detail::simd_sort(first, first + (p_last - p_first));
+	}
+	return p_last;
+}
+
+#endif // !DSAA_SIMD_SORT_H
@@ -6,9 +6,15 @@
 #include <algorithm>
 #include <iterator>
 #include <stdexcept>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
 
 #include "Generic.h"
 #include "Heap.h"
+#include "arrays/SmallDynamicArray.h"
 
 namespace dsaa
 {
@@ -24,9 +30,28 @@ namespace dsaa
 	template <typename BIterator, typename Compare = std::less<typename std::iterator_traits<BIterator>::value_type>>
 	BIterator insertion_sort(BIterator p_first, BIterator p_last, Compare p_compare = Compare());
 
+	// Stable merge sort. Allocates one scratch buffer for the whole sort.
 	template <typename RIterator, typename Compare = std::less<typename std::iterator_traits<RIterator>::value_type>>
 	RIterator merge_sort(RIterator p_first, RIterator p_last, Compare p_compare = Compare());
 
+	// Stable top-down merge sort using p_buffer, which must hold p_last - p_first elements, as scratch space.
+	// Levels alternate between the range and the buffer, so every element is moved once per level.
+	template <typename RIterator, typename BufferIterator, typename Compare = std::less<typename std::iterator_traits<RIterator>::value_type>>
+	RIterator buffered_merge_sort(RIterator p_first, RIterator p_last, BufferIterator p_buffer, Compare p_compare = Compare());
+
+	// Stable iterative merge sort: runs of insertion sorted elements are merged pairwise, doubling their width on every pass.
+	template <typename RIterator, typename Compare = std::less<typename std::iterator_traits<RIterator>::value_type>>
+	RIterator bottom_up_merge_sort(RIterator p_first, RIterator p_last, Compare p_compare = Compare());
+
+	// bottom_up_merge_sort using p_buffer, which must hold p_last - p_first elements, as scratch space.
+	template <typename RIterator, typename BufferIterator, typename Compare = std::less<typename std::iterator_traits<RIterator>::value_type>>
+	RIterator buffered_bottom_up_merge_sort(RIterator p_first, RIterator p_last, BufferIterator p_buffer, Compare p_compare = Compare());
+
+	// Stable adaptive merge sort after TimSort: natural runs, descending ones reversed, are extended to a minimum length
+	// by binary insertion and merged with galloping, keeping the run stack invariant. O(n) on sorted input, O(n log n) at worst.
+	template <typename RIterator, typename Compare = std::less<typename std::iterator_traits<RIterator>::value_type>>
+	RIterator tim_sort(RIterator p_first, RIterator p_last, Compare p_compare = Compare());
+
 	template <typename RIterator, typename Compare = std::greater_equal<typename std::iterator_traits<RIterator>::value_type>>
 	RIterator sort_heap(RIterator p_first, RIterator p_last, Compare p_compare = Compare());
 
@@ -54,6 +79,103 @@ namespace dsaa
 	template <typename RIterator, typename Compare = std::less<typename std::iterator_traits<RIterator>::value_type>>
 	RIterator randomized_tail_hoare_quick_sort(RIterator p_first, RIterator p_last, Compare p_compare = Compare());
 
+	// Introsort: quicksort with median-of-3 (ninther on large ranges) pivots, switching to heap sort when the
+	// recursion gets too deep and to insertion sort on small ranges. O(n log n) in the worst case, not stable.
+	template <typename RIterator, typename Compare = std::less<typename std::iterator_traits<RIterator>::value_type>>
+	RIterator sort(RIterator p_first, RIterator p_last, Compare p_compare = Compare());
+
+	namespace detail
+	{
+		// Runs up to this size are insertion sorted by the merge sorts.
+		inline constexpr std::ptrdiff_t merge_sort_run = 16;
+
+		// Returns scratch space for p_last - p_first elements, left uninitialized when the type allows it.
+		template <typename RIterator>
+		NODISCARD DynamicArray<typename std::iterator_traits<RIterator>::value_type> make_sort_buffer(RIterator p_first, RIterator p_last);
+
+		// Stable merge of the sorted ranges [p_first1, p_last1) and [p_first2, p_last2), moving the elements to p_result.
+		template <typename IIterator1, typename IIterator2, typename OIterator, typename Compare>
+		OIterator move_merge(IIterator1 p_first1, IIterator1 p_last1, IIterator2 p_first2, IIterator2 p_last2, OIterator p_result, Compare p_compare);
+
+		// Sorts [p_first, p_last) in place, using p_buffer as scratch space.
+		template <typename RIterator, typename BufferIterator, typename Compare>
+		void merge_sort_in_place(RIterator p_first, RIterator p_last, BufferIterator p_buffer, Compare p_compare);
+		// Sorts [p_first, p_last) into p_buffer, using the range itself as scratch space.
+		template <typename RIterator, typename BufferIterator, typename Compare>
+		void merge_sort_to_buffer(RIterator p_first, RIterator p_last, BufferIterator p_buffer, Compare p_compare);
+		// Merges pairs of sorted runs of p_width elements from [p_first, p_last) to p_result.
+		template <typename RIterator, typename OIterator, typename Compare>
+		void merge_runs(RIterator p_first, RIterator p_last, OIterator p_result, std::ptrdiff_t p_width, Compare p_compare);
+
+		// Inputs up to this size are sorted by a single binary insertion sort in tim_sort.
+		inline constexpr std::ptrdiff_t tim_sort_min_merge = 64;
+		// Number of consecutive wins of one run after which tim_sort starts galloping.
+		inline constexpr std::ptrdiff_t tim_sort_min_gallop = 7;
+
+		// Returns the length of the run starting at p_first, reversing it when it is strictly descending.
+		template <typename RIterator, typename Compare>
+		std::ptrdiff_t count_run_and_make_ascending(RIterator p_first, RIterator p_last, Compare p_compare);
+		// Inserts every element of [p_start, p_last) into the sorted range [p_first, p_start) by binary search.
+		template <typename RIterator, typename Compare>
+		void binary_insertion_sort(RIterator p_first, RIterator p_start, RIterator p_last, Compare p_compare);
+		// Returns the length of the prefix of the sorted range [p_first, p_first + p_size) whose elements satisfy p_predicate,
+		// searching exponentially from the start, then binary.
+		template <typename RIterator, typename Predicate>
+		std::ptrdiff_t gallop(RIterator p_first, std::ptrdiff_t p_size, Predicate p_predicate);
+		// Merges the run moved to [p_buffer_first, p_buffer_last) with [p_first, p_last) into the elements before p_first.
+		// The first run wins ties. Galloping starts after p_min_gallop consecutive wins, which is adapted to the input.
+		template <typename BufferIterator, typename RIterator, typename Compare>
+		void gallop_merge(BufferIterator p_buffer_first, BufferIterator p_buffer_last, RIterator p_first, RIterator p_last, Compare p_compare, std::ptrdiff_t &p_min_gallop);
+
+		// Ranges up to this size are finished by insertion sort.
+		inline constexpr std::ptrdiff_t introsort_threshold = 16;
+		// Ranges larger than this use the ninther instead of the median of 3.
+		inline constexpr std::ptrdiff_t ninther_threshold = 128;
+
+		template <typename RIterator, typename Compare>
+		void move_median_to_first(RIterator p_result, RIterator p_a, RIterator p_b, RIterator p_c, Compare p_compare);
+
+		// Picks the pivot of [p_first, p_last) and partitions around it, returns where the right side starts.
+		template <typename RIterator, typename Compare>
+		RIterator introsort_partition(RIterator p_first, RIterator p_last, Compare p_compare);
+
+		template <typename RIterator, typename Compare>
+		void introsort_loop(RIterator p_first, RIterator p_last, size_t p_depth_limit, Compare p_compare);
+
+		// Returns the depth limit introsort allows for p_size elements.
+		NODISCARD inline size_t introsort_depth_limit(std::ptrdiff_t p_size) noexcept
+		{
+			size_t result(0);
+			for (; 1 < p_size; p_size >>= 1)
+				result += 2;
+			return result;
+		}
+	}
+
+	// Rearranges [p_first, p_last) so that p_nth holds the element a full sort would put there, with no greater element
+	// before it and no smaller one after it. Introselect: partitions like sort but keeps only the side holding p_nth,
+	// switching to a heap selection when the pivots keep being bad. O(n) on average, O(n log n) at worst. Returns p_nth.
+	template <typename RIterator, typename Compare = std::less<typename std::iterator_traits<RIterator>::value_type>>
+	RIterator nth_element(RIterator p_first, RIterator p_nth, RIterator p_last, Compare p_compare = Compare());
+
+	// Puts the p_middle - p_first smallest elements, sorted, in [p_first, p_middle). The others are left in unspecified order.
+	// Heap selection with build_heap and heapify, then sort_heap: O(n log k) for k = p_middle - p_first. Returns p_middle.
+	template <typename RIterator, typename Compare = std::less<typename std::iterator_traits<RIterator>::value_type>>
+	RIterator partial_sort(RIterator p_first, RIterator p_middle, RIterator p_last, Compare p_compare = Compare());
+
+	// Returns the p_k greatest elements of [p_first, p_last), the greatest first, reading the range once. The best elements
+	// seen so far are kept in a min-heap of at most p_k elements, ordered by p_compare through build_heap and heapify,
+	// whose minimum is replaced by every better element. O(n log k) time and O(k) memory.
+	template <typename IIterator, typename Compare = std::less<typename std::iterator_traits<IIterator>::value_type>>
+	DynamicArray<typename std::iterator_traits<IIterator>::value_type> top_k(IIterator p_first, IIterator p_last, size_t p_k, Compare p_compare = Compare());
+
+	namespace detail
+	{
+		// Moves the p_middle - p_first smallest elements to [p_first, p_middle), as a heap whose first element is the greatest of them.
+		template <typename RIterator, typename Compare>
+		void heap_select(RIterator p_first, RIterator p_middle, RIterator p_last, Compare p_compare);
+	}
+
 	// Produces a sorted array.
 	// IntType The type of element in array. The effect is undefined if this is not one of
 	// short, int, long, long long, unsigned short, unsigned int, unsigned long, or unsigned long long.
@@ -66,7 +188,54 @@ namespace dsaa
 	template <typename RIterator, typename Compare = std::less<typename std::iterator_traits<RIterator>::value_type>, typename IntType = typename std::iterator_traits<RIterator>::value_type>
 	RIterator radix_sort(RIterator p_first, RIterator p_last, Compare p_compare = Compare(), IntType p_min = std::numeric_limits<IntType>::min(), IntType p_max = std::numeric_limits<IntType>::max(), int32_t p_base = 10);
 
-	// Produces a sorted array on input [0:1].
+	// Returns its argument, the default key of lsd_radix_sort.
+	struct identity_key
+	{
+		template <typename Elem>
+		CONSTEXPR const Elem &operator()(const Elem &p_elem) const noexcept { return p_elem; }
+	};
+
+	// Stable LSD radix sort in ascending order of p_key(element), which must be an integer of any width, float or double.
+	// Keys are mapped to unsigned integers keeping their order, signed ones by flipping the sign bit, floating point ones
+	// by flipping every bit of negatives, and sorted DigitBits bits per pass, moving elements between the range and one buffer.
+	// Passes in which every key has the same digit are skipped.
+	// DigitBits trades passes for the size of the counting tables: 8, 11 and 16 suit most keys.
+	template <size_t DigitBits = 8, typename RIterator, typename KeyExtractor = identity_key>
+	RIterator lsd_radix_sort(RIterator p_first, RIterator p_last, KeyExtractor p_key = KeyExtractor());
+
+	namespace detail
+	{
+		// Ranges up to this size are insertion sorted by lsd_radix_sort.
+		inline constexpr std::ptrdiff_t radix_sort_threshold = 64;
+
+		// Maps p_key to an unsigned integer of the same width with the same order.
+		template <typename Key>
+		NODISCARD auto radix_unsigned_key(Key p_key) noexcept;
+	}
+
+	// Sorts [p_first, p_last) in ascending order of p_key(element), calling p_key once per element (Schwartzian transform). Stable.
+	// The keys are cached with the index of their element and these pairs are sorted, by lsd_radix_sort when the key is
+	// an integer and p_compare is std::less, by merge_sort otherwise. The elements are then permuted in place by following
+	// the cycles of the permutation, so every element is moved once. Worth it when p_key costs more than moving an element.
+	template <typename RIterator, typename KeyExtractor, typename Compare = std::less<std::decay_t<std::invoke_result_t<KeyExtractor &, const typename std::iterator_traits<RIterator>::value_type &>>>>
+	RIterator sort_by_key(RIterator p_first, RIterator p_last, KeyExtractor p_key, Compare p_compare = Compare());
+
+	namespace detail
+	{
+		// A cached sort_by_key key and the index of its element.
+		template <typename Key>
+		struct KeyIndex
+		{
+			Key key{};
+			size_t index = 0;
+		};
+
+		// Moves the element at p_first[p_order[i].index] to p_first[i] for every i, following the cycles of the permutation.
+		template <typename RIterator, typename Key>
+		void apply_key_order(RIterator p_first, DynamicArray<KeyIndex<Key>> &p_order);
+	}
+
+	// Produces a sorted array on input [0:1]. See bucket_sort in ParallelSort.h for other distributions.
 	// RealType The type of element in array. The effect is undefined if this is not one of
 	// float , double, long double.
 	template <typename RIterator, typename Compare = std::less<typename std::iterator_traits<RIterator>::value_type>, typename RealType = typename std::iterator_traits<RIterator>::value_type>
@@ -99,7 +268,7 @@ FIterator dsaa::buble_sort(FIterator p_first, FIterator p_last, Compare p_compar
 		for (; k != p_last; ++k)
 		{
 			if (p_compare(*k, *p_first))
-				std::swap(*k, *p_first);
+				std::iter_swap(k, p_first);
 		}
 		++p_first;
 	}
@@ -120,7 +289,7 @@ FIterator dsaa::selection_sort(FIterator p_first, FIterator p_last, Compare p_co
 				key = k;
 		}
 		if (key != p_first)
-			std::swap(*key, *p_first);
+			std::iter_swap(key, p_first);
 		++p_first;
 	}
 	return p_first;
@@ -154,8 +323,8 @@ BIterator dsaa::insertion_sort(BIterator p_first, BIterator p_last, Compare p_co
 		}
 		if (succ_index == p_first) // Nothing happened.
 			continue;
-		if (index != p_first)
-			*(++index) = key; // Offset for the last --index;
+		if (index != p_first || !p_compare(key, *index))
+			*(++index) = key; // Offset for the last --index, or key stopped right after the begining.
 		else
 			*(index) = key; // We met the begining.
 	}
@@ -165,15 +334,354 @@ BIterator dsaa::insertion_sort(BIterator p_first, BIterator p_last, Compare p_co
 template <typename RIterator, typename Compare>
 RIterator dsaa::merge_sort(RIterator p_first, RIterator p_last, Compare p_compare)
 {
-	if (p_first == p_last)
-		return p_first;
+	if (p_last - p_first <= dsaa::detail::merge_sort_run)
+	{
+		dsaa::insertion_sort(p_first, p_last, p_compare);
+		return p_last;
+	}
+	auto buffer(dsaa::detail::make_sort_buffer(p_first, p_last));
+	return dsaa::buffered_merge_sort(p_first, p_last, buffer.begin(), p_compare);
+}
 
-	if (p_first < p_last - 1)
+template <typename RIterator, typename BufferIterator, typename Compare>
+RIterator dsaa::buffered_merge_sort(RIterator p_first, RIterator p_last, BufferIterator p_buffer, Compare p_compare)
+{
+	dsaa::detail::merge_sort_in_place(p_first, p_last, p_buffer, p_compare);
+	return p_last;
+}
+
+template <typename RIterator, typename Compare>
+RIterator dsaa::bottom_up_merge_sort(RIterator p_first, RIterator p_last, Compare p_compare)
+{
+	if (p_last - p_first <= dsaa::detail::merge_sort_run)
+	{
+		dsaa::insertion_sort(p_first, p_last, p_compare);
+		return p_last;
+	}
+	auto buffer(dsaa::detail::make_sort_buffer(p_first, p_last));
+	return dsaa::buffered_bottom_up_merge_sort(p_first, p_last, buffer.begin(), p_compare);
+}
+
+template <typename RIterator, typename BufferIterator, typename Compare>
+RIterator dsaa::buffered_bottom_up_merge_sort(RIterator p_first, RIterator p_last, BufferIterator p_buffer, Compare p_compare)
+{
+	const std::ptrdiff_t size(p_last - p_first);
+	for (RIterator run(p_first); run != p_last;)
+	{
+		RIterator run_last(p_last - run <= dsaa::detail::merge_sort_run ? p_last : run + dsaa::detail::merge_sort_run);
+		dsaa::insertion_sort(run, run_last, p_compare);
+		run = run_last;
+	}
+
+	// Every pass moves all elements once, between the range and the buffer.
+	bool in_buffer(false);
+	for (std::ptrdiff_t width(dsaa::detail::merge_sort_run); width < size; width *= 2)
 	{
-		RIterator mid_index(p_first + (p_last - p_first) / 2);
-		merge_sort(p_first, mid_index, p_compare);
-		merge_sort(mid_index, p_last, p_compare);
-		merge(p_first, mid_index, p_last, p_compare);
+		if (in_buffer)
+			dsaa::detail::merge_runs(p_buffer, p_buffer + size, p_first, width, p_compare);
+		else
+			dsaa::detail::merge_runs(p_first, p_last, p_buffer, width, p_compare);
+		in_buffer = !in_buffer;
+	}
+	if (in_buffer)
+		std::move(p_buffer, p_buffer + size, p_first);
+	return p_last;
+}
+
+template <typename RIterator>
+dsaa::DynamicArray<typename std::iterator_traits<RIterator>::value_type> dsaa::detail::make_sort_buffer(RIterator p_first, RIterator p_last)
+{
+	using value_type = typename std::iterator_traits<RIterator>::value_type;
+	if constexpr (std::is_default_constructible_v<value_type>)
+		return DynamicArray<value_type>(static_cast<size_t>(p_last - p_first), default_init);
+	else
+		return DynamicArray<value_type>(p_first, p_last);
+}
+
+template <typename IIterator1, typename IIterator2, typename OIterator, typename Compare>
+OIterator dsaa::detail::move_merge(IIterator1 p_first1, IIterator1 p_last1, IIterator2 p_first2, IIterator2 p_last2, OIterator p_result, Compare p_compare)
+{
+	while (p_first1 != p_last1 && p_first2 != p_last2)
+	{
+		// Ties are taken from the first range to keep the merge stable.
+		if (p_compare(*p_first2, *p_first1))
+			*p_result = std::move(*p_first2++);
+		else
+			*p_result = std::move(*p_first1++);
+		++p_result;
+	}
+	p_result = std::move(p_first1, p_last1, p_result);
+	return std::move(p_first2, p_last2, p_result);
+}
+
+template <typename RIterator, typename BufferIterator, typename Compare>
+void dsaa::detail::merge_sort_in_place(RIterator p_first, RIterator p_last, BufferIterator p_buffer, Compare p_compare)
+{
+	const std::ptrdiff_t size(p_last - p_first);
+	if (size <= merge_sort_run)
+	{
+		dsaa::insertion_sort(p_first, p_last, p_compare);
+		return;
+	}
+	// Both halves are sorted into the buffer and merged back.
+	const std::ptrdiff_t half(size / 2);
+	merge_sort_to_buffer(p_first, p_first + half, p_buffer, p_compare);
+	merge_sort_to_buffer(p_first + half, p_last, p_buffer + half, p_compare);
+	move_merge(p_buffer, p_buffer + half, p_buffer + half, p_buffer + size, p_first, p_compare);
+}
+
+template <typename RIterator, typename BufferIterator, typename Compare>
+void dsaa::detail::merge_sort_to_buffer(RIterator p_first, RIterator p_last, BufferIterator p_buffer, Compare p_compare)
+{
+	const std::ptrdiff_t size(p_last - p_first);
+	if (size <= merge_sort_run)
+	{
+		dsaa::insertion_sort(p_first, p_last, p_compare);
+		std::move(p_first, p_last, p_buffer);
+		return;
+	}
+	// Both halves are sorted in place and merged into the buffer.
+	const std::ptrdiff_t half(size / 2);
+	merge_sort_in_place(p_first, p_first + half, p_buffer, p_compare);
+	merge_sort_in_place(p_first + half, p_last, p_buffer + half, p_compare);
+	move_merge(p_first, p_first + half, p_first + half, p_last, p_buffer, p_compare);
+}
+
+template <typename RIterator, typename Compare>
+std::ptrdiff_t dsaa::detail::count_run_and_make_ascending(RIterator p_first, RIterator p_last, Compare p_compare)
+{
+	RIterator run_last(p_first + 1);
+	if (run_last == p_last)
+		return 1;
+	// Only strictly descending runs are reversed, so equal elements keep their order.
+	if (p_compare(*run_last, *p_first))
+	{
+		++run_last;
+		while (run_last != p_last && p_compare(*run_last, *(run_last - 1)))
+			++run_last;
+		std::reverse(p_first, run_last);
+	}
+	else
+	{
+		++run_last;
+		while (run_last != p_last && !p_compare(*run_last, *(run_last - 1)))
+			++run_last;
+	}
+	return run_last - p_first;
+}
+
+template <typename RIterator, typename Compare>
+void dsaa::detail::binary_insertion_sort(RIterator p_first, RIterator p_start, RIterator p_last, Compare p_compare)
+{
+	for (; p_start != p_last; ++p_start)
+	{
+		// After the equal elements, to stay stable.
+		RIterator position(std::upper_bound(p_first, p_start, *p_start, p_compare));
+		if (position == p_start)
+			continue;
+		auto pivot(std::move(*p_start));
+		std::move_backward(position, p_start, p_start + 1);
+		*position = std::move(pivot);
+	}
+}
+
+template <typename RIterator, typename Predicate>
+std::ptrdiff_t dsaa::detail::gallop(RIterator p_first, std::ptrdiff_t p_size, Predicate p_predicate)
+{
+	// p_predicate holds on [0, low), probe 1, 3, 7, ... elements ahead.
+	std::ptrdiff_t low(0), step(1);
+	while (low + step <= p_size && p_predicate(p_first[low + step - 1]))
+	{
+		low += step;
+		step *= 2;
+	}
+	const std::ptrdiff_t high(std::min(low + step - 1, p_size));
+	return std::partition_point(p_first + low, p_first + high, p_predicate) - p_first;
+}
+
+template <typename BufferIterator, typename RIterator, typename Compare>
+void dsaa::detail::gallop_merge(BufferIterator p_buffer_first, BufferIterator p_buffer_last, RIterator p_first, RIterator p_last, Compare p_compare, std::ptrdiff_t &p_min_gallop)
+{
+	RIterator result(p_first - (p_buffer_last - p_buffer_first));
+	while (p_buffer_first != p_buffer_last && p_first != p_last)
+	{
+		// One element at a time until a run wins p_min_gallop times in a row.
+		std::ptrdiff_t buffer_wins(0), range_wins(0);
+		while (buffer_wins < p_min_gallop && range_wins < p_min_gallop)
+		{
+			if (p_compare(*p_first, *p_buffer_first))
+			{
+				*result++ = std::move(*p_first++);
+				++range_wins;
+				buffer_wins = 0;
+				if (p_first == p_last)
+					break;
+			}
+			else
+			{
+				*result++ = std::move(*p_buffer_first++);
+				++buffer_wins;
+				range_wins = 0;
+				if (p_buffer_first == p_buffer_last)
+					break;
+			}
+		}
+		if (p_buffer_first == p_buffer_last || p_first == p_last)
+			break;
+
+		// Galloping: move whole blocks while they stay long, then make galloping easier to enter again.
+		do
+		{
+			buffer_wins = gallop(p_buffer_first, p_buffer_last - p_buffer_first, [&](const auto &p_elem)
+								 { return !p_compare(*p_first, p_elem); });
+			result = std::move(p_buffer_first, p_buffer_first + buffer_wins, result);
+			p_buffer_first += buffer_wins;
+			if (p_buffer_first == p_buffer_last)
+				break;
+			*result++ = std::move(*p_first++);
+			if (p_first == p_last)
+				break;
+
+			range_wins = gallop(p_first, p_last - p_first, [&](const auto &p_elem)
+								{ return p_compare(p_elem, *p_buffer_first); });
+			// The output trails the range, so moving forward is safe.
+			result = std::move(p_first, p_first + range_wins, result);
+			p_first += range_wins;
+			if (p_first == p_last)
+				break;
+			*result++ = std::move(*p_buffer_first++);
+			if (p_buffer_first == p_buffer_last)
+				break;
+
+			if (1 < p_min_gallop)
+				--p_min_gallop;
+		} while (tim_sort_min_gallop <= buffer_wins || tim_sort_min_gallop <= range_wins);
+		if (p_buffer_first == p_buffer_last || p_first == p_last)
+			break;
+		p_min_gallop += 2;
+	}
+	// What is left of the range is already in place.
+	std::move(p_buffer_first, p_buffer_last, result);
+}
+
+template <typename RIterator, typename OIterator, typename Compare>
+void dsaa::detail::merge_runs(RIterator p_first, RIterator p_last, OIterator p_result, std::ptrdiff_t p_width, Compare p_compare)
+{
+	while (p_first != p_last)
+	{
+		RIterator mid(p_last - p_first <= p_width ? p_last : p_first + p_width);
+		RIterator last(p_last - mid <= p_width ? p_last : mid + p_width);
+		p_result = move_merge(p_first, mid, mid, last, p_result, p_compare);
+		p_first = last;
+	}
+}
+
+template <typename RIterator, typename Compare>
+RIterator dsaa::tim_sort(RIterator p_first, RIterator p_last, Compare p_compare)
+{
+	const std::ptrdiff_t size(p_last - p_first);
+	if (size < 2)
+		return p_last;
+	if (size <= dsaa::detail::tim_sort_min_merge)
+	{
+		dsaa::detail::binary_insertion_sort(p_first, p_first + dsaa::detail::count_run_and_make_ascending(p_first, p_last, p_compare), p_last, p_compare);
+		return p_last;
+	}
+
+	// Runs shorter than min_run are extended, so that n / min_run is a power of two or just below one.
+	std::ptrdiff_t min_run(size), odd_bits(0);
+	while (dsaa::detail::tim_sort_min_merge <= min_run)
+	{
+		odd_bits |= min_run & 1;
+		min_run >>= 1;
+	}
+	min_run += odd_bits;
+
+	// Merges never need room for more than the shorter run.
+	auto buffer(dsaa::detail::make_sort_buffer(p_first, p_first + size / 2));
+	std::ptrdiff_t min_gallop(dsaa::detail::tim_sort_min_gallop);
+	// Run lengths grow at least like the Fibonacci numbers from the bottom of the stack, so 85 entries cover 2^64 elements.
+	std::ptrdiff_t run_base[85], run_length[85];
+	std::ptrdiff_t stack_size(0);
+
+	auto merge_at([&](std::ptrdiff_t p_index)
+				  {
+					  RIterator first1(p_first + run_base[p_index]), first2(p_first + run_base[p_index + 1]);
+					  std::ptrdiff_t length1(run_length[p_index]), length2(run_length[p_index + 1]);
+					  run_length[p_index] = length1 + length2;
+					  if (p_index == stack_size - 3)
+					  {
+						  run_base[p_index + 1] = run_base[p_index + 2];
+						  run_length[p_index + 1] = run_length[p_index + 2];
+					  }
+					  --stack_size;
+
+					  // Elements of the first run not greater than the head of the second and elements of the second run
+					  // not less than the tail of the first are already in place.
+					  const std::ptrdiff_t skip(dsaa::detail::gallop(first1, length1, [&](const auto &p_elem)
+													   { return !p_compare(*first2, p_elem); }));
+					  first1 += skip;
+					  length1 -= skip;
+					  if (!length1)
+						  return;
+					  length2 = dsaa::detail::gallop(first2, length2, [&](const auto &p_elem)
+									   { return p_compare(p_elem, *(first2 - 1)); });
+					  if (!length2)
+						  return;
+
+					  if (length1 <= length2)
+					  {
+						  auto buffer_last(std::move(first1, first2, buffer.data()));
+						  dsaa::detail::gallop_merge(buffer.data(), buffer_last, first2, first2 + length2, p_compare, min_gallop);
+					  }
+					  else
+					  {
+						  // Merge from the back: the same merge on reversed ranges with the arguments of the comparator swapped.
+						  // Ties still go to the first run, which is the reversed second one, keeping the sort stable.
+						  auto buffer_last(std::move(first2, first2 + length2, buffer.data()));
+						  dsaa::detail::gallop_merge(std::make_reverse_iterator(buffer_last), std::make_reverse_iterator(buffer.data()),
+									   std::make_reverse_iterator(first2), std::make_reverse_iterator(first1),
+									   [&p_compare](const auto &p_lhs, const auto &p_rhs)
+									   { return p_compare(p_rhs, p_lhs); },
+									   min_gallop);
+					  } });
+
+	for (std::ptrdiff_t low(0); low != size;)
+	{
+		std::ptrdiff_t run(dsaa::detail::count_run_and_make_ascending(p_first + low, p_last, p_compare));
+		if (run < min_run)
+		{
+			const std::ptrdiff_t forced(std::min(min_run, size - low));
+			dsaa::detail::binary_insertion_sort(p_first + low, p_first + low + run, p_first + low + forced, p_compare);
+			run = forced;
+		}
+		run_base[stack_size] = low;
+		run_length[stack_size] = run;
+		++stack_size;
+		low += run;
+
+		// Keep run_length[i - 2] > run_length[i - 1] + run_length[i] and run_length[i - 1] > run_length[i] for the top four runs.
+		while (1 < stack_size)
+		{
+			std::ptrdiff_t index(stack_size - 2);
+			if ((0 < index && run_length[index - 1] <= run_length[index] + run_length[index + 1]) ||
+				(1 < index && run_length[index - 2] <= run_length[index - 1] + run_length[index]))
+			{
+				if (run_length[index - 1] < run_length[index + 1])
+					--index;
+			}
+			else if (run_length[index + 1] < run_length[index])
+				break;
+			merge_at(index);
+		}
+	}
+
+	while (1 < stack_size)
+	{
+		std::ptrdiff_t index(stack_size - 2);
+		if (0 < index && run_length[index - 1] < run_length[index + 1])
+			--index;
+		merge_at(index);
 	}
 	return p_last;
 }
@@ -186,7 +694,7 @@ RIterator dsaa::sort_heap(RIterator p_first, RIterator p_last, Compare p_compare
 
 	for (auto i(p_last - 1); p_first != i; --i)
 	{
-		std::swap(*p_first, *i);
+		std::iter_swap(p_first, i);
 		dsaa::heapify(p_first, i, p_first, p_compare);
 	}
 
@@ -313,6 +821,176 @@ RIterator dsaa::randomized_tail_hoare_quick_sort(RIterator p_first, RIterator p_
 	return p_last;
 }
 
+template <typename RIterator, typename Compare>
+void dsaa::detail::move_median_to_first(RIterator p_result, RIterator p_a, RIterator p_b, RIterator p_c, Compare p_compare)
+{
+	if (p_compare(*p_a, *p_b))
+	{
+		if (p_compare(*p_b, *p_c))
+			std::iter_swap(p_result, p_b);
+		else if (p_compare(*p_a, *p_c))
+			std::iter_swap(p_result, p_c);
+		else
+			std::iter_swap(p_result, p_a);
+	}
+	else if (p_compare(*p_a, *p_c))
+		std::iter_swap(p_result, p_a);
+	else if (p_compare(*p_b, *p_c))
+		std::iter_swap(p_result, p_c);
+	else
+		std::iter_swap(p_result, p_b);
+}
+
+template <typename RIterator, typename Compare>
+RIterator dsaa::detail::introsort_partition(RIterator p_first, RIterator p_last, Compare p_compare)
+{
+	const std::ptrdiff_t size(p_last - p_first);
+	RIterator mid(p_first + size / 2);
+	if (ninther_threshold < size)
+	{
+		// Tukey's ninther: median of the medians of three spread out triples.
+		const std::ptrdiff_t step(size / 8);
+		move_median_to_first(p_first + 1, p_first + 1, p_first + step, p_first + 2 * step, p_compare);
+		move_median_to_first(mid, mid - step, mid, mid + step, p_compare);
+		move_median_to_first(p_last - 1, p_last - 2 * step, p_last - step, p_last - 1, p_compare);
+		move_median_to_first(p_first, p_first + 1, mid, p_last - 1, p_compare);
+	}
+	else
+		move_median_to_first(p_first, p_first + 1, mid, p_last - 1, p_compare);
+
+	return dsaa::hoare_partition(p_first, p_last, p_compare) + 1;
+}
+
+template <typename RIterator, typename Compare>
+void dsaa::detail::introsort_loop(RIterator p_first, RIterator p_last, size_t p_depth_limit, Compare p_compare)
+{
+	while (introsort_threshold < p_last - p_first)
+	{
+		if (!p_depth_limit)
+		{
+			// Too many bad pivots, heap sort the rest. The heap wants a max-heap order for ascending output.
+			auto heap_compare = [&p_compare](const auto &p_lhs, const auto &p_rhs)
+			{ return !p_compare(p_lhs, p_rhs); };
+			dsaa::build_heap(p_first, p_last, heap_compare);
+			dsaa::sort_heap(p_first, p_last, heap_compare);
+			return;
+		}
+		--p_depth_limit;
+
+		RIterator cut(introsort_partition(p_first, p_last, p_compare));
+		// Recurse into the smaller side so the stack stays O(log n).
+		if (cut - p_first < p_last - cut)
+		{
+			introsort_loop(p_first, cut, p_depth_limit, p_compare);
+			p_first = cut;
+		}
+		else
+		{
+			introsort_loop(cut, p_last, p_depth_limit, p_compare);
+			p_last = cut;
+		}
+	}
+	dsaa::insertion_sort(p_first, p_last, p_compare);
+}
+
+template <typename RIterator, typename Compare>
+RIterator dsaa::sort(RIterator p_first, RIterator p_last, Compare p_compare)
+{
+	if (p_last - p_first < 2)
+		return p_last;
+
+	dsaa::detail::introsort_loop(p_first, p_last, dsaa::detail::introsort_depth_limit(p_last - p_first), p_compare);
+	return p_last;
+}
+
+template <typename RIterator, typename Compare>
+RIterator dsaa::nth_element(RIterator p_first, RIterator p_nth, RIterator p_last, Compare p_compare)
+{
+	if (p_nth == p_last)
+		return p_nth;
+
+	size_t depth_limit(dsaa::detail::introsort_depth_limit(p_last - p_first));
+	while (dsaa::detail::introsort_threshold < p_last - p_first)
+	{
+		if (!depth_limit)
+		{
+			// The greatest of the smallest elements up to p_nth is the first of the heap.
+			dsaa::detail::heap_select(p_first, p_nth + 1, p_last, p_compare);
+			std::iter_swap(p_first, p_nth);
+			return p_nth;
+		}
+		--depth_limit;
+
+		RIterator cut(dsaa::detail::introsort_partition(p_first, p_last, p_compare));
+		if (p_nth < cut)
+			p_last = cut;
+		else
+			p_first = cut;
+	}
+	dsaa::insertion_sort(p_first, p_last, p_compare);
+	return p_nth;
+}
+
+template <typename RIterator, typename Compare>
+RIterator dsaa::partial_sort(RIterator p_first, RIterator p_middle, RIterator p_last, Compare p_compare)
+{
+	if (p_first == p_middle)
+		return p_middle;
+
+	dsaa::detail::heap_select(p_first, p_middle, p_last, p_compare);
+	dsaa::sort_heap(p_first, p_middle, [&p_compare](const auto &p_lhs, const auto &p_rhs)
+					{ return !p_compare(p_lhs, p_rhs); });
+	return p_middle;
+}
+
+template <typename IIterator, typename Compare>
+dsaa::DynamicArray<typename std::iterator_traits<IIterator>::value_type> dsaa::top_k(IIterator p_first, IIterator p_last, size_t p_k, Compare p_compare)
+{
+	using value_type = typename std::iterator_traits<IIterator>::value_type;
+
+	DynamicArray<value_type> result;
+	if (!p_k)
+		return result;
+	// A min-heap: the first element is the one to evict when a greater one comes.
+	auto heap_compare = [&p_compare](const value_type &p_lhs, const value_type &p_rhs)
+	{ return !p_compare(p_rhs, p_lhs); };
+	for (; p_first != p_last; ++p_first)
+	{
+		if (result.size() < p_k)
+		{
+			result.insert_last(*p_first);
+			if (result.size() == p_k)
+				dsaa::build_heap(result.begin(), result.end(), heap_compare);
+		}
+		else if (p_compare(result[0], *p_first))
+		{
+			result[0] = *p_first;
+			dsaa::heapify(result.begin(), result.end(), result.begin(), heap_compare);
+		}
+	}
+
+	dsaa::sort(result.begin(), result.end(), [&p_compare](const value_type &p_lhs, const value_type &p_rhs)
+			   { return p_compare(p_rhs, p_lhs); });
+	return result;
+}
+
+template <typename RIterator, typename Compare>
+void dsaa::detail::heap_select(RIterator p_first, RIterator p_middle, RIterator p_last, Compare p_compare)
+{
+	// A max-heap: the first element is the one to evict when a smaller one comes.
+	auto heap_compare = [&p_compare](const auto &p_lhs, const auto &p_rhs)
+	{ return !p_compare(p_lhs, p_rhs); };
+	dsaa::build_heap(p_first, p_middle, heap_compare);
+	for (RIterator iter(p_middle); iter != p_last; ++iter)
+	{
+		if (p_compare(*iter, *p_first))
+		{
+			std::iter_swap(iter, p_first);
+			dsaa::heapify(p_first, p_middle, p_first, heap_compare);
+		}
+	}
+}
+
 template <typename RIterator, typename Compare, typename IntType>
 RIterator dsaa::counting_sort(RIterator p_first, RIterator p_last, Compare, IntType p_min, IntType p_max)
 {
@@ -335,7 +1013,7 @@ RIterator dsaa::counting_sort(RIterator p_first, RIterator p_last, Compare, IntT
 	for (auto iter(count_table.begin() + 1); iter != count_table.end(); ++iter)
 		*iter += *(iter - 1);
 
-	dsaa::DynamicArray<IntType> result(p_last - p_first);
+	dsaa::DynamicArray<IntType> result(p_last - p_first, dsaa::default_init); // Every slot is written below.
 
 	for (auto iter(p_last - 1); p_first <= iter; --iter)
 	{
@@ -373,16 +1051,16 @@ RIterator dsaa::radix_sort(RIterator p_first, RIterator p_last, Compare, IntType
 		throw std::runtime_error("p_min < 0 in radix sort. p_min must less than or eual to zero");
 	if (std::numeric_limits<IntType>::max() == p_max)
 		p_max = *std::max_element(p_first, p_last);
+	// Every element is zero: no pass would run, and the range is already sorted.
+	if (p_max == 0)
+		return p_last;
 
 	dsaa::DynamicArray<IntType> count_table(p_base);
-	dsaa::DynamicArray<IntType> result(p_last - p_first);
+	dsaa::DynamicArray<IntType> result(p_last - p_first, dsaa::default_init); // Every slot is written by each pass, and at least one runs.
 
 	for (size_t exponential(1); 0 < (p_max) / exponential; exponential *= p_base)
 	{
-		count_table.clear();
-		count_table.resize(p_base);
-		result.clear();
-		result.resize(p_last - p_first);
+		std::fill(count_table.begin(), count_table.end(), IntType());
 		// Start counting.
 		auto begin(p_first);
 		while (begin != p_last)
@@ -420,6 +1098,141 @@ RIterator dsaa::radix_sort(RIterator p_first, RIterator p_last, Compare, IntType
 	return p_last;
 }
 
+template <typename Key>
+auto dsaa::detail::radix_unsigned_key(Key p_key) noexcept
+{
+	static_assert(std::is_integral_v<Key> || (std::is_floating_point_v<Key> && (sizeof(Key) == 4 || sizeof(Key) == 8)),
+				  "lsd_radix_sort needs integer, float or double keys.");
+	if constexpr (std::is_floating_point_v<Key>)
+	{
+		using Unsigned = std::conditional_t<sizeof(Key) == 4, uint32_t, uint64_t>;
+		constexpr Unsigned sign_bit(Unsigned(1) << (sizeof(Unsigned) * CHAR_BIT - 1));
+		Unsigned bits;
+		std::memcpy(&bits, &p_key, sizeof(bits));
+		return static_cast<Unsigned>(bits & sign_bit ? ~bits : bits | sign_bit);
+	}
+	else if constexpr (std::is_signed_v<Key>)
+	{
+		using Unsigned = std::make_unsigned_t<Key>;
+		constexpr Unsigned sign_bit(Unsigned(1) << (sizeof(Unsigned) * CHAR_BIT - 1));
+		return static_cast<Unsigned>(static_cast<Unsigned>(p_key) ^ sign_bit);
+	}
+	else
+		return p_key;
+}
+
+template <size_t DigitBits, typename RIterator, typename KeyExtractor>
+RIterator dsaa::lsd_radix_sort(RIterator p_first, RIterator p_last, KeyExtractor p_key)
+{
+	static_assert(0 < DigitBits && DigitBits <= 16, "DigitBits must be in [1, 16].");
+	using value_type = typename std::iterator_traits<RIterator>::value_type;
+	using Key = std::decay_t<std::invoke_result_t<KeyExtractor &, const value_type &>>;
+	using Unsigned = decltype(detail::radix_unsigned_key(std::declval<Key>()));
+	constexpr size_t key_bits(sizeof(Unsigned) * CHAR_BIT);
+	constexpr size_t passes((key_bits + DigitBits - 1) / DigitBits);
+	constexpr size_t radix(size_t(1) << DigitBits);
+
+	const std::ptrdiff_t size(p_last - p_first);
+	auto unsigned_key([&p_key](const value_type &p_elem)
+					  { return detail::radix_unsigned_key(static_cast<Key>(std::invoke(p_key, p_elem))); });
+	if (size <= detail::radix_sort_threshold)
+	{
+		dsaa::insertion_sort(p_first, p_last, [&unsigned_key](const value_type &p_lhs, const value_type &p_rhs)
+							 { return unsigned_key(p_lhs) < unsigned_key(p_rhs); });
+		return p_last;
+	}
+
+	// Counts of every pass are taken in a single read of the input.
+	dsaa::DynamicArray<size_t> counts(passes * radix);
+	for (RIterator iter(p_first); iter != p_last; ++iter)
+	{
+		const Unsigned key(unsigned_key(*iter));
+		for (size_t pass(0); pass != passes; ++pass)
+			++counts[pass * radix + ((key >> (pass * DigitBits)) & (radix - 1))];
+	}
+
+	auto buffer(dsaa::detail::make_sort_buffer(p_first, p_last));
+
+	auto scatter([&unsigned_key, size](auto p_source, auto p_destination, size_t *p_offsets, size_t p_shift)
+				 {
+					 // Turn counts into the first index of every digit.
+					 size_t sum(0);
+					 for (size_t digit(0); digit != radix; ++digit)
+					 {
+						 const size_t count(p_offsets[digit]);
+						 p_offsets[digit] = sum;
+						 sum += count;
+					 }
+					 for (std::ptrdiff_t i(0); i != size; ++i, ++p_source)
+						 p_destination[p_offsets[(unsigned_key(*p_source) >> p_shift) & (radix - 1)]++] = std::move(*p_source); });
+
+	const Unsigned first_key(unsigned_key(*p_first));
+	bool in_buffer(false);
+	for (size_t pass(0); pass != passes; ++pass)
+	{
+		size_t *offsets(counts.data() + pass * radix);
+		if (offsets[(first_key >> (pass * DigitBits)) & (radix - 1)] == static_cast<size_t>(size))
+			continue;
+		if (in_buffer)
+			scatter(buffer.data(), p_first, offsets, pass * DigitBits);
+		else
+			scatter(p_first, buffer.data(), offsets, pass * DigitBits);
+		in_buffer = !in_buffer;
+	}
+	if (in_buffer)
+		std::move(buffer.begin(), buffer.end(), p_first);
+	return p_last;
+}
+
+template <typename RIterator, typename KeyExtractor, typename Compare>
+RIterator dsaa::sort_by_key(RIterator p_first, RIterator p_last, KeyExtractor p_key, Compare p_compare)
+{
+	using value_type = typename std::iterator_traits<RIterator>::value_type;
+	using Key = std::decay_t<std::invoke_result_t<KeyExtractor &, const value_type &>>;
+	using Pair = detail::KeyIndex<Key>;
+
+	const size_t size(static_cast<size_t>(p_last - p_first));
+	if (size < 2)
+		return p_last;
+
+	DynamicArray<Pair> order;
+	order.reserve(size);
+	for (size_t i(0); i != size; ++i)
+		order.insert_last(Pair{std::invoke(p_key, std::as_const(p_first[i])), i});
+
+	if constexpr (std::is_integral_v<Key> && !std::is_same_v<Key, bool> && std::is_same_v<Compare, std::less<Key>>)
+		dsaa::lsd_radix_sort(order.begin(), order.end(), [](const Pair &p_pair) noexcept
+							 { return p_pair.key; });
+	else
+		dsaa::merge_sort(order.begin(), order.end(), [&p_compare](const Pair &p_lhs, const Pair &p_rhs)
+						 { return p_compare(p_lhs.key, p_rhs.key); });
+
+	detail::apply_key_order(p_first, order);
+	return p_last;
+}
+
+template <typename RIterator, typename Key>
+void dsaa::detail::apply_key_order(RIterator p_first, DynamicArray<KeyIndex<Key>> &p_order)
+{
+	for (size_t start(0); start != p_order.size(); ++start)
+	{
+		if (p_order[start].index == start)
+			continue;
+		// Every position of the cycle is filled from the next one, marked done by pointing at itself.
+		auto value(std::move(p_first[start]));
+		size_t hole(start);
+		while (p_order[hole].index != start)
+		{
+			const size_t next(p_order[hole].index);
+			p_first[hole] = std::move(p_first[next]);
+			p_order[hole].index = hole;
+			hole = next;
+		}
+		p_first[hole] = std::move(value);
+		p_order[hole].index = hole;
+	}
+}
+
 template <typename RIterator, typename Compare, typename RealType>
 RIterator dsaa::bucket_sort_uniform_distribution(RIterator p_first, RIterator p_last, Compare p_compare)
 {
@@ -427,12 +1240,14 @@ RIterator dsaa::bucket_sort_uniform_distribution(RIterator p_first, RIterator p_
 		return p_last;
 
 	const size_t arr_size(p_last - p_first);
-	dsaa::DynamicArray<dsaa::DynamicArray<RealType>> buckets(arr_size);
+	// Buckets hold about one element each, so keep them inline instead of allocating per bucket.
+	dsaa::DynamicArray<dsaa::SmallDynamicArray<RealType, 4>> buckets(arr_size);
 
 	auto begin(p_first);
 	for (size_t i(0); i != arr_size; ++i, ++begin)
 	{
-		size_t index = arr_size * (*begin);
+		// A value of exactly 1 goes to the last bucket.
+		size_t index(std::min(static_cast<size_t>(arr_size * (*begin)), arr_size - 1));
 		buckets[index].insert_last(*begin);
 	}
 
@@ -449,8 +1264,9 @@ RIterator dsaa::bucket_sort_uniform_distribution(RIterator p_first, RIterator p_
 	}
 	else
 	{
-		for (size_t i(0); i != arr_size; ++i)
-			for (auto iter(buckets[i].end() - 1); buckets[i].begin() <= iter; --iter, ++p_first)
+		// Buckets are already sorted by p_compare, only their order has to be reversed.
+		for (size_t i(arr_size); i != 0; --i)
+			for (auto iter(buckets[i - 1].begin()); buckets[i - 1].end() != iter; ++iter, ++p_first)
 				*p_first = *iter;
 	}
 	return p_last;
@@ -0,0 +1,131 @@
+#include "TaskPool.h"
+
+namespace
+{
+	// The pool and queue index of the calling worker thread.
+	thread_local const dsaa::TaskPool *t_pool(nullptr);
+	thread_local size_t t_queue(0);
+}
+
+dsaa::TaskPool::TaskPool(size_t p_thread_count)
+	: m_queues(), m_threads(), m_pending(0), m_stop(false), m_sleep_mutex(), m_wake()
+{
+	if (!p_thread_count)
+		p_thread_count = std::thread::hardware_concurrency();
+	if (!p_thread_count)
+		p_thread_count = 1;
+
+	// Queue 0 is shared by every thread that is not a worker.
+	for (size_t i(0); i != p_thread_count; ++i)
+		m_queues.emplace_back(new Queue());
+	m_threads.reserve(p_thread_count - 1);
+	for (size_t i(1); i != p_thread_count; ++i)
+		m_threads.emplace_back(&TaskPool::work, this, i);
+}
+
+dsaa::TaskPool::~TaskPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(m_sleep_mutex);
+		m_stop = true;
+	}
+	m_wake.notify_all();
+	for (auto &thread : m_threads)
+		thread.join();
+	while (try_run_one())
+		;
+}
+
+void dsaa::TaskPool::submit(std::function<void()> p_task)
+{
+	// Counted before it is visible, so a thief can never take m_pending below zero.
+	m_pending.fetch_add(1, std::memory_order_release);
+	Queue &queue(*m_queues[own_queue()]);
+	{
+		std::lock_guard<std::mutex> lock(queue.m_mutex);
+		queue.m_tasks.push_back(std::move(p_task));
+	}
+
+	// Taking the lock orders this wake up after a worker's last check, so it can not be lost.
+	{
+		std::lock_guard<std::mutex> lock(m_sleep_mutex);
+	}
+	m_wake.notify_one();
+}
+
+bool dsaa::TaskPool::try_run_one()
+{
+	std::function<void()> task;
+	const size_t own(own_queue());
+	{
+		Queue &queue(*m_queues[own]);
+		std::lock_guard<std::mutex> lock(queue.m_mutex);
+		if (!queue.m_tasks.empty())
+		{
+			task = std::move(queue.m_tasks.back());
+			queue.m_tasks.pop_back();
+		}
+	}
+
+	// Steal the oldest, usually largest, task of another queue.
+	for (size_t i(1); !task && i != m_queues.size(); ++i)
+	{
+		Queue &queue(*m_queues[(own + i) % m_queues.size()]);
+		std::lock_guard<std::mutex> lock(queue.m_mutex);
+		if (!queue.m_tasks.empty())
+		{
+			task = std::move(queue.m_tasks.front());
+			queue.m_tasks.pop_front();
+		}
+	}
+
+	if (!task)
+		return false;
+	m_pending.fetch_sub(1, std::memory_order_relaxed);
+	task();
+	return true;
+}
+
+size_t dsaa::TaskPool::own_queue() const noexcept
+{
+	return t_pool == this ? t_queue : 0;
+}
+
+void dsaa::TaskPool::work(size_t p_index)
+{
+	t_pool = this;
+	t_queue = p_index;
+	while (true)
+	{
+		if (try_run_one())
+			continue;
+
+		std::unique_lock<std::mutex> lock(m_sleep_mutex);
+		m_wake.wait(lock, [this]()
+					{ return m_stop || m_pending.load(std::memory_order_acquire); });
+		if (m_stop && !m_pending.load(std::memory_order_acquire))
+			return;
+	}
+}
+
+dsaa::TaskGroup::~TaskGroup()
+{
+	while (m_running.load(std::memory_order_acquire))
+		if (!m_pool.try_run_one())
+			std::this_thread::yield();
+}
+
+void dsaa::TaskGroup::wait()
+{
+	while (m_running.load(std::memory_order_acquire))
+		if (!m_pool.try_run_one())
+			std::this_thread::yield();
+
+	std::exception_ptr exception;
+	{
+		std::lock_guard<std::mutex> lock(m_exception_mutex);
+		std::swap(exception, m_exception);
+	}
+	if (exception)
+		std::rethrow_exception(exception);
+}
\ No newline at end of file
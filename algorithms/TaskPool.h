@@ -0,0 +1,104 @@
+#ifndef DSAA_TASK_POOL_H
+#define DSAA_TASK_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "dsaaTypedefs.h"
+
+namespace dsaa
+{
+	// Work-stealing thread pool. Every worker owns a deque: it pushes and pops its own tasks at the back,
+	// idle workers steal from the front of the others. Threads that are not workers submit to a shared queue.
+	class TaskPool final
+	{
+	public:
+		// Creates a pool for p_thread_count threads in total, the thread waiting on a TaskGroup being one of them,
+		// so p_thread_count - 1 workers are started. 0 means std::thread::hardware_concurrency().
+		explicit TaskPool(size_t p_thread_count = 0);
+		TaskPool(const TaskPool &) = delete;
+		TaskPool &operator=(const TaskPool &) = delete;
+		// Runs the remaining tasks and joins the workers.
+		~TaskPool();
+
+		NODISCARD size_t thread_count() const noexcept { return m_threads.size() + 1; }
+
+		// Queues p_task to run on any thread of the pool.
+		void submit(std::function<void()> p_task);
+		// Runs one queued task on the calling thread. Returns false when there was none.
+		bool try_run_one();
+
+	private:
+		struct Queue
+		{
+			Queue() : m_mutex(), m_tasks() {}
+
+			std::mutex m_mutex;
+			std::deque<std::function<void()>> m_tasks;
+		};
+
+		// Returns the queue the calling thread owns, the shared one for non-worker threads.
+		NODISCARD size_t own_queue() const noexcept;
+		void work(size_t p_index);
+
+		std::vector<std::unique_ptr<Queue>> m_queues;
+		std::vector<std::thread> m_threads;
+		std::atomic<size_t> m_pending;
+		std::atomic<bool> m_stop;
+		std::mutex m_sleep_mutex;
+		std::condition_variable m_wake;
+	};
+
+	// Fork-join scope on a TaskPool. run() forks a task, wait() joins all of them, running queued tasks
+	// on the waiting thread meanwhile, so groups can nest. The first exception thrown by a task is rethrown by wait().
+	class TaskGroup final
+	{
+	public:
+		explicit TaskGroup(TaskPool &p_pool) noexcept : m_pool(p_pool), m_running(0), m_exception(), m_exception_mutex() {}
+		TaskGroup(const TaskGroup &) = delete;
+		TaskGroup &operator=(const TaskGroup &) = delete;
+		~TaskGroup();
+
+		template <typename Task>
+		void run(Task &&p_task);
+		void wait();
+
+		NODISCARD TaskPool &pool() noexcept { return m_pool; }
+
+	private:
+		TaskPool &m_pool;
+		std::atomic<size_t> m_running;
+		std::exception_ptr m_exception;
+		std::mutex m_exception_mutex;
+	};
+}
+
+template <typename Task>
+void dsaa::TaskGroup::run(Task &&p_task)
+{
+	m_running.fetch_add(1, std::memory_order_relaxed);
+	m_pool.submit([this, task = std::forward<Task>(p_task)]() mutable
+				  {
+					  try
+					  {
+						  task();
+					  }
+					  catch (...)
+					  {
+						  std::lock_guard<std::mutex> lock(m_exception_mutex);
+						  if (!m_exception)
+							  m_exception = std::current_exception();
+					  }
+					  m_running.fetch_sub(1, std::memory_order_release); });
+}
+
+#endif // !DSAA_TASK_POOL_H
@@ -0,0 +1,429 @@
+#ifndef DSAA_BENCHMARK_SORT_H
+#define DSAA_BENCHMARK_SORT_H
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "Catch2/Catch.hpp"
+#include "algorithms/Sort.h"
+#include "algorithms/ParallelSort.h"
+#include "algorithms/ExternalSort.h"
+#include "algorithms/SimdSort.h"
+#include "algorithms/Random.h"
+
+namespace
+{
+    // The inputs quicksort variants are usually weak on.
+    dsaa::DynamicArray<int> sort_input(const std::string &p_shape, int p_size)
+    {
+        dsaa::DynamicArray<int> result(dsaa::random::random_range_ints<int>(p_size));
+        for (int i(0); i != p_size; ++i)
+        {
+            if (p_shape == "sorted")
+                result[i] = i;
+            else if (p_shape == "reversed")
+                result[i] = p_size - i;
+            else if (p_shape == "organ-pipe")
+                result[i] = i < p_size / 2 ? i : p_size - i;
+            else if (p_shape == "duplicates")
+                result[i] = result[i] & 3;
+        }
+        return result;
+    }
+
+    template <typename Elem, typename Sort>
+    void benchmark_sort(std::string p_name, const dsaa::DynamicArray<Elem> &p_source, Sort p_sort)
+    {
+        BENCHMARK_ADVANCED(std::move(p_name))(Catch::Benchmark::Chronometer meter)
+        {
+            std::vector<dsaa::DynamicArray<Elem>> arrays(meter.runs(), p_source);
+            meter.measure([&](int i)
+                          { p_sort(arrays[i].begin(), arrays[i].end()); return arrays[i][0]; });
+        };
+    }
+}
+
+TEST_CASE("Benchmark dsaa::sort against the quicksort variants.", "[!benchmark][Sort]")
+{
+    // Small enough that the quadratic cases finish, deep recursion included.
+    const int size(10000);
+
+    for (const char *shape : {"random", "sorted", "reversed", "organ-pipe", "duplicates"})
+    {
+        const dsaa::DynamicArray<int> source(sort_input(shape, size));
+        const std::string suffix(std::string(" 10K int, ") + shape);
+
+        benchmark_sort("lomuto_quick_sort" + suffix, source, [](auto p_first, auto p_last)
+                       { dsaa::lomuto_quick_sort(p_first, p_last); });
+        benchmark_sort("hoare_quick_sort" + suffix, source, [](auto p_first, auto p_last)
+                       { dsaa::hoare_quick_sort(p_first, p_last); });
+        benchmark_sort("randomized_hoare_quick_sort" + suffix, source, [](auto p_first, auto p_last)
+                       { dsaa::randomized_hoare_quick_sort(p_first, p_last); });
+        benchmark_sort("dsaa::sort" + suffix, source, [](auto p_first, auto p_last)
+                       { dsaa::sort(p_first, p_last); });
+        benchmark_sort("std::sort" + suffix, source, [](auto p_first, auto p_last)
+                       { std::sort(p_first, p_last); });
+    }
+}
+
+TEST_CASE("Benchmark dsaa::sort on large inputs.", "[!benchmark][Sort]")
+{
+    const int size(1 << 20);
+
+    for (const char *shape : {"random", "sorted", "reversed", "organ-pipe", "duplicates"})
+    {
+        const dsaa::DynamicArray<int> source(sort_input(shape, size));
+        const std::string suffix(std::string(" 1M int, ") + shape);
+
+        benchmark_sort("dsaa::sort" + suffix, source, [](auto p_first, auto p_last)
+                       { dsaa::sort(p_first, p_last); });
+        benchmark_sort("std::sort" + suffix, source, [](auto p_first, auto p_last)
+                       { std::sort(p_first, p_last); });
+    }
+}
+
+TEST_CASE("Benchmark parallel_sort and parallel_merge_sort.", "[!benchmark][ParallelSort]")
+{
+    const int size(1 << 22);
+    const dsaa::DynamicArray<int> source(sort_input("random", size));
+
+    for (size_t thread_count : {1, 2, 4, 8})
+    {
+        // One pool per thread count, so thread start up is not measured.
+        dsaa::TaskPool pool(thread_count);
+        dsaa::ParallelSortOptions options;
+        options.pool = &pool;
+        const std::string suffix(" 4M int, " + std::to_string(thread_count) + " threads");
+
+        benchmark_sort("parallel_sort" + suffix, source, [&options](auto p_first, auto p_last)
+                       { dsaa::parallel_sort(p_first, p_last, std::less<int>(), options); });
+        benchmark_sort("parallel_merge_sort" + suffix, source, [&options](auto p_first, auto p_last)
+                       { dsaa::parallel_merge_sort(p_first, p_last, std::less<int>(), options); });
+    }
+    benchmark_sort("dsaa::sort 4M int", source, [](auto p_first, auto p_last)
+                   { dsaa::sort(p_first, p_last); });
+    benchmark_sort("std::stable_sort 4M int", source, [](auto p_first, auto p_last)
+                   { std::stable_sort(p_first, p_last); });
+}
+
+TEST_CASE("Benchmark lsd_radix_sort against radix_sort.", "[!benchmark][RadixSort]")
+{
+    const int size(1 << 20);
+    const dsaa::DynamicArray<uint64_t> keys64(dsaa::random::random_range_ints<uint64_t>(size, 0, std::numeric_limits<uint64_t>::max() >> 1));
+    const dsaa::DynamicArray<int> keys32(dsaa::random::random_range_ints<int>(size));
+
+    benchmark_sort("radix_sort 1M uint64", keys64, [](auto p_first, auto p_last)
+                   { dsaa::radix_sort(p_first, p_last); });
+    benchmark_sort("lsd_radix_sort<8> 1M uint64", keys64, [](auto p_first, auto p_last)
+                   { dsaa::lsd_radix_sort<8>(p_first, p_last); });
+    benchmark_sort("lsd_radix_sort<11> 1M uint64", keys64, [](auto p_first, auto p_last)
+                   { dsaa::lsd_radix_sort<11>(p_first, p_last); });
+    benchmark_sort("lsd_radix_sort<16> 1M uint64", keys64, [](auto p_first, auto p_last)
+                   { dsaa::lsd_radix_sort<16>(p_first, p_last); });
+    benchmark_sort("dsaa::sort 1M uint64", keys64, [](auto p_first, auto p_last)
+                   { dsaa::sort(p_first, p_last); });
+
+    benchmark_sort("lsd_radix_sort<8> 1M int", keys32, [](auto p_first, auto p_last)
+                   { dsaa::lsd_radix_sort<8>(p_first, p_last); });
+    benchmark_sort("lsd_radix_sort<11> 1M int", keys32, [](auto p_first, auto p_last)
+                   { dsaa::lsd_radix_sort<11>(p_first, p_last); });
+    benchmark_sort("dsaa::sort 1M int", keys32, [](auto p_first, auto p_last)
+                   { dsaa::sort(p_first, p_last); });
+}
+
+TEST_CASE("Benchmark msd_radix_sort on strings.", "[!benchmark][StringSort]")
+{
+    const int size(1 << 19);
+    // Keys sharing a prefix, like paths or URLs, and plain random words.
+    for (const char *shape : {"random", "prefixed"})
+    {
+        dsaa::DynamicArray<std::string> source;
+        for (int value : dsaa::random::random_range_ints<int>(size))
+            source.insert_last((shape == std::string("prefixed") ? "https://example.com/item/" : "") + std::to_string(value));
+        const std::string suffix(std::string(" 512K strings, ") + shape);
+
+        benchmark_sort("msd_radix_sort" + suffix, source, [](auto p_first, auto p_last)
+                       { dsaa::msd_radix_sort(p_first, p_last); });
+        benchmark_sort("dsaa::sort" + suffix, source, [](auto p_first, auto p_last)
+                       { dsaa::sort(p_first, p_last); });
+        benchmark_sort("std::sort" + suffix, source, [](auto p_first, auto p_last)
+                       { std::sort(p_first, p_last); });
+    }
+}
+
+TEST_CASE("Benchmark the merge sorts.", "[!benchmark][MergeSort]")
+{
+    const int size(1 << 20);
+    const dsaa::DynamicArray<int> source(sort_input("random", size));
+    dsaa::DynamicArray<int> buffer(size, dsaa::default_init);
+
+    benchmark_sort("merge_sort 1M int", source, [](auto p_first, auto p_last)
+                   { dsaa::merge_sort(p_first, p_last); });
+    benchmark_sort("buffered_merge_sort 1M int", source, [&buffer](auto p_first, auto p_last)
+                   { dsaa::buffered_merge_sort(p_first, p_last, buffer.begin()); });
+    benchmark_sort("bottom_up_merge_sort 1M int", source, [](auto p_first, auto p_last)
+                   { dsaa::bottom_up_merge_sort(p_first, p_last); });
+    benchmark_sort("buffered_bottom_up_merge_sort 1M int", source, [&buffer](auto p_first, auto p_last)
+                   { dsaa::buffered_bottom_up_merge_sort(p_first, p_last, buffer.begin()); });
+    benchmark_sort("std::stable_sort 1M int", source, [](auto p_first, auto p_last)
+                   { std::stable_sort(p_first, p_last); });
+}
+
+TEST_CASE("Benchmark tim_sort on nearly sorted inputs.", "[!benchmark][TimSort]")
+{
+    const int size(1 << 20);
+    // Time ordered events: every element is displaced within a window of p_window.
+    for (int window : {0, 8, 64, 1024})
+        for (int permille : {1, 10, 100})
+        {
+            if (!window && permille != 1)
+                continue;
+            dsaa::DynamicArray<int> source(size, dsaa::default_init);
+            for (int i(0); i != size; ++i)
+                source[i] = i;
+            if (window)
+            {
+                const int swaps(static_cast<int>(static_cast<long long>(size) * permille / 1000));
+                dsaa::DynamicArray<int> positions(dsaa::random::random_range_ints<int>(swaps, 0, size - window - 1));
+                dsaa::DynamicArray<int> offsets(dsaa::random::random_range_ints<int>(swaps, 1, window));
+                for (int i(0); i != swaps; ++i)
+                    std::swap(source[positions[i]], source[positions[i] + offsets[i]]);
+            }
+            const std::string suffix(" 1M int, window " + std::to_string(window) + (window ? ", " + std::to_string(permille) + " permille displaced" : std::string(", sorted")));
+
+            benchmark_sort("tim_sort" + suffix, source, [](auto p_first, auto p_last)
+                           { dsaa::tim_sort(p_first, p_last); });
+            benchmark_sort("merge_sort" + suffix, source, [](auto p_first, auto p_last)
+                           { dsaa::merge_sort(p_first, p_last); });
+            benchmark_sort("std::stable_sort" + suffix, source, [](auto p_first, auto p_last)
+                           { std::stable_sort(p_first, p_last); });
+        }
+
+    const dsaa::DynamicArray<int> random(sort_input("random", size));
+    benchmark_sort("tim_sort 1M int, random", random, [](auto p_first, auto p_last)
+                   { dsaa::tim_sort(p_first, p_last); });
+    benchmark_sort("merge_sort 1M int, random", random, [](auto p_first, auto p_last)
+                   { dsaa::merge_sort(p_first, p_last); });
+}
+
+TEST_CASE("Benchmark simd_sort on primitive keys.", "[!benchmark][SimdSort]")
+{
+    const int size(1 << 20);
+
+    const dsaa::DynamicArray<int32_t> ints(dsaa::random::random_range_ints<int32_t>(size));
+    benchmark_sort("simd_sort 1M int32_t, random", ints, [](auto p_first, auto p_last)
+                   { dsaa::simd_sort(p_first, p_last); });
+    benchmark_sort("scalar_simd_sort 1M int32_t, random", ints, [](auto p_first, auto p_last)
+                   { dsaa::detail::scalar_simd_sort(&*p_first, &*p_first + (p_last - p_first)); });
+    benchmark_sort("hoare_quick_sort 1M int32_t, random", ints, [](auto p_first, auto p_last)
+                   { dsaa::hoare_quick_sort(p_first, p_last); });
+    benchmark_sort("dsaa::sort 1M int32_t, random", ints, [](auto p_first, auto p_last)
+                   { dsaa::sort(p_first, p_last); });
+    benchmark_sort("std::sort 1M int32_t, random", ints, [](auto p_first, auto p_last)
+                   { std::sort(p_first, p_last); });
+
+    const dsaa::DynamicArray<int32_t> duplicates(dsaa::random::random_range_ints<int32_t>(size, 0, 15));
+    benchmark_sort("simd_sort 1M int32_t, duplicates", duplicates, [](auto p_first, auto p_last)
+                   { dsaa::simd_sort(p_first, p_last); });
+    benchmark_sort("std::sort 1M int32_t, duplicates", duplicates, [](auto p_first, auto p_last)
+                   { std::sort(p_first, p_last); });
+
+    const dsaa::DynamicArray<int64_t> longs(dsaa::random::random_range_ints<int64_t>(size));
+    benchmark_sort("simd_sort 1M int64_t, random", longs, [](auto p_first, auto p_last)
+                   { dsaa::simd_sort(p_first, p_last); });
+    benchmark_sort("std::sort 1M int64_t, random", longs, [](auto p_first, auto p_last)
+                   { std::sort(p_first, p_last); });
+
+    const dsaa::DynamicArray<float> floats(dsaa::random::random_range_reals<float>(size, -1.0f, 1.0f));
+    benchmark_sort("simd_sort 1M float, random", floats, [](auto p_first, auto p_last)
+                   { dsaa::simd_sort(p_first, p_last); });
+    benchmark_sort("std::sort 1M float, random", floats, [](auto p_first, auto p_last)
+                   { std::sort(p_first, p_last); });
+
+    const dsaa::DynamicArray<double> doubles(dsaa::random::random_range_reals<double>(size, -1.0, 1.0));
+    benchmark_sort("simd_sort 1M double, random", doubles, [](auto p_first, auto p_last)
+                   { dsaa::simd_sort(p_first, p_last); });
+    benchmark_sort("std::sort 1M double, random", doubles, [](auto p_first, auto p_last)
+                   { std::sort(p_first, p_last); });
+}
+
+TEST_CASE("Benchmark external_sort against an in-memory sort.", "[!benchmark][ExternalSort]")
+{
+    const size_t size(1 << 22);
+    const std::filesystem::path directory(std::filesystem::temp_directory_path());
+    const std::string input((directory / "dsaa_benchmark_external_sort_in.bin").string());
+    const std::string output((directory / "dsaa_benchmark_external_sort_out.bin").string());
+    {
+        const dsaa::DynamicArray<uint64_t> source(dsaa::random::random_range_ints<uint64_t>(size));
+        std::ofstream stream(input, std::ios::binary | std::ios::trunc);
+        stream.write(reinterpret_cast<const char *>(source.data()), static_cast<std::streamsize>(size * sizeof(uint64_t)));
+    }
+
+    BENCHMARK("read, dsaa::sort and write 4M uint64_t")
+    {
+        dsaa::DynamicArray<uint64_t> arr(size, dsaa::default_init);
+        std::ifstream(input, std::ios::binary).read(reinterpret_cast<char *>(arr.data()), static_cast<std::streamsize>(size * sizeof(uint64_t)));
+        dsaa::sort(arr.begin(), arr.end());
+        std::ofstream(output, std::ios::binary | std::ios::trunc).write(reinterpret_cast<const char *>(arr.data()), static_cast<std::streamsize>(size * sizeof(uint64_t)));
+        return arr[0];
+    };
+    for (size_t budget : {size_t(64) << 20, size_t(8) << 20, size_t(1) << 20})
+    {
+        dsaa::ExternalSortOptions options;
+        options.memory_budget = budget;
+        options.io_buffer_size = std::min<size_t>(budget / 16, size_t(1) << 20);
+        BENCHMARK("external_sort 4M uint64_t, budget " + std::to_string(budget >> 20) + " MiB")
+        {
+            return dsaa::external_sort<uint64_t>(input, output, std::less<uint64_t>(), options).runs;
+        };
+    }
+    std::filesystem::remove(input);
+    std::filesystem::remove(output);
+}
+
+TEST_CASE("Benchmark selecting the top 100 against a full sort.", "[!benchmark][Selection]")
+{
+    const int size(1 << 22);
+    const int k(100);
+    const dsaa::DynamicArray<int> source(sort_input("random", size));
+
+    benchmark_sort("hoare_quick_sort 4M int", source, [](auto p_first, auto p_last)
+                   { dsaa::hoare_quick_sort(p_first, p_last, std::greater<int>()); });
+    benchmark_sort("dsaa::sort 4M int", source, [](auto p_first, auto p_last)
+                   { dsaa::sort(p_first, p_last, std::greater<int>()); });
+    benchmark_sort("nth_element 4M int, k = 100", source, [k](auto p_first, auto p_last)
+                   { dsaa::nth_element(p_first, p_first + k, p_last, std::greater<int>()); });
+    benchmark_sort("partial_sort 4M int, k = 100", source, [k](auto p_first, auto p_last)
+                   { dsaa::partial_sort(p_first, p_first + k, p_last, std::greater<int>()); });
+    benchmark_sort("std::partial_sort 4M int, k = 100", source, [k](auto p_first, auto p_last)
+                   { std::partial_sort(p_first, p_first + k, p_last, std::greater<int>()); });
+    BENCHMARK("top_k 4M int, k = 100")
+    {
+        return dsaa::top_k(source.begin(), source.end(), k)[0];
+    };
+}
+
+TEST_CASE("Benchmark sort_by_key against comparators computing the key.", "[!benchmark][SortByKey]")
+{
+    const int size(1 << 18);
+    dsaa::DynamicArray<std::string> source;
+    for (int value : dsaa::random::random_range_ints<int>(size))
+        source.insert_last("https://Example.com/Item/" + std::to_string(value));
+
+    // An integer key: the FNV-1a hash of the string.
+    auto hash([](const std::string &p_elem)
+              {
+                  uint64_t result(14695981039346656037ull);
+                  for (unsigned char c : p_elem)
+                      result = (result ^ c) * 1099511628211ull;
+                  return result; });
+    benchmark_sort("merge_sort 256K strings, hashed in the comparator", source, [&hash](auto p_first, auto p_last)
+                   { dsaa::merge_sort(p_first, p_last, [&hash](const std::string &p_lhs, const std::string &p_rhs)
+                                      { return hash(p_lhs) < hash(p_rhs); }); });
+    benchmark_sort("sort_by_key 256K strings, hash key", source, [&hash](auto p_first, auto p_last)
+                   { dsaa::sort_by_key(p_first, p_last, hash); });
+
+    // A string key: the lower case copy of the string.
+    auto lower([](const std::string &p_elem)
+               {
+                   std::string result(p_elem);
+                   for (char &c : result)
+                       c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+                   return result; });
+    benchmark_sort("merge_sort 256K strings, lowered in the comparator", source, [&lower](auto p_first, auto p_last)
+                   { dsaa::merge_sort(p_first, p_last, [&lower](const std::string &p_lhs, const std::string &p_rhs)
+                                      { return lower(p_lhs) < lower(p_rhs); }); });
+    benchmark_sort("sort_by_key 256K strings, lower case key", source, [&lower](auto p_first, auto p_last)
+                   { dsaa::sort_by_key(p_first, p_last, lower); });
+}
+
+TEST_CASE("Benchmark counting_sort_by_key on records with an enum key.", "[!benchmark][CountingSortByKey]")
+{
+    struct Record
+    {
+        uint8_t kind;
+        uint32_t id;
+        uint64_t payload;
+    };
+    const int size(1 << 22);
+    const dsaa::DynamicArray<int> kinds(dsaa::random::random_range_ints<int>(size, 0, 15));
+    dsaa::DynamicArray<Record> source;
+    for (int i(0); i != size; ++i)
+        source.insert_last(Record{static_cast<uint8_t>(kinds[i]), static_cast<uint32_t>(i), 0});
+    dsaa::DynamicArray<Record> output(source);
+
+    for (size_t thread_count : {1, 4})
+    {
+        dsaa::ParallelSortOptions options;
+        options.thread_count = thread_count;
+        BENCHMARK("counting_sort_by_key 4M records, 16 keys, " + std::to_string(thread_count) + " threads")
+        {
+            return dsaa::counting_sort_by_key(source.begin(), source.end(), output.begin(), &Record::kind, 16, options) - output.begin();
+        };
+    }
+    benchmark_sort("lsd_radix_sort 4M records, 16 keys", source, [](auto p_first, auto p_last)
+                   { dsaa::lsd_radix_sort(p_first, p_last, &Record::kind); });
+    benchmark_sort("std::stable_sort 4M records, 16 keys", source, [](auto p_first, auto p_last)
+                   { std::stable_sort(p_first, p_last, [](const Record &p_lhs, const Record &p_rhs)
+                                      { return p_lhs.kind < p_rhs.kind; }); });
+}
+
+TEST_CASE("Benchmark bucket_sort on uniform and skewed reals.", "[!benchmark][BucketSort]")
+{
+    const size_t size(1 << 21);
+    const dsaa::DynamicArray<double> uniform(dsaa::random::random_range_reals<double>(size, 0.0, 1.0));
+    dsaa::DynamicArray<double> skewed(dsaa::random::random_range_reals<double>(size, -3.0, 3.0));
+    for (double &value : skewed)
+        value = std::exp(value * value * value);
+
+    benchmark_sort("bucket_sort_uniform_distribution 2M double, uniform", uniform, [](auto p_first, auto p_last)
+                   { dsaa::bucket_sort_uniform_distribution(p_first, p_last); });
+    auto compare_sorts([](const std::string &p_suffix, const dsaa::DynamicArray<double> &p_source)
+                       {
+                           benchmark_sort("bucket_sort 2M double, " + p_suffix, p_source, [](auto p_first, auto p_last)
+                                          { dsaa::bucket_sort(p_first, p_last); });
+                           benchmark_sort("dsaa::sort 2M double, " + p_suffix, p_source, [](auto p_first, auto p_last)
+                                          { dsaa::sort(p_first, p_last); });
+                           benchmark_sort("std::sort 2M double, " + p_suffix, p_source, [](auto p_first, auto p_last)
+                                          { std::sort(p_first, p_last); }); });
+    compare_sorts("uniform", uniform);
+    compare_sorts("skewed", skewed);
+}
+
+TEST_CASE("Benchmark sample_sort against parallel_sort.", "[!benchmark][SampleSort]")
+{
+    const int size(1 << 22);
+    const dsaa::DynamicArray<int> source(sort_input("random", size));
+    const dsaa::DynamicArray<int> duplicates(dsaa::random::random_range_ints<int>(size, 0, 99));
+
+    for (size_t thread_count : {1, 2, 4, 8})
+    {
+        // One pool per thread count, so thread start up is not measured.
+        dsaa::TaskPool pool(thread_count);
+        dsaa::ParallelSortOptions options;
+        options.pool = &pool;
+        const std::string suffix(" 4M int, " + std::to_string(thread_count) + " threads");
+
+        benchmark_sort("sample_sort" + suffix, source, [&options](auto p_first, auto p_last)
+                       { dsaa::sample_sort(p_first, p_last, std::less<int>(), options); });
+        benchmark_sort("parallel_sort" + suffix, source, [&options](auto p_first, auto p_last)
+                       { dsaa::parallel_sort(p_first, p_last, std::less<int>(), options); });
+        benchmark_sort("sample_sort" + suffix + ", 100 values", duplicates, [&options](auto p_first, auto p_last)
+                       { dsaa::sample_sort(p_first, p_last, std::less<int>(), options); });
+        benchmark_sort("parallel_sort" + suffix + ", 100 values", duplicates, [&options](auto p_first, auto p_last)
+                       { dsaa::parallel_sort(p_first, p_last, std::less<int>(), options); });
+    }
+    benchmark_sort("dsaa::sort 4M int", source, [](auto p_first, auto p_last)
+                   { dsaa::sort(p_first, p_last); });
+    benchmark_sort("std::sort 4M int", source, [](auto p_first, auto p_last)
+                   { std::sort(p_first, p_last); });
+}
+
+#endif //!DSAA_BENCHMARK_SORT_H
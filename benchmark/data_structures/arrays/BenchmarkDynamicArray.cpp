@@ -0,0 +1,258 @@
+#ifndef DSAA_BENCHMARK_DYNAMIC_ARRAY_H
+#define DSAA_BENCHMARK_DYNAMIC_ARRAY_H
+
+#include <cstdint>
+
+#include "Catch2/Catch.hpp"
+#include "arrays/DynamicArray.h"
+#include "memory/ReallocAllocator.h"
+#include "lists/SinglyLinkList.h"
+#include "algorithms/Numeric.h"
+#include "algorithms/Sort.h"
+#include "algorithms/Random.h"
+
+namespace
+{
+    // Same payload as uint64_t, but its user-provided move forces the element-by-element relocation path.
+    struct OpaqueU64
+    {
+        uint64_t value;
+
+        OpaqueU64() noexcept : value(0) {}
+        OpaqueU64(uint64_t p_value) noexcept : value(p_value) {}
+        OpaqueU64(const OpaqueU64 &p_other) noexcept : value(p_other.value) {}
+        OpaqueU64(OpaqueU64 &&p_other) noexcept : value(p_other.value) {}
+        OpaqueU64 &operator=(const OpaqueU64 &p_other) noexcept
+        {
+            value = p_other.value;
+            return *this;
+        }
+        OpaqueU64 &operator=(OpaqueU64 &&p_other) noexcept
+        {
+            value = p_other.value;
+            return *this;
+        }
+        ~OpaqueU64() {}
+    };
+
+    // The iterator layout DynamicArray had before it was devirtualized: a pointer behind a vtable.
+    class PolymorphicIterator
+    {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = int;
+        using difference_type = std::ptrdiff_t;
+        using pointer = int *;
+        using reference = int &;
+
+        PolymorphicIterator(int *p_pointer) noexcept : m_pointer(p_pointer) {}
+        PolymorphicIterator(const PolymorphicIterator &p_iterator) noexcept : m_pointer(p_iterator.m_pointer) {}
+        PolymorphicIterator &operator=(const PolymorphicIterator &p_iterator) noexcept
+        {
+            m_pointer = p_iterator.m_pointer;
+            return *this;
+        }
+        virtual ~PolymorphicIterator() {}
+
+        bool operator==(const PolymorphicIterator &p_iterator) const noexcept { return m_pointer == p_iterator.m_pointer; }
+        bool operator!=(const PolymorphicIterator &p_iterator) const noexcept { return m_pointer != p_iterator.m_pointer; }
+        PolymorphicIterator &operator++() noexcept
+        {
+            ++m_pointer;
+            return *this;
+        }
+        PolymorphicIterator &operator--() noexcept
+        {
+            --m_pointer;
+            return *this;
+        }
+        int &operator*() const noexcept { return *m_pointer; }
+
+    private:
+        int *m_pointer;
+    };
+
+    template <typename Elem>
+    dsaa::DynamicArray<Elem> make_sequence(size_t p_size)
+    {
+        dsaa::DynamicArray<Elem> result;
+        for (size_t i(0); i != p_size; ++i)
+            result.insert_last(Elem(i));
+        return result;
+    }
+
+    template <typename Elem>
+    void benchmark_reserve(const char *p_name, size_t p_size)
+    {
+        const dsaa::DynamicArray<Elem> source(make_sequence<Elem>(p_size));
+        BENCHMARK_ADVANCED(p_name)(Catch::Benchmark::Chronometer meter)
+        {
+            std::vector<dsaa::DynamicArray<Elem>> arrays(meter.runs(), source);
+            meter.measure([&](int i)
+                          { arrays[i].reserve(2 * p_size); return arrays[i].capacity(); });
+        };
+    }
+
+    template <typename Elem>
+    void benchmark_insert_front(const char *p_name, size_t p_size)
+    {
+        BENCHMARK(p_name)
+        {
+            dsaa::DynamicArray<Elem> arr;
+            for (size_t i(0); i != p_size; ++i)
+                arr.insert_at(arr.cbegin(), Elem(i));
+            return arr.size();
+        };
+    }
+}
+
+TEST_CASE("Benchmark DynamicArray reserve relocation.", "[!benchmark][DynamicArray]")
+{
+    benchmark_reserve<uint64_t>("reserve 1M uint64_t (memcpy)", 1 << 20);
+    benchmark_reserve<OpaqueU64>("reserve 1M OpaqueU64 (move + destroy)", 1 << 20);
+}
+
+TEST_CASE("Benchmark DynamicArray insert_last growth.", "[!benchmark][DynamicArray]")
+{
+    BENCHMARK("insert_last 1M uint64_t (memcpy)")
+    {
+        return make_sequence<uint64_t>(1 << 20).size();
+    };
+    BENCHMARK("insert_last 1M OpaqueU64 (move + destroy)")
+    {
+        return make_sequence<OpaqueU64>(1 << 20).size();
+    };
+}
+
+TEST_CASE("Benchmark DynamicArray growth with in place reallocation.", "[!benchmark][DynamicArray]")
+{
+    BENCHMARK("insert_last 16M uint64_t std::allocator")
+    {
+        return make_sequence<uint64_t>(1 << 24).size();
+    };
+    BENCHMARK("insert_last 16M uint64_t ReallocAllocator (mremap)")
+    {
+        dsaa::DynamicArray<uint64_t, dsaa::ReallocAllocator<uint64_t>> arr;
+        for (size_t i(0); i != (1 << 24); ++i)
+            arr.insert_last(i);
+        return arr.size();
+    };
+}
+
+TEST_CASE("Benchmark DynamicArray front insertion.", "[!benchmark][DynamicArray]")
+{
+    benchmark_insert_front<uint64_t>("insert_at front 20K uint64_t (memmove)", 20000);
+    benchmark_insert_front<OpaqueU64>("insert_at front 20K OpaqueU64 (move + destroy)", 20000);
+}
+
+TEST_CASE("Benchmark DynamicArray scratch buffer construction.", "[!benchmark][DynamicArray]")
+{
+    BENCHMARK("construct and fill 16M uint64_t, value-initialized")
+    {
+        dsaa::DynamicArray<uint64_t> arr(1 << 24);
+        for (size_t i(0); i != arr.size(); ++i)
+            arr[i] = i;
+        return arr.last();
+    };
+    BENCHMARK("construct and fill 16M uint64_t, dsaa::default_init")
+    {
+        dsaa::DynamicArray<uint64_t> arr(1 << 24, dsaa::default_init);
+        for (size_t i(0); i != arr.size(); ++i)
+            arr[i] = i;
+        return arr.last();
+    };
+}
+
+TEST_CASE("Benchmark DynamicArray batch appends.", "[!benchmark][DynamicArray]")
+{
+    // One tick: 4096 small sources of 1 to 64 elements each.
+    dsaa::DynamicArray<dsaa::DynamicArray<uint64_t>> sources;
+    size_t total(0);
+    for (size_t i(0); i != 4096; ++i)
+    {
+        sources.insert_last(dsaa::DynamicArray<uint64_t>(dsaa::random::random_range_int<size_t>(1, 64), i));
+        total += sources.last().size();
+    }
+
+    BENCHMARK("append 4096 sources, insert_last per element")
+    {
+        dsaa::DynamicArray<uint64_t> arr;
+        for (auto source(sources.begin()); source != sources.end(); ++source)
+            for (auto i((*source).begin()); i != (*source).end(); ++i)
+                arr.insert_last(*i);
+        return arr.size();
+    };
+    BENCHMARK("append 4096 sources, insert_last per source")
+    {
+        dsaa::DynamicArray<uint64_t> arr;
+        for (auto source(sources.begin()); source != sources.end(); ++source)
+            arr.insert_last((*source).begin(), (*source).end());
+        return arr.size();
+    };
+    BENCHMARK("append 4096 sources, append_builder")
+    {
+        dsaa::DynamicArray<uint64_t> arr;
+        auto builder(arr.append_builder(total));
+        for (auto source(sources.begin()); source != sources.end(); ++source)
+            builder.insert_last_unchecked((*source).begin(), (*source).end());
+        builder.commit();
+        return arr.size();
+    };
+
+    dsaa::SinglyLinkList<uint64_t> big_list;
+    for (uint64_t i(0); i != 1 << 20; ++i)
+        big_list.insert_last(i);
+    BENCHMARK("copy 1M element SinglyLinkList, insert_last(first, last)")
+    {
+        dsaa::DynamicArray<uint64_t> arr;
+        arr.insert_last(big_list.begin(), big_list.end());
+        return arr.size();
+    };
+    BENCHMARK("copy 1M element SinglyLinkList, append_from")
+    {
+        dsaa::DynamicArray<uint64_t> arr;
+        arr.append_from(big_list);
+        return arr.size();
+    };
+}
+
+TEST_CASE("Benchmark DynamicArray iterators against raw pointers.", "[!benchmark][DynamicArray]")
+{
+    const dsaa::DynamicArray<int> numbers(dsaa::random::random_range_ints<int>(1 << 24, -100, 100));
+    dsaa::DynamicArray<int> arr(numbers);
+
+    BENCHMARK("accumulate 16M int, raw pointer")
+    {
+        return dsaa::accumulate(arr.data(), arr.data() + arr.size(), int64_t(0));
+    };
+    BENCHMARK("accumulate 16M int, DynamicArray::iterator")
+    {
+        return dsaa::accumulate(arr.begin(), arr.end(), int64_t(0));
+    };
+    BENCHMARK("accumulate 16M int, polymorphic iterator")
+    {
+        return dsaa::accumulate(PolymorphicIterator(arr.data()), PolymorphicIterator(arr.data() + arr.size()), int64_t(0));
+    };
+
+    const dsaa::DynamicArray<int> unsorted(numbers.begin(), numbers.begin() + 4096);
+    BENCHMARK_ADVANCED("insertion_sort 4K int, raw pointer")(Catch::Benchmark::Chronometer meter)
+    {
+        std::vector<dsaa::DynamicArray<int>> arrays(meter.runs(), unsorted);
+        meter.measure([&](int i)
+                      { return dsaa::insertion_sort(arrays[i].data(), arrays[i].data() + arrays[i].size()); });
+    };
+    BENCHMARK_ADVANCED("insertion_sort 4K int, DynamicArray::iterator")(Catch::Benchmark::Chronometer meter)
+    {
+        std::vector<dsaa::DynamicArray<int>> arrays(meter.runs(), unsorted);
+        meter.measure([&](int i)
+                      { return dsaa::insertion_sort(arrays[i].begin(), arrays[i].end()); });
+    };
+    BENCHMARK_ADVANCED("insertion_sort 4K int, polymorphic iterator")(Catch::Benchmark::Chronometer meter)
+    {
+        std::vector<dsaa::DynamicArray<int>> arrays(meter.runs(), unsorted);
+        meter.measure([&](int i)
+                      { return *dsaa::insertion_sort(PolymorphicIterator(arrays[i].data()), PolymorphicIterator(arrays[i].data() + arrays[i].size())); });
+    };
+}
+
+#endif //!DSAA_BENCHMARK_DYNAMIC_ARRAY_H
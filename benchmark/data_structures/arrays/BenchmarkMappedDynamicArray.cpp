@@ -0,0 +1,44 @@
+#ifndef DSAA_BENCHMARK_MAPPED_ARRAY_H
+#define DSAA_BENCHMARK_MAPPED_ARRAY_H
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+
+#include "Catch2/Catch.hpp"
+#include "arrays/DynamicArray.h"
+#include "arrays/MappedDynamicArray.h"
+
+TEST_CASE("Benchmark MappedDynamicArray reopening.", "[!benchmark][MappedDynamicArray]")
+{
+    const size_t size(1 << 24);
+    const std::string mapped_path((std::filesystem::temp_directory_path() / "dsaa_benchmark_mapped.bin").string());
+    const std::string stream_path((std::filesystem::temp_directory_path() / "dsaa_benchmark_stream.bin").string());
+    {
+        dsaa::MappedDynamicArray<uint64_t> arr(mapped_path, dsaa::MappedMode::truncate);
+        arr.reserve(size);
+        for (size_t i(0); i != size; ++i)
+            arr.insert_last(i);
+
+        std::ofstream stream(stream_path, std::ios::binary | std::ios::trunc);
+        stream.write(reinterpret_cast<const char *>(arr.data()), size * sizeof(uint64_t));
+    }
+
+    BENCHMARK("reopen 16M uint64_t, MappedDynamicArray")
+    {
+        dsaa::MappedDynamicArray<uint64_t> arr(mapped_path);
+        return arr[size / 2];
+    };
+    BENCHMARK("reopen 16M uint64_t, read into DynamicArray")
+    {
+        std::ifstream stream(stream_path, std::ios::binary);
+        dsaa::DynamicArray<uint64_t> arr(size, dsaa::default_init);
+        stream.read(reinterpret_cast<char *>(arr.data()), size * sizeof(uint64_t));
+        return arr[size / 2];
+    };
+
+    std::filesystem::remove(mapped_path);
+    std::filesystem::remove(stream_path);
+}
+
+#endif //!DSAA_BENCHMARK_MAPPED_ARRAY_H
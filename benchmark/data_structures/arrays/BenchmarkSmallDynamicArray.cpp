@@ -0,0 +1,87 @@
+#ifndef DSAA_BENCHMARK_SMALL_ARRAY_H
+#define DSAA_BENCHMARK_SMALL_ARRAY_H
+
+#include <memory>
+
+#include "Catch2/Catch.hpp"
+#include "arrays/DynamicArray.h"
+#include "arrays/SmallDynamicArray.h"
+#include "algorithms/Sort.h"
+#include "algorithms/Random.h"
+
+namespace
+{
+    inline size_t allocations(0);
+
+    // std::allocator that counts the calls to allocate.
+    template <typename Elem>
+    struct CountingAllocator : std::allocator<Elem>
+    {
+        template <typename Other>
+        struct rebind
+        {
+            using other = CountingAllocator<Other>;
+        };
+
+        CountingAllocator() noexcept = default;
+        template <typename Other>
+        CountingAllocator(const CountingAllocator<Other> &) noexcept {}
+
+        Elem *allocate(size_t p_size)
+        {
+            ++allocations;
+            return std::allocator<Elem>::allocate(p_size);
+        }
+    };
+
+    // The distribution and sorting steps of bucket_sort_uniform_distribution, with the bucket type as a parameter.
+    template <typename Bucket>
+    size_t bucket_sort(dsaa::DynamicArray<double> &p_arr)
+    {
+        const size_t arr_size(p_arr.size());
+        dsaa::DynamicArray<Bucket> buckets(arr_size);
+        for (auto &i : p_arr)
+            buckets[static_cast<size_t>(arr_size * i)].insert_last(i);
+
+        auto first(p_arr.begin());
+        for (auto &bucket : buckets)
+        {
+            dsaa::insertion_sort(bucket.begin(), bucket.end(), std::less<double>());
+            for (auto &i : bucket)
+                *first++ = i;
+        }
+        return arr_size;
+    }
+
+    template <typename Bucket>
+    void benchmark_bucket_sort(const char *p_name, const dsaa::DynamicArray<double> &p_source)
+    {
+        dsaa::DynamicArray<double> arr(p_source);
+        allocations = 0;
+        bucket_sort<Bucket>(arr);
+        WARN(p_name << ": " << allocations << " bucket allocations for " << arr.size() << " elements.");
+
+        BENCHMARK_ADVANCED(p_name)(Catch::Benchmark::Chronometer meter)
+        {
+            std::vector<dsaa::DynamicArray<double>> arrays(meter.runs(), p_source);
+            meter.measure([&](int i)
+                          { return bucket_sort<Bucket>(arrays[i]); });
+        };
+    }
+}
+
+TEST_CASE("Benchmark bucket sort with DynamicArray and SmallDynamicArray buckets.", "[!benchmark][SmallDynamicArray]")
+{
+    const dsaa::DynamicArray<double> source(dsaa::random::random_range_reals<double>(1 << 18, 0.0, 0.999));
+
+    benchmark_bucket_sort<dsaa::DynamicArray<double, CountingAllocator<double>>>("bucket sort 256K, DynamicArray buckets", source);
+    benchmark_bucket_sort<dsaa::SmallDynamicArray<double, 4, CountingAllocator<double>>>("bucket sort 256K, SmallDynamicArray<4> buckets", source);
+    BENCHMARK_ADVANCED("bucket sort 256K, dsaa::bucket_sort_uniform_distribution")(Catch::Benchmark::Chronometer meter)
+    {
+        std::vector<dsaa::DynamicArray<double>> arrays(meter.runs(), source);
+        meter.measure([&](int i)
+                      { return dsaa::bucket_sort_uniform_distribution(arrays[i].begin(), arrays[i].end()) - arrays[i].begin(); });
+    };
+}
+
+#endif //!DSAA_BENCHMARK_SMALL_ARRAY_H
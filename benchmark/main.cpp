@@ -0,0 +1,18 @@
+#define CATCH_CONFIG_RUNNER
+#include "Catch2/Catch.hpp"
+
+int main(int argc, char *argv[])
+{
+    int result(0);
+    // global setup...
+    {
+        result = Catch::Session().run(argc, argv);
+    }
+
+    // global clean-up...
+
+    return result;
+}
+
+// Benchmarks are Catch2 test cases tagged [!benchmark]; build them with `scons target=benchmark build=release`.
+// CATCH_CONFIG_ENABLE_BENCHMARKING is defined by SConstruct for every translation unit of this target.
@@ -0,0 +1,129 @@
+#ifndef DSAA_BENCHMARK_ALLOCATORS_H
+#define DSAA_BENCHMARK_ALLOCATORS_H
+
+#include "Catch2/Catch.hpp"
+#include "memory/ArenaAllocator.h"
+#include "memory/PoolAllocator.h"
+#include "lists/SinglyLinkList.h"
+#include "binary_trees/RedBlackTree.h"
+#include "Queue.h"
+#include "algorithms/Random.h"
+
+TEST_CASE("Benchmark node containers with arena and pool allocators.", "[!benchmark][Allocators]")
+{
+    const int size(100000);
+    dsaa::DynamicArray<int> values(dsaa::random::random_range_ints<int>(size));
+    dsaa::MonotonicArena arena;
+
+    SECTION("SinglyLinkList")
+    {
+        using Node = dsaa::SinglyLinkListNode<int>;
+        dsaa::BlockPool pool(sizeof(Node), alignof(Node), 4096);
+
+        BENCHMARK("build and destroy 100000 elements, std::allocator")
+        {
+            dsaa::SinglyLinkList<int> list;
+            for (int i(0); i != size; ++i)
+                list.insert_last(i);
+            return list.size();
+        };
+        BENCHMARK("build and destroy 100000 elements, ArenaAllocator")
+        {
+            size_t result;
+            {
+                dsaa::SinglyLinkList<int, dsaa::ArenaAllocator<Node>> list(arena);
+                for (int i(0); i != size; ++i)
+                    list.insert_last(i);
+                result = list.size();
+            }
+            arena.reset();
+            return result;
+        };
+        BENCHMARK("build and destroy 100000 elements, PoolAllocator")
+        {
+            size_t result;
+            {
+                dsaa::SinglyLinkList<int, dsaa::PoolAllocator<Node>> list(pool);
+                for (int i(0); i != size; ++i)
+                    list.insert_last(i);
+                result = list.size();
+            }
+            pool.reset();
+            return result;
+        };
+    }
+
+    SECTION("RedBlackTree")
+    {
+        using Node = dsaa::RedBlackTreeNode<int>;
+        dsaa::BlockPool pool(sizeof(Node), alignof(Node), 4096);
+
+        BENCHMARK("insert 100000 random elements, std::allocator")
+        {
+            dsaa::RedBlackTree<int> tree;
+            for (auto i(values.begin()); i != values.end(); ++i)
+                tree.insert(*i);
+            return tree.size();
+        };
+        BENCHMARK("insert 100000 random elements, ArenaAllocator")
+        {
+            size_t result;
+            {
+                dsaa::RedBlackTree<int, dsaa::ArenaAllocator<Node>> tree(arena);
+                for (auto i(values.begin()); i != values.end(); ++i)
+                    tree.insert(*i);
+                result = tree.size();
+            }
+            arena.reset();
+            return result;
+        };
+        BENCHMARK("insert 100000 random elements, PoolAllocator")
+        {
+            size_t result;
+            {
+                dsaa::RedBlackTree<int, dsaa::PoolAllocator<Node>> tree(pool);
+                for (auto i(values.begin()); i != values.end(); ++i)
+                    tree.insert(*i);
+                result = tree.size();
+            }
+            pool.reset();
+            return result;
+        };
+    }
+
+    SECTION("Queue")
+    {
+        using Node = dsaa::QueueNode<int>;
+        dsaa::BlockPool pool(sizeof(Node), alignof(Node));
+
+        // A steady state queue, every extracted node is recycled by the next insert.
+        BENCHMARK("100000 inserts and extracts on 1000 elements, std::allocator")
+        {
+            dsaa::Queue<int> queue;
+            for (int i(0); i != 1000; ++i)
+                queue.insert(i);
+            int sum(0);
+            for (int i(0); i != size; ++i)
+            {
+                sum += queue.extract();
+                queue.insert(i);
+            }
+            return sum;
+        };
+        BENCHMARK("100000 inserts and extracts on 1000 elements, PoolAllocator")
+        {
+            dsaa::Queue<int, dsaa::PoolAllocator<Node>> queue(pool);
+            for (int i(0); i != 1000; ++i)
+                queue.insert(i);
+            int sum(0);
+            for (int i(0); i != size; ++i)
+            {
+                sum += queue.extract();
+                queue.insert(i);
+            }
+            return sum;
+        };
+    }
+}
+
+#endif //!DSAA_BENCHMARK_ALLOCATORS_H
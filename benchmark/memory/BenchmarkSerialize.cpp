@@ -0,0 +1,45 @@
+#ifndef DSAA_BENCHMARK_SERIALIZE_H
+#define DSAA_BENCHMARK_SERIALIZE_H
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+
+#include "Catch2/Catch.hpp"
+#include "memory/Serialize.h"
+
+TEST_CASE("Benchmark DynamicArray save and load.", "[!benchmark][Serialize]")
+{
+    const size_t size(1 << 22);
+    const std::string path((std::filesystem::temp_directory_path() / "dsaa_benchmark_serialize.bin").string());
+    dsaa::DynamicArray<uint64_t> source(size, dsaa::default_init);
+    for (size_t i(0); i != size; ++i)
+        source[i] = i * 2654435761u;
+    dsaa::save(path, source);
+
+    BENCHMARK("load 4M uint64_t, element by element")
+    {
+        std::ifstream stream(path, std::ios::binary);
+        stream.seekg(dsaa::BinaryHeader::header_size);
+        dsaa::DynamicArray<uint64_t> arr;
+        uint64_t value;
+        while (stream.read(reinterpret_cast<char *>(&value), sizeof(value)))
+            arr.insert_last(value);
+        return arr.size();
+    };
+    BENCHMARK("load 4M uint64_t, dsaa::load")
+    {
+        dsaa::DynamicArray<uint64_t> arr;
+        dsaa::load(path, arr);
+        return arr.size();
+    };
+    BENCHMARK("load 4M uint64_t, dsaa::MappedView")
+    {
+        dsaa::MappedView<uint64_t> view(path);
+        return view[size / 2];
+    };
+
+    std::filesystem::remove(path);
+}
+
+#endif //!DSAA_BENCHMARK_SERIALIZE_H
@@ -0,0 +1,376 @@
+// Sort benchmark suite: runs every sort of Sort.h, the parallel and SIMD sorts and std::sort as a baseline over the
+// standard input distributions and prints one CSV row per algorithm, distribution and size to the standard output.
+// Build it with `scons target=sort_benchmark build=release`.
+//
+// Options:
+//   --min-size N, --max-size N  sizes are the powers of ten in between, 1e2 to 1e6 by default and up to 1e8.
+//   --quadratic-limit N         largest size given to the sorts that are quadratic in the worst case, 1e4 by default.
+//   --repetitions N             timed repetitions, the best one is reported. 3 by default.
+//   --seed N                    seed of the inputs.
+//   --algorithm NAME, --distribution NAME  run only those, both may be repeated.
+//
+// Columns: ns_per_element is the best repetition on int keys in [0, size). comparisons, moves and swaps are counted on one
+// more run with dsaa::CountedElement keys: calls to a comparison operator, constructions and assignments of a key from
+// another key, and swaps found by argument dependent lookup. They are n/a for the sorts that only take arithmetic keys.
+// allocations and allocated_bytes are the calls to the global operator new during that run and the bytes they asked for,
+// measured for every sort.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <new>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "algorithms/Counting.h"
+#include "algorithms/Sort.h"
+#include "algorithms/ParallelSort.h"
+#include "algorithms/SimdSort.h"
+#include "arrays/DynamicArray.h"
+
+namespace
+{
+    std::atomic<size_t> g_allocations(0);
+    std::atomic<size_t> g_allocated_bytes(0);
+
+    using IntArray = dsaa::DynamicArray<int>;
+    using CountedArray = dsaa::DynamicArray<dsaa::CountedElement<int, true>>;
+
+    struct Counts
+    {
+        // Empty when the sort does not take instrumented keys.
+        std::optional<size_t> comparisons;
+        std::optional<size_t> moves;
+        std::optional<size_t> swaps;
+        size_t allocations;
+        size_t allocated_bytes;
+    };
+
+    struct Algorithm
+    {
+        std::string name;
+        // Worst case quadratic, so limited to --quadratic-limit elements.
+        bool quadratic;
+        // Returns the best time per element of p_repetitions runs on p_input.
+        std::function<double(const IntArray &p_input, size_t p_repetitions)> time;
+        // Returns the counts of one run on p_input.
+        std::function<Counts(const IntArray &p_input)> count;
+    };
+
+    template <typename Array, typename Sort>
+    double time_sort(const Array &p_input, Sort &p_sort, size_t p_repetitions, const std::string &p_name)
+    {
+        // Fast sorts are run several times per measurement, so that each one lasts about a millisecond and the clock
+        // resolution does not matter. The number of runs is doubled until then.
+        const size_t size(p_input.size());
+        double best(INFINITY);
+        for (size_t repetition(0), runs(1); repetition != p_repetitions;)
+        {
+            std::vector<Array> arrays(runs, p_input);
+            const auto start(std::chrono::steady_clock::now());
+            for (Array &array : arrays)
+                p_sort(array.begin(), array.end());
+            const std::chrono::duration<double, std::nano> elapsed(std::chrono::steady_clock::now() - start);
+
+            for (const Array &array : arrays)
+                if (!std::is_sorted(array.begin(), array.end()))
+                {
+                    std::cerr << p_name << " did not sort " << size << " elements.\n";
+                    std::exit(EXIT_FAILURE);
+                }
+            if (elapsed.count() < 1e6 && runs * size < (size_t(1) << 24))
+            {
+                runs *= 2;
+                continue;
+            }
+            best = std::min(best, elapsed.count() / static_cast<double>(runs * std::max<size_t>(size, 1)));
+            ++repetition;
+        }
+        return best;
+    }
+
+    // Runs p_sort once on p_array and returns the allocations it made, after resetting the operation counter.
+    template <typename Array, typename Sort>
+    Counts count_sort(Array &p_array, Sort &p_sort)
+    {
+        Counts result{};
+        dsaa::operation_counter.reset();
+        const size_t allocations(g_allocations.load()), allocated_bytes(g_allocated_bytes.load());
+        p_sort(p_array.begin(), p_array.end());
+        result.allocations = g_allocations.load() - allocations;
+        result.allocated_bytes = g_allocated_bytes.load() - allocated_bytes;
+        return result;
+    }
+
+    // A sort taking any key type with operator<.
+    template <typename Sort>
+    Algorithm generic_sort(std::string p_name, bool p_quadratic, Sort p_sort)
+    {
+        Algorithm result{p_name, p_quadratic, nullptr, nullptr};
+        result.time = [p_sort, p_name](const IntArray &p_input, size_t p_repetitions) mutable
+        { return time_sort(p_input, p_sort, p_repetitions, p_name); };
+        result.count = [p_sort](const IntArray &p_input) mutable
+        {
+            CountedArray array(p_input.begin(), p_input.end());
+            Counts result(count_sort(array, p_sort));
+            const dsaa::OperationCounts counts(dsaa::operation_counter.counts());
+            result.comparisons = counts.comparisons;
+            result.moves = counts.copies + counts.moves + counts.assignments;
+            result.swaps = counts.swaps;
+            return result;
+        };
+        return result;
+    }
+
+    // A sort taking only arithmetic keys.
+    template <typename Sort>
+    Algorithm int_sort(std::string p_name, Sort p_sort)
+    {
+        Algorithm result{p_name, false, nullptr, nullptr};
+        result.time = [p_sort, p_name](const IntArray &p_input, size_t p_repetitions) mutable
+        { return time_sort(p_input, p_sort, p_repetitions, p_name); };
+        result.count = [p_sort](const IntArray &p_input) mutable
+        {
+            IntArray array(p_input);
+            return count_sort(array, p_sort);
+        };
+        return result;
+    }
+
+    std::vector<Algorithm> algorithms()
+    {
+        std::vector<Algorithm> result;
+        result.push_back(generic_sort("buble_sort", true, [](auto p_first, auto p_last)
+                                      { dsaa::buble_sort(p_first, p_last); }));
+        result.push_back(generic_sort("selection_sort", true, [](auto p_first, auto p_last)
+                                      { dsaa::selection_sort(p_first, p_last); }));
+        result.push_back(generic_sort("insertion_sort", true, [](auto p_first, auto p_last)
+                                      { dsaa::insertion_sort(p_first, p_last); }));
+        result.push_back(generic_sort("merge_sort", false, [](auto p_first, auto p_last)
+                                      { dsaa::merge_sort(p_first, p_last); }));
+        result.push_back(generic_sort("bottom_up_merge_sort", false, [](auto p_first, auto p_last)
+                                      { dsaa::bottom_up_merge_sort(p_first, p_last); }));
+        result.push_back(generic_sort("tim_sort", false, [](auto p_first, auto p_last)
+                                      { dsaa::tim_sort(p_first, p_last); }));
+        result.push_back(generic_sort("heap_sort", false, [](auto p_first, auto p_last)
+                                      {
+                                          dsaa::build_heap(p_first, p_last);
+                                          dsaa::sort_heap(p_first, p_last); }));
+        result.push_back(generic_sort("lomuto_quick_sort", true, [](auto p_first, auto p_last)
+                                      { dsaa::lomuto_quick_sort(p_first, p_last); }));
+        result.push_back(generic_sort("hoare_quick_sort", true, [](auto p_first, auto p_last)
+                                      { dsaa::hoare_quick_sort(p_first, p_last); }));
+        result.push_back(generic_sort("tail_lomuto_quick_sort", true, [](auto p_first, auto p_last)
+                                      { dsaa::tail_lomuto_quick_sort(p_first, p_last); }));
+        result.push_back(generic_sort("tail_hoare_quick_sort", true, [](auto p_first, auto p_last)
+                                      { dsaa::tail_hoare_quick_sort(p_first, p_last); }));
+        result.push_back(generic_sort("randomized_lomuto_quick_sort", true, [](auto p_first, auto p_last)
+                                      { dsaa::randomized_lomuto_quick_sort(p_first, p_last); }));
+        result.push_back(generic_sort("randomized_hoare_quick_sort", true, [](auto p_first, auto p_last)
+                                      { dsaa::randomized_hoare_quick_sort(p_first, p_last); }));
+        result.push_back(generic_sort("randomized_tail_lomuto_quick_sort", true, [](auto p_first, auto p_last)
+                                      { dsaa::randomized_tail_lomuto_quick_sort(p_first, p_last); }));
+        result.push_back(generic_sort("randomized_tail_hoare_quick_sort", true, [](auto p_first, auto p_last)
+                                      { dsaa::randomized_tail_hoare_quick_sort(p_first, p_last); }));
+        result.push_back(generic_sort("dsaa::sort", false, [](auto p_first, auto p_last)
+                                      { dsaa::sort(p_first, p_last); }));
+        result.push_back(generic_sort("parallel_sort", false, [](auto p_first, auto p_last)
+                                      { dsaa::parallel_sort(p_first, p_last); }));
+        result.push_back(generic_sort("parallel_merge_sort", false, [](auto p_first, auto p_last)
+                                      { dsaa::parallel_merge_sort(p_first, p_last); }));
+        result.push_back(generic_sort("bucket_sort", false, [](auto p_first, auto p_last)
+                                      { dsaa::bucket_sort(p_first, p_last); }));
+        result.push_back(generic_sort("sample_sort", false, [](auto p_first, auto p_last)
+                                      { dsaa::sample_sort(p_first, p_last); }));
+        result.push_back(int_sort("counting_sort", [](auto p_first, auto p_last)
+                                  { dsaa::counting_sort(p_first, p_last); }));
+        result.push_back(int_sort("radix_sort", [](auto p_first, auto p_last)
+                                  { dsaa::radix_sort(p_first, p_last); }));
+        result.push_back(int_sort("lsd_radix_sort", [](auto p_first, auto p_last)
+                                  { dsaa::lsd_radix_sort(p_first, p_last); }));
+        result.push_back(int_sort("simd_sort", [](auto p_first, auto p_last)
+                                  { dsaa::simd_sort(p_first, p_last); }));
+
+        // Takes reals in [0, 1), the keys are scaled down before the clock starts.
+        auto reals_of([](const IntArray &p_input)
+                      {
+                          dsaa::DynamicArray<double> reals;
+                          reals.reserve(p_input.size());
+                          for (int value : p_input)
+                              reals.insert_last((value + 0.5) / static_cast<double>(p_input.size()));
+                          return reals; });
+        auto bucket_sort_reals([](auto p_first, auto p_last)
+                               { dsaa::bucket_sort_uniform_distribution(p_first, p_last); });
+        Algorithm bucket{"bucket_sort_uniform_distribution", false, nullptr, nullptr};
+        bucket.time = [reals_of, bucket_sort_reals](const IntArray &p_input, size_t p_repetitions) mutable
+        {
+            const dsaa::DynamicArray<double> reals(reals_of(p_input));
+            return time_sort(reals, bucket_sort_reals, p_repetitions, "bucket_sort_uniform_distribution");
+        };
+        bucket.count = [reals_of, bucket_sort_reals](const IntArray &p_input) mutable
+        {
+            dsaa::DynamicArray<double> reals(reals_of(p_input));
+            return count_sort(reals, bucket_sort_reals);
+        };
+        result.push_back(bucket);
+
+        result.push_back(generic_sort("std::sort", false, [](auto p_first, auto p_last)
+                                      { std::sort(p_first, p_last); }));
+        result.push_back(generic_sort("std::stable_sort", false, [](auto p_first, auto p_last)
+                                      { std::stable_sort(p_first, p_last); }));
+        return result;
+    }
+
+    const char *const g_distributions[] = {"random", "sorted", "reversed", "sawtooth", "few-unique", "zipf"};
+
+    // Returns p_size keys in [0, p_size) of the distribution p_shape.
+    IntArray make_input(const std::string &p_shape, size_t p_size, std::mt19937_64 &p_engine)
+    {
+        IntArray result(p_size, dsaa::default_init);
+        const int size(static_cast<int>(p_size));
+        if (p_shape == "random")
+        {
+            std::uniform_int_distribution<int> distribution(0, size - 1);
+            for (int &value : result)
+                value = distribution(p_engine);
+        }
+        else if (p_shape == "sorted" || p_shape == "reversed")
+        {
+            for (int i(0); i != size; ++i)
+                result[i] = p_shape == "sorted" ? i : size - 1 - i;
+        }
+        else if (p_shape == "sawtooth")
+        {
+            // Ascending runs of about sqrt(n) keys.
+            const int tooth(std::max(1, static_cast<int>(std::sqrt(static_cast<double>(size)))));
+            for (int i(0); i != size; ++i)
+                result[i] = (i % tooth) * (size / tooth);
+        }
+        else if (p_shape == "few-unique")
+        {
+            std::uniform_int_distribution<int> distribution(0, 15);
+            for (int &value : result)
+                value = distribution(p_engine) * (size / 16);
+        }
+        else
+        {
+            // Zipf with exponent 1 over up to 2^20 ranks, spread over [0, n) by a multiplicative hash.
+            const size_t universe(std::min<size_t>(p_size, size_t(1) << 20));
+            std::vector<double> cumulative(universe);
+            double sum(0.0);
+            for (size_t rank(0); rank != universe; ++rank)
+                cumulative[rank] = sum += 1.0 / static_cast<double>(rank + 1);
+            std::uniform_real_distribution<double> distribution(0.0, sum);
+            for (int &value : result)
+            {
+                const size_t rank(static_cast<size_t>(std::lower_bound(cumulative.begin(), cumulative.end(), distribution(p_engine)) - cumulative.begin()));
+                value = static_cast<int>((std::min(rank, universe - 1) * 2654435761u) % p_size);
+            }
+        }
+        return result;
+    }
+
+    // Prints p_count, or n/a when it could not be measured.
+    void print_count(const std::optional<size_t> &p_count)
+    {
+        if (p_count)
+            std::cout << *p_count;
+        else
+            std::cout << "n/a";
+    }
+
+    bool selected(const std::vector<std::string> &p_selection, const std::string &p_name)
+    {
+        return p_selection.empty() || std::find(p_selection.begin(), p_selection.end(), p_name) != p_selection.end();
+    }
+}
+
+// The replacements are not inlined so that the compiler does not pair an inlined free with a new expression.
+[[gnu::noinline]] void *operator new(std::size_t p_size)
+{
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    g_allocated_bytes.fetch_add(p_size, std::memory_order_relaxed);
+    if (void *result = std::malloc(p_size ? p_size : 1))
+        return result;
+    throw std::bad_alloc();
+}
+
+[[gnu::noinline]] void operator delete(void *p_pointer) noexcept
+{
+    std::free(p_pointer);
+}
+
+[[gnu::noinline]] void operator delete(void *p_pointer, std::size_t) noexcept
+{
+    std::free(p_pointer);
+}
+
+int main(int argc, char *argv[])
+{
+    size_t min_size(100), max_size(1000000), quadratic_limit(10000), repetitions(3);
+    uint64_t seed(20240101);
+    std::vector<std::string> algorithm_selection, distribution_selection;
+    for (int i(1); i < argc; ++i)
+    {
+        const std::string option(argv[i]);
+        if (i + 1 == argc)
+        {
+            std::cerr << "Missing value of " << option << ".\n";
+            return EXIT_FAILURE;
+        }
+        const std::string value(argv[++i]);
+        if (option == "--min-size")
+            min_size = static_cast<size_t>(std::stod(value));
+        else if (option == "--max-size")
+            max_size = static_cast<size_t>(std::stod(value));
+        else if (option == "--quadratic-limit")
+            quadratic_limit = static_cast<size_t>(std::stod(value));
+        else if (option == "--repetitions")
+            repetitions = std::max<size_t>(1, std::stoul(value));
+        else if (option == "--seed")
+            seed = std::stoull(value);
+        else if (option == "--algorithm")
+            algorithm_selection.push_back(value);
+        else if (option == "--distribution")
+            distribution_selection.push_back(value);
+        else
+        {
+            std::cerr << "Unknown option " << option << ".\n";
+            return EXIT_FAILURE;
+        }
+    }
+
+    const std::vector<Algorithm> suite(algorithms());
+    std::cout << "algorithm,distribution,size,ns_per_element,comparisons,moves,swaps,allocations,allocated_bytes\n";
+    for (size_t size(min_size); size <= max_size; size *= 10)
+        for (const char *distribution : g_distributions)
+        {
+            if (!selected(distribution_selection, distribution))
+                continue;
+            std::mt19937_64 engine(seed + size);
+            const IntArray input(make_input(distribution, size, engine));
+            for (const Algorithm &algorithm : suite)
+            {
+                if (!selected(algorithm_selection, algorithm.name) || (algorithm.quadratic && quadratic_limit < size))
+                    continue;
+                const double ns_per_element(algorithm.time(input, repetitions));
+                const Counts counts(algorithm.count(input));
+                std::cout << algorithm.name << ',' << distribution << ',' << size << ',' << ns_per_element << ',';
+                print_count(counts.comparisons);
+                std::cout << ',';
+                print_count(counts.moves);
+                std::cout << ',';
+                print_count(counts.swaps);
+                std::cout << ',' << counts.allocations << ',' << counts.allocated_bytes << std::endl;
+            }
+        }
+    return EXIT_SUCCESS;
+}
@@ -6,20 +6,43 @@
 #include <algorithm>
 #include <stdexcept>
 #include <iterator>
+#include <new>
+#include <type_traits>
 
 #include "dsaaTypedefs.h"
+#include "memory/Relocate.h"
+#include "memory/ReallocAllocator.h"
+#include "GrowthPolicy.h"
 
 namespace dsaa
 {
-	template <typename Elem, typename Alloc = std::allocator<Elem>>
-	class DynamicArray
+	// Node containers DynamicArray can append from, see append_from.
+	template <typename Elem, typename Alloc>
+	class SinglyLinkList;
+	template <typename Elem, typename Alloc>
+	class DoublyLinkList;
+	template <typename Elem, typename Alloc>
+	class Queue;
+
+	// Tag selecting the constructors that default-initialize elements, leaving trivial types uninitialized.
+	struct default_init_t
+	{
+		explicit default_init_t() = default;
+	};
+	inline constexpr default_init_t default_init{};
+
+	// GrowthPolicy picks the new capacity whenever an insertion runs out of space, see GrowthPolicy.h.
+	template <typename Elem, typename Alloc = std::allocator<Elem>, typename GrowthPolicy = DoublingGrowth>
+	class DynamicArray final
 	{
 	public:
 		class ConstIterator;
 		class Iterator;
+		class AppendBuilder;
 
 		using value_type = Elem;
 		using allocator_type = Alloc;
+		using growth_policy_type = GrowthPolicy;
 		using reference = value_type &;
 		using const_reference = value_type const &;
 		using pointer = typename std::allocator_traits<allocator_type>::pointer;
@@ -52,6 +75,8 @@ namespace dsaa
 		CONSTEXPR DynamicArray(const allocator_type &p_allocator = allocator_type()) noexcept;
 		// Creates a container's p_size elements with default value.
 		CONSTEXPR explicit DynamicArray(const size_type &p_size, const allocator_type &p_allocator = allocator_type());
+		// Creates a container's p_size default-initialized elements. Trivial types are left uninitialized.
+		CONSTEXPR DynamicArray(const size_type &p_size, default_init_t, const allocator_type &p_allocator = allocator_type());
 		// Creates a container's p_size elements and init its element by p_value.
 		CONSTEXPR DynamicArray(const size_type &p_size, const_reference p_value, const allocator_type &p_allocator = allocator_type());
 		// Creates a container's size equal to p_elements's size and init its elements by p_elements's element.
@@ -74,7 +99,7 @@ namespace dsaa
 		// Destroys old elements and copy all elements from p_elements.
 		CONSTEXPR DynamicArray &operator=(const std::initializer_list<value_type> &p_elements);
 		// Destroys all elements and clean used space.
-		virtual ~DynamicArray();
+		~DynamicArray();
 
 		// Assigns new contents to the vector, replacing its current contents, and modifying its size accordingly.
 		template <typename IIterator>
@@ -99,6 +124,9 @@ namespace dsaa
 		NODISCARD CONSTEXPR INLINE const_pointer data() const noexcept;
 		// Returns a copy of the allocator object associated with the container.
 		NODISCARD CONSTEXPR INLINE allocator_type get_allocator() const noexcept;
+		// Returns the growth policy object, e.g. to read the counters of a CountingGrowth.
+		NODISCARD CONSTEXPR INLINE growth_policy_type &growth_policy() noexcept;
+		NODISCARD CONSTEXPR INLINE growth_policy_type const &growth_policy() const noexcept;
 
 		// Test whether container is empty.
 		NODISCARD CONSTEXPR INLINE bool empty() const noexcept;
@@ -114,6 +142,11 @@ namespace dsaa
 		NODISCARD CONSTEXPR INLINE iterator get_iterator(const size_type &p_index) NOEXCEPT;
 		// Resizes the container so that it contains p_size elements.
 		CONSTEXPR void resize(const size_type &p_size, const_reference p_value = value_type());
+		// Resizes the container so that it contains p_size elements, default-initializing the new ones.
+		CONSTEXPR void resize_default_init(const size_type &p_size);
+		// Resizes the container so that it contains p_size elements without touching the memory of the new ones.
+		// Only for trivial types, whose new elements hold indeterminate values until written.
+		CONSTEXPR void resize_uninitialized(const size_type &p_size);
 		// Allocates new space and copy elements to new space.
 		CONSTEXPR void reserve(const size_type &p_capacity);
 		// Requests the container to reduce its capacity to fit its size.
@@ -128,6 +161,19 @@ namespace dsaa
 		CONSTEXPR iterator insert_last(const IIterator &p_first, const IIterator &p_last);
 		template <class... Args>
 		CONSTEXPR iterator emplace_last(Args &&...p_args);
+		// Constructs a new last element without checking capacity, size() must be less than capacity().
+		template <class... Args>
+		CONSTEXPR INLINE reference emplace_last_unchecked(Args &&...p_args);
+		// Reserves space for p_count more elements once and returns a builder appending them without capacity checks.
+		// The new elements become part of the container when the builder commits or is destroyed.
+		NODISCARD CONSTEXPR AppendBuilder append_builder(const size_type &p_count);
+		// Appends copies of all elements of p_other, allocating exactly once.
+		template <typename OtherAlloc>
+		CONSTEXPR void append_from(const SinglyLinkList<value_type, OtherAlloc> &p_other);
+		template <typename OtherAlloc>
+		CONSTEXPR void append_from(const DoublyLinkList<value_type, OtherAlloc> &p_other);
+		template <typename OtherAlloc>
+		CONSTEXPR void append_from(const Queue<value_type, OtherAlloc> &p_other);
 
 		CONSTEXPR iterator insert_at(const const_iterator &p_position, const_reference p_value);
 		CONSTEXPR iterator insert_at(const const_iterator &p_position, value_type &&p_value);
@@ -152,18 +198,30 @@ namespace dsaa
 		CONSTEXPR void swap(DynamicArray &p_other) noexcept(std::allocator_traits<allocator_type>::propagate_on_container_swap::value || std::allocator_traits<allocator_type>::is_always_equal::value);
 
 	protected:
+		// Makes sure there is space for p_required elements, asking the growth policy for the new capacity.
+		CONSTEXPR INLINE void grow(const size_type &p_required);
+		// Opens p_size uninitialized slots at p_index, fills them by calling p_construct(slot, offset) and returns the last one.
+		// Capacity must already be large enough. If p_construct throws, the container is left unchanged.
+		template <typename Construct>
+		CONSTEXPR iterator construct_at_gap(const size_type &p_index, const size_type &p_size, Construct p_construct);
+		// Appends p_size elements read from p_first after a single reservation.
+		template <typename IIterator>
+		CONSTEXPR void append_sized(IIterator p_first, const size_type &p_size);
+
 		allocator_type m_allocator;
 		size_type m_capacity;
 		size_type m_size;
 		pointer m_elements;
+		[[no_unique_address]] growth_policy_type m_growth_policy;
 	};
 }
 
-template <typename Elem, typename Alloc>
-class dsaa::DynamicArray<Elem, Alloc>::ConstIterator
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+class dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::ConstIterator
 {
 public:
 	using iterator_category = std::random_access_iterator_tag;
+	using iterator_concept = std::contiguous_iterator_tag;
 	using value_type = Elem;
 	using difference_type = std::ptrdiff_t;
 	using pointer = Elem *;
@@ -172,15 +230,8 @@ public:
 
 	CONSTEXPR ConstIterator() noexcept : m_pointer(nullptr) {}
 	CONSTEXPR explicit ConstIterator(const_pointer p_pointer) noexcept : m_pointer(const_cast<pointer>(p_pointer)) {}
-	CONSTEXPR ConstIterator(const ConstIterator &p_iterator) noexcept : m_pointer(p_iterator.m_pointer) {}
-
-	CONSTEXPR ConstIterator &operator=(const ConstIterator &p_iterator) noexcept
-	{
-		m_pointer = p_iterator.m_pointer;
-		return *this;
-	}
-
-	virtual ~ConstIterator() {}
+	CONSTEXPR ConstIterator(const ConstIterator &p_iterator) noexcept = default;
+	CONSTEXPR ConstIterator &operator=(const ConstIterator &p_iterator) noexcept = default;
 
 	NODISCARD CONSTEXPR INLINE bool operator==(const ConstIterator &p_iterator) const noexcept { return m_pointer == p_iterator.m_pointer; }
 	NODISCARD CONSTEXPR INLINE bool operator!=(const ConstIterator &p_iterator) const noexcept { return m_pointer != p_iterator.m_pointer; }
@@ -218,6 +269,8 @@ public:
 		return result;
 	}
 
+	NODISCARD friend CONSTEXPR INLINE ConstIterator operator+(const int64_t &p_lhs, const ConstIterator &p_rhs) { return p_rhs + p_lhs; }
+
 	NODISCARD CONSTEXPR INLINE ConstIterator operator-(const int64_t &p_rhs) const
 	{
 		ConstIterator result;
@@ -264,6 +317,7 @@ public:
 	}
 
 	NODISCARD CONSTEXPR INLINE reference operator*() const { return *m_pointer; }
+	NODISCARD CONSTEXPR INLINE pointer operator->() const noexcept { return m_pointer; }
 	NODISCARD CONSTEXPR INLINE reference operator[](const int64_t &p_index) const { return m_pointer[p_index]; }
 	NODISCARD CONSTEXPR INLINE const_pointer content() const noexcept { return m_pointer; }
 
@@ -271,22 +325,16 @@ protected:
 	pointer m_pointer;
 };
 
-template <typename Elem, typename Alloc>
-class dsaa::DynamicArray<Elem, Alloc>::Iterator : public dsaa::DynamicArray<Elem, Alloc>::ConstIterator
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+class dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::Iterator final : public dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::ConstIterator
 {
 public:
 	CONSTEXPR Iterator() noexcept : ConstIterator() {}
 	CONSTEXPR Iterator(pointer p_pointer) noexcept : ConstIterator(p_pointer) {}
-	CONSTEXPR Iterator(const Iterator &p_iterator) noexcept : ConstIterator(p_iterator) {}
+	CONSTEXPR Iterator(const Iterator &p_iterator) noexcept = default;
 	CONSTEXPR Iterator(const ConstIterator &p_iterator) noexcept : ConstIterator(p_iterator) {}
 
-	CONSTEXPR Iterator &operator=(const Iterator &p_iterator) noexcept
-	{
-		content() = p_iterator.content();
-		return *this;
-	}
-
-	virtual ~Iterator() {}
+	CONSTEXPR Iterator &operator=(const Iterator &p_iterator) noexcept = default;
 
 	NODISCARD CONSTEXPR INLINE bool operator==(const Iterator &p_iterator) const noexcept { return content() == p_iterator.content(); }
 	NODISCARD CONSTEXPR INLINE bool operator!=(const Iterator &p_iterator) const noexcept { return content() != p_iterator.content(); }
@@ -324,6 +372,8 @@ public:
 		return result;
 	}
 
+	NODISCARD friend CONSTEXPR INLINE Iterator operator+(const int64_t &p_lhs, const Iterator &p_rhs) { return p_rhs + p_lhs; }
+
 	NODISCARD CONSTEXPR INLINE Iterator operator-(const int64_t &p_rhs) const
 	{
 		Iterator result;
@@ -369,109 +419,167 @@ public:
 		return 0 <= (content() - p_rhs.content());
 	}
 
-	NODISCARD CONSTEXPR INLINE reference operator*() { return *ConstIterator::m_pointer; }
-	NODISCARD CONSTEXPR INLINE reference operator[](const int64_t &p_index) { return ConstIterator::m_pointer[p_index]; }
+	NODISCARD CONSTEXPR INLINE reference operator*() const { return *ConstIterator::m_pointer; }
+	NODISCARD CONSTEXPR INLINE reference operator[](const int64_t &p_index) const { return ConstIterator::m_pointer[p_index]; }
 	NODISCARD CONSTEXPR INLINE pointer &content() { return ConstIterator::m_pointer; }
 	NODISCARD CONSTEXPR INLINE pointer content() const { return ConstIterator::m_pointer; }
 };
 
-template <typename Elem, typename Alloc>
-CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::iterator dsaa::DynamicArray<Elem, Alloc>::begin() noexcept
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+class dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::AppendBuilder
+{
+public:
+	AppendBuilder(const AppendBuilder &) = delete;
+	AppendBuilder &operator=(const AppendBuilder &) = delete;
+	~AppendBuilder() { commit(); }
+
+	// Constructs a new last element. At most the reserved count of elements may be appended.
+	template <class... Args>
+	CONSTEXPR INLINE reference emplace_last_unchecked(Args &&...p_args)
+	{
+#ifdef PARAM_CHECK
+		if (m_current == m_end)
+			throw std::out_of_range("AppendBuilder is full, append_builder reserved no more elements.\n");
+#endif
+
+		std::allocator_traits<allocator_type>::construct(m_array.m_allocator, m_current, std::forward<Args>(p_args)...);
+		return *m_current++;
+	}
+
+	CONSTEXPR INLINE reference insert_last_unchecked(const_reference p_value) { return emplace_last_unchecked(p_value); }
+	CONSTEXPR INLINE reference insert_last_unchecked(value_type &&p_value) { return emplace_last_unchecked(std::move(p_value)); }
+
+	template <class IIterator>
+	CONSTEXPR INLINE void insert_last_unchecked(IIterator p_first, const IIterator &p_last)
+	{
+		for (; p_first != p_last; ++p_first)
+			emplace_last_unchecked(*p_first);
+	}
+
+	// Returns how many more elements fit in the reserved space.
+	NODISCARD CONSTEXPR INLINE size_type remaining() const noexcept { return static_cast<size_type>(m_end - m_current); }
+
+	// Makes the elements appended so far part of the container.
+	CONSTEXPR INLINE void commit() noexcept { m_array.m_size = static_cast<size_type>(m_current - m_array.m_elements); }
+
+private:
+	friend class DynamicArray;
+
+	CONSTEXPR AppendBuilder(DynamicArray &p_array) noexcept
+		: m_array(p_array), m_current(p_array.m_elements + p_array.m_size), m_end(p_array.m_elements + p_array.m_capacity) {}
+
+	DynamicArray &m_array;
+	pointer m_current;
+	pointer m_end;
+};
+
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::iterator dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::begin() noexcept
 {
 	return size() ? iterator(&m_elements[0]) : iterator(nullptr);
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::const_iterator dsaa::DynamicArray<Elem, Alloc>::begin() const noexcept
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::const_iterator dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::begin() const noexcept
 {
 	return size() ? const_iterator(&m_elements[0]) : const_iterator(nullptr);
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::const_iterator dsaa::DynamicArray<Elem, Alloc>::cbegin() const noexcept
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::const_iterator dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::cbegin() const noexcept
 {
 	return size() ? const_iterator(&m_elements[0]) : const_iterator(nullptr);
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::iterator dsaa::DynamicArray<Elem, Alloc>::end() noexcept
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::iterator dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::end() noexcept
 {
 	return size() ? iterator(&m_elements[size()]) : iterator(nullptr);
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::const_iterator dsaa::DynamicArray<Elem, Alloc>::end() const noexcept
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::const_iterator dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::end() const noexcept
 {
 	return size() ? const_iterator(&m_elements[size()]) : const_iterator(nullptr);
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::const_iterator dsaa::DynamicArray<Elem, Alloc>::cend() const noexcept
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::const_iterator dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::cend() const noexcept
 {
 	return size() ? const_iterator(&m_elements[size()]) : const_iterator(nullptr);
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::reverse_iterator dsaa::DynamicArray<Elem, Alloc>::rbegin() noexcept
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::reverse_iterator dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::rbegin() noexcept
 {
 	return reverse_iterator(end());
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::const_reverse_iterator dsaa::DynamicArray<Elem, Alloc>::rbegin() const noexcept
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::const_reverse_iterator dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::rbegin() const noexcept
 {
 	return const_reverse_iterator(end());
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::const_reverse_iterator dsaa::DynamicArray<Elem, Alloc>::crbegin() const noexcept
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::const_reverse_iterator dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::crbegin() const noexcept
 {
 	return const_reverse_iterator(end());
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::reverse_iterator dsaa::DynamicArray<Elem, Alloc>::rend() noexcept
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::reverse_iterator dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::rend() noexcept
 {
 	return reverse_iterator(begin());
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::const_reverse_iterator dsaa::DynamicArray<Elem, Alloc>::rend() const noexcept
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::const_reverse_iterator dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::rend() const noexcept
 {
 	return const_reverse_iterator(begin());
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::const_reverse_iterator dsaa::DynamicArray<Elem, Alloc>::crend() const noexcept
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::const_reverse_iterator dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::crend() const noexcept
 {
 	return const_reverse_iterator(begin());
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR dsaa::DynamicArray<Elem, Alloc>::DynamicArray(const allocator_type &p_allocator) noexcept
-	: m_allocator(p_allocator), m_capacity(0), m_size(0), m_elements(nullptr) {}
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::DynamicArray(const allocator_type &p_allocator) noexcept
+	: m_allocator(p_allocator), m_capacity(0), m_size(0), m_elements(nullptr), m_growth_policy() {}
 
-template <typename Elem, typename Alloc>
-CONSTEXPR dsaa::DynamicArray<Elem, Alloc>::DynamicArray(const size_type &p_size, const allocator_type &p_allocator)
-	: m_allocator(p_allocator), m_capacity(p_size), m_size(p_size), m_elements(nullptr)
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::DynamicArray(const size_type &p_size, const allocator_type &p_allocator)
+	: m_allocator(p_allocator), m_capacity(p_size), m_size(p_size), m_elements(nullptr), m_growth_policy()
 {
 	m_elements = std::allocator_traits<allocator_type>::allocate(m_allocator, capacity());
 	for (iterator i(begin()); i != end(); ++i)
 		std::allocator_traits<allocator_type>::construct(m_allocator, i.content(), value_type());
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR dsaa::DynamicArray<Elem, Alloc>::DynamicArray(const size_type &p_size, const_reference p_value, const allocator_type &p_allocator)
-	: m_allocator(p_allocator), m_capacity(p_size), m_size(p_size), m_elements(nullptr)
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::DynamicArray(const size_type &p_size, default_init_t, const allocator_type &p_allocator)
+	: m_allocator(p_allocator), m_capacity(p_size), m_size(p_size), m_elements(nullptr), m_growth_policy()
+{
+	m_elements = std::allocator_traits<allocator_type>::allocate(m_allocator, capacity());
+	if constexpr (!std::is_trivially_default_constructible_v<value_type>)
+		for (iterator i(begin()); i != end(); ++i)
+			::new (static_cast<void *>(i.content())) value_type;
+}
+
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::DynamicArray(const size_type &p_size, const_reference p_value, const allocator_type &p_allocator)
+	: m_allocator(p_allocator), m_capacity(p_size), m_size(p_size), m_elements(nullptr), m_growth_policy()
 {
 	m_elements = std::allocator_traits<allocator_type>::allocate(m_allocator, capacity());
 	for (iterator i(begin()); i != end(); ++i)
 		std::allocator_traits<allocator_type>::construct(m_allocator, i.content(), p_value);
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR dsaa::DynamicArray<Elem, Alloc>::DynamicArray(const std::initializer_list<value_type> &p_elements, const allocator_type &p_allocator)
-	: m_allocator(p_allocator), m_capacity(p_elements.size()), m_size(p_elements.size()), m_elements(nullptr)
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::DynamicArray(const std::initializer_list<value_type> &p_elements, const allocator_type &p_allocator)
+	: m_allocator(p_allocator), m_capacity(p_elements.size()), m_size(p_elements.size()), m_elements(nullptr), m_growth_policy()
 {
 	m_elements = std::allocator_traits<allocator_type>::allocate(m_allocator, capacity());
 	iterator iter(m_elements);
@@ -479,10 +587,10 @@ CONSTEXPR dsaa::DynamicArray<Elem, Alloc>::DynamicArray(const std::initializer_l
 		std::allocator_traits<allocator_type>::construct(m_allocator, iter.content(), *i);
 }
 
-template <typename Elem, typename Alloc>
+template <typename Elem, typename Alloc, typename GrowthPolicy>
 template <typename IIterator>
-CONSTEXPR dsaa::DynamicArray<Elem, Alloc>::DynamicArray(const IIterator &p_first, const IIterator &p_last, const allocator_type &p_allocator)
-	: m_allocator(p_allocator), m_capacity(0), m_size(0), m_elements(nullptr)
+CONSTEXPR dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::DynamicArray(const IIterator &p_first, const IIterator &p_last, const allocator_type &p_allocator)
+	: m_allocator(p_allocator), m_capacity(0), m_size(0), m_elements(nullptr), m_growth_policy()
 {
 	size_type count_size(0);
 	for (auto iter(p_first); iter != p_last; ++iter)
@@ -497,10 +605,10 @@ CONSTEXPR dsaa::DynamicArray<Elem, Alloc>::DynamicArray(const IIterator &p_first
 	}
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR dsaa::DynamicArray<Elem, Alloc>::DynamicArray(const DynamicArray &p_other)
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::DynamicArray(const DynamicArray &p_other)
 	: m_allocator(std::allocator_traits<allocator_type>::select_on_container_copy_construction(p_other.get_allocator())),
-	  m_capacity(p_other.size()), m_size(p_other.size()), m_elements(nullptr)
+	  m_capacity(p_other.size()), m_size(p_other.size()), m_elements(nullptr), m_growth_policy(p_other.m_growth_policy)
 {
 	m_elements = std::allocator_traits<allocator_type>::allocate(m_allocator, capacity());
 	iterator iter(m_elements);
@@ -508,9 +616,9 @@ CONSTEXPR dsaa::DynamicArray<Elem, Alloc>::DynamicArray(const DynamicArray &p_ot
 		std::allocator_traits<allocator_type>::construct(m_allocator, iter.content(), *i);
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR dsaa::DynamicArray<Elem, Alloc>::DynamicArray(const DynamicArray &p_other, const allocator_type &p_allocator)
-	: m_allocator(p_allocator), m_capacity(p_other.size()), m_size(p_other.size()), m_elements(nullptr)
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::DynamicArray(const DynamicArray &p_other, const allocator_type &p_allocator)
+	: m_allocator(p_allocator), m_capacity(p_other.size()), m_size(p_other.size()), m_elements(nullptr), m_growth_policy(p_other.m_growth_policy)
 {
 	m_elements = std::allocator_traits<allocator_type>::allocate(m_allocator, capacity());
 	iterator iter(m_elements);
@@ -518,10 +626,11 @@ CONSTEXPR dsaa::DynamicArray<Elem, Alloc>::DynamicArray(const DynamicArray &p_ot
 		std::allocator_traits<allocator_type>::construct(m_allocator, iter.content(), *i);
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR dsaa::DynamicArray<Elem, Alloc>::DynamicArray(DynamicArray &&p_other) noexcept
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::DynamicArray(DynamicArray &&p_other) noexcept
 	: m_allocator(std::allocator_traits<allocator_type>::select_on_container_copy_construction(p_other.get_allocator())),
-	  m_capacity(p_other.capacity()), m_size(p_other.size()), m_elements(p_other.m_elements)
+	  m_capacity(p_other.capacity()), m_size(p_other.size()), m_elements(p_other.m_elements),
+	  m_growth_policy(std::move(p_other.m_growth_policy))
 {
 	p_other.m_allocator = allocator_type();
 	p_other.m_capacity = 0;
@@ -529,9 +638,10 @@ CONSTEXPR dsaa::DynamicArray<Elem, Alloc>::DynamicArray(DynamicArray &&p_other)
 	p_other.m_elements = nullptr;
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR dsaa::DynamicArray<Elem, Alloc>::DynamicArray(DynamicArray &&p_other, const allocator_type &p_allocator) noexcept
-	: m_allocator(p_allocator), m_capacity(p_other.capacity()), m_size(p_other.size()), m_elements(p_other.m_elements)
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::DynamicArray(DynamicArray &&p_other, const allocator_type &p_allocator) noexcept
+	: m_allocator(p_allocator), m_capacity(p_other.capacity()), m_size(p_other.size()), m_elements(p_other.m_elements),
+	  m_growth_policy(std::move(p_other.m_growth_policy))
 {
 	p_other.m_allocator = allocator_type();
 	p_other.m_capacity = 0;
@@ -539,8 +649,8 @@ CONSTEXPR dsaa::DynamicArray<Elem, Alloc>::DynamicArray(DynamicArray &&p_other,
 	p_other.m_elements = nullptr;
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR dsaa::DynamicArray<Elem, Alloc> &dsaa::DynamicArray<Elem, Alloc>::operator=(const DynamicArray &p_other)
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR dsaa::DynamicArray<Elem, Alloc, GrowthPolicy> &dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::operator=(const DynamicArray &p_other)
 {
 	// Avoid self-reference.
 	if (this == &p_other)
@@ -558,6 +668,7 @@ CONSTEXPR dsaa::DynamicArray<Elem, Alloc> &dsaa::DynamicArray<Elem, Alloc>::oper
 			std::allocator_traits<allocator_type>::construct(m_allocator, iter.content(), *i);
 
 		m_size = p_other.size();
+		m_growth_policy = p_other.m_growth_policy;
 		return *this;
 	}
 
@@ -573,11 +684,12 @@ CONSTEXPR dsaa::DynamicArray<Elem, Alloc> &dsaa::DynamicArray<Elem, Alloc>::oper
 	std::allocator_traits<allocator_type>::deallocate(m_allocator, m_elements, capacity());
 	m_capacity = m_size = p_other.size();
 	m_elements = elements;
+	m_growth_policy = p_other.m_growth_policy;
 	return *this;
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR dsaa::DynamicArray<Elem, Alloc> &dsaa::DynamicArray<Elem, Alloc>::operator=(DynamicArray &&p_other) noexcept(std::allocator_traits<allocator_type>::propagate_on_container_move_assignment::value || std::allocator_traits<allocator_type>::is_always_equal::value)
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR dsaa::DynamicArray<Elem, Alloc, GrowthPolicy> &dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::operator=(DynamicArray &&p_other) noexcept(std::allocator_traits<allocator_type>::propagate_on_container_move_assignment::value || std::allocator_traits<allocator_type>::is_always_equal::value)
 {
 	for (iterator i(begin()); i != end(); ++i)
 		std::allocator_traits<allocator_type>::destroy(m_allocator, i.content());
@@ -589,6 +701,7 @@ CONSTEXPR dsaa::DynamicArray<Elem, Alloc> &dsaa::DynamicArray<Elem, Alloc>::oper
 	m_capacity = p_other.capacity();
 	m_size = p_other.size();
 	m_elements = p_other.m_elements;
+	m_growth_policy = std::move(p_other.m_growth_policy);
 
 	p_other.m_allocator = allocator_type();
 	p_other.m_capacity = 0;
@@ -598,8 +711,8 @@ CONSTEXPR dsaa::DynamicArray<Elem, Alloc> &dsaa::DynamicArray<Elem, Alloc>::oper
 	return *this;
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR dsaa::DynamicArray<Elem, Alloc> &dsaa::DynamicArray<Elem, Alloc>::operator=(const std::initializer_list<value_type> &p_elements)
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR dsaa::DynamicArray<Elem, Alloc, GrowthPolicy> &dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::operator=(const std::initializer_list<value_type> &p_elements)
 {
 	// Quarantees elements are copies and no error happens before delete old elements.
 	pointer elements = std::allocator_traits<allocator_type>::allocate(m_allocator, p_elements.size());
@@ -618,8 +731,8 @@ CONSTEXPR dsaa::DynamicArray<Elem, Alloc> &dsaa::DynamicArray<Elem, Alloc>::oper
 	return *this;
 }
 
-template <typename Elem, typename Alloc>
-dsaa::DynamicArray<Elem, Alloc>::~DynamicArray()
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::~DynamicArray()
 {
 	for (iterator i(begin()); i != end(); ++i)
 		std::allocator_traits<allocator_type>::destroy(m_allocator, i.content());
@@ -628,9 +741,9 @@ dsaa::DynamicArray<Elem, Alloc>::~DynamicArray()
 }
 
 // Assigns new contents to the vector, replacing its current contents, and modifying its size accordingly.
-template <typename Elem, typename Alloc>
+template <typename Elem, typename Alloc, typename GrowthPolicy>
 template <typename IIterator>
-CONSTEXPR void dsaa::DynamicArray<Elem, Alloc>::assign(const IIterator &p_first, const IIterator &p_last)
+CONSTEXPR void dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::assign(const IIterator &p_first, const IIterator &p_last)
 {
 	for (iterator i(begin()); end() != i; ++i)
 		std::allocator_traits<allocator_type>::destroy(m_allocator, i.content());
@@ -650,8 +763,8 @@ CONSTEXPR void dsaa::DynamicArray<Elem, Alloc>::assign(const IIterator &p_first,
 	}
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR void dsaa::DynamicArray<Elem, Alloc>::assign(const size_type &p_size, const value_type &p_value)
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR void dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::assign(const size_type &p_size, const value_type &p_value)
 {
 	// Allocate new space.
 	pointer elements = std::allocator_traits<allocator_type>::allocate(m_allocator, p_size);
@@ -667,8 +780,8 @@ CONSTEXPR void dsaa::DynamicArray<Elem, Alloc>::assign(const size_type &p_size,
 	m_elements = elements;
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR void dsaa::DynamicArray<Elem, Alloc>::assign(const std::initializer_list<value_type> &p_elements)
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR void dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::assign(const std::initializer_list<value_type> &p_elements)
 {
 	// Quarantees elements are copies and no error happens before delete old elements.
 	pointer elements = std::allocator_traits<allocator_type>::allocate(m_allocator, p_elements.size());
@@ -686,8 +799,8 @@ CONSTEXPR void dsaa::DynamicArray<Elem, Alloc>::assign(const std::initializer_li
 	m_elements = elements;
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::reference dsaa::DynamicArray<Elem, Alloc>::operator[](const size_type &p_index) NOEXCEPT
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::reference dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::operator[](const size_type &p_index) NOEXCEPT
 {
 #ifdef PARAM_CHECK
 	if (size() <= p_index)
@@ -697,8 +810,8 @@ CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::reference dsaa::DynamicArray
 	return m_elements[p_index];
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::const_reference dsaa::DynamicArray<Elem, Alloc>::operator[](const size_type &p_index) const NOEXCEPT
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::const_reference dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::operator[](const size_type &p_index) const NOEXCEPT
 {
 #ifdef PARAM_CHECK
 	if (size() <= p_index)
@@ -708,8 +821,8 @@ CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::const_reference dsaa::Dynami
 	return m_elements[p_index];
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::reference dsaa::DynamicArray<Elem, Alloc>::at(const size_type &p_index)
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::reference dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::at(const size_type &p_index)
 {
 	if (size() <= p_index)
 		throw std::out_of_range("p_index out of range exception.\n;");
@@ -717,8 +830,8 @@ CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::reference dsaa::DynamicArray
 	return m_elements[p_index];
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::const_reference dsaa::DynamicArray<Elem, Alloc>::at(const size_type &p_index) const
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::const_reference dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::at(const size_type &p_index) const
 {
 	if (size() <= p_index)
 		throw std::out_of_range("p_index out of range exception.\n");
@@ -726,8 +839,8 @@ CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::const_reference dsaa::Dynami
 	return m_elements[p_index];
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::reference dsaa::DynamicArray<Elem, Alloc>::first() NOEXCEPT
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::reference dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::first() NOEXCEPT
 {
 #ifdef PARAM_CHECK
 	if (!size())
@@ -737,8 +850,8 @@ CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::reference dsaa::DynamicArray
 	return m_elements[0];
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::const_reference dsaa::DynamicArray<Elem, Alloc>::first() const NOEXCEPT
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::const_reference dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::first() const NOEXCEPT
 {
 #ifdef PARAM_CHECK
 	if (!size())
@@ -748,8 +861,8 @@ CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::const_reference dsaa::Dynami
 	return m_elements[0];
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::reference dsaa::DynamicArray<Elem, Alloc>::last() NOEXCEPT
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::reference dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::last() NOEXCEPT
 {
 #ifdef PARAM_CHECK
 	if (!size())
@@ -759,8 +872,8 @@ CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::reference dsaa::DynamicArray
 	return m_elements[size() - 1];
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::const_reference dsaa::DynamicArray<Elem, Alloc>::last() const NOEXCEPT
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::const_reference dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::last() const NOEXCEPT
 {
 #ifdef PARAM_CHECK
 	if (!size())
@@ -770,50 +883,62 @@ CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::const_reference dsaa::Dynami
 	return m_elements[size() - 1];
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::pointer dsaa::DynamicArray<Elem, Alloc>::data() noexcept
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::pointer dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::data() noexcept
 {
 	return m_elements;
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::const_pointer dsaa::DynamicArray<Elem, Alloc>::data() const noexcept
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::const_pointer dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::data() const noexcept
 {
 	return m_elements;
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::allocator_type dsaa::DynamicArray<Elem, Alloc>::get_allocator() const noexcept
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::allocator_type dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::get_allocator() const noexcept
 {
 	return m_allocator;
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR bool dsaa::DynamicArray<Elem, Alloc>::empty() const noexcept
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::growth_policy_type &dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::growth_policy() noexcept
+{
+	return m_growth_policy;
+}
+
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::growth_policy_type const &dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::growth_policy() const noexcept
+{
+	return m_growth_policy;
+}
+
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR bool dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::empty() const noexcept
 {
 	return size() == 0;
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::size_type dsaa::DynamicArray<Elem, Alloc>::capacity() const noexcept
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::size_type dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::capacity() const noexcept
 {
 	return m_capacity;
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::size_type dsaa::DynamicArray<Elem, Alloc>::size() const noexcept
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::size_type dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::size() const noexcept
 {
 	return m_size;
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::size_type dsaa::DynamicArray<Elem, Alloc>::max_size() const noexcept
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::size_type dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::max_size() const noexcept
 {
 	return std::numeric_limits<value_type>::max() / sizeof(value_type);
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR void dsaa::DynamicArray<Elem, Alloc>::resize(const size_type &p_size, const value_type &p_value)
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR void dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::resize(const size_type &p_size, const value_type &p_value)
 {
 	reserve(p_size);
 	if (size() <= p_size)
@@ -838,51 +963,107 @@ CONSTEXPR void dsaa::DynamicArray<Elem, Alloc>::resize(const size_type &p_size,
 	m_size = p_size;
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR void dsaa::DynamicArray<Elem, Alloc>::reserve(const size_type &p_capacity)
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR void dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::resize_default_init(const size_type &p_size)
+{
+	if (p_size <= size())
+	{
+		resize(p_size);
+		return;
+	}
+
+	reserve(p_size);
+	if constexpr (std::is_trivially_default_constructible_v<value_type>)
+		m_size = p_size;
+	else
+		for (; size() != p_size; ++m_size)
+			::new (static_cast<void *>(&m_elements[size()])) value_type;
+}
+
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR void dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::resize_uninitialized(const size_type &p_size)
+{
+	static_assert(std::is_trivial_v<value_type>, "resize_uninitialized requires a trivial type, use resize_default_init instead.");
+
+	if (size() < p_size)
+		reserve(p_size);
+	m_size = p_size;
+}
+
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR void dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::reserve(const size_type &p_capacity)
 {
 	// Never decrease allocation.
 	if (p_capacity <= m_capacity)
 		return;
 
+	if constexpr (dsaa::has_reallocate<allocator_type>::value && dsaa::is_memcpy_relocatable_v<value_type, allocator_type>)
+	{
+		// Let the allocator extend the block in place (realloc/mremap), no element is copied by us.
+		m_elements = m_allocator.reallocate(m_elements, capacity(), p_capacity);
+		m_capacity = p_capacity;
+		if constexpr (dsaa::has_on_reallocate<growth_policy_type>::value)
+			m_growth_policy.on_reallocate(0, p_capacity * sizeof(value_type));
+		return;
+	}
+
 	pointer elements = std::allocator_traits<allocator_type>::allocate(m_allocator, p_capacity);
-	// Copy old element to new place.
-	iterator iter(elements);
-	for (iterator i(begin()); i != end(); ++i, ++iter)
-		std::allocator_traits<allocator_type>::construct(m_allocator, iter.content(), *i);
-	// Clean up old allocated space.
-	for (iterator i(begin()); i != end(); ++i)
-		std::allocator_traits<allocator_type>::destroy(m_allocator, i.content());
+	// Relocate old elements to new place.
+	try
+	{
+		dsaa::uninitialized_relocate(m_allocator, m_elements, size(), elements);
+	}
+	catch (...)
+	{
+		std::allocator_traits<allocator_type>::deallocate(m_allocator, elements, p_capacity);
+		throw;
+	}
 	std::allocator_traits<allocator_type>::deallocate(m_allocator, m_elements, capacity());
+	if constexpr (dsaa::has_on_reallocate<growth_policy_type>::value)
+		m_growth_policy.on_reallocate(size() * sizeof(value_type), p_capacity * sizeof(value_type));
 
 	m_capacity = p_capacity;
 	m_elements = elements;
 }
 
 // Requests the container to reduce its capacity to fit its size.
-template <typename Elem, typename Alloc>
-CONSTEXPR void dsaa::DynamicArray<Elem, Alloc>::shrink_to_fit()
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR void dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::shrink_to_fit()
 {
 	if (size() == capacity())
 		return;
+
+	if constexpr (dsaa::has_reallocate<allocator_type>::value && dsaa::is_memcpy_relocatable_v<value_type, allocator_type>)
+	{
+		m_elements = m_allocator.reallocate(m_elements, capacity(), size());
+		m_capacity = size();
+		if constexpr (dsaa::has_on_reallocate<growth_policy_type>::value)
+			m_growth_policy.on_reallocate(0, size() * sizeof(value_type));
+		return;
+	}
+
 	// Allocate new space.
 	pointer elements = std::allocator_traits<allocator_type>::allocate(m_allocator, size());
-	// Copy old element to new place.
-	iterator iter(elements);
-	for (const_iterator i(begin()); i != end(); ++i, ++iter)
-		std::allocator_traits<allocator_type>::construct(m_allocator, iter.content(), *i);
-	// Clean up old allocated space.
-	for (iterator i(begin()); i != end(); ++i)
-		std::allocator_traits<allocator_type>::destroy(m_allocator, i.content());
-
+	// Relocate old elements to new place.
+	try
+	{
+		dsaa::uninitialized_relocate(m_allocator, m_elements, size(), elements);
+	}
+	catch (...)
+	{
+		std::allocator_traits<allocator_type>::deallocate(m_allocator, elements, size());
+		throw;
+	}
 	std::allocator_traits<allocator_type>::deallocate(m_allocator, m_elements, capacity());
+	if constexpr (dsaa::has_on_reallocate<growth_policy_type>::value)
+		m_growth_policy.on_reallocate(size() * sizeof(value_type), size() * sizeof(value_type));
 
 	m_capacity = size();
 	m_elements = elements;
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::size_type dsaa::DynamicArray<Elem, Alloc>::get_index(const const_iterator &p_position) NOEXCEPT
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::size_type dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::get_index(const const_iterator &p_position) NOEXCEPT
 {
 #ifdef PARAM_CHECK
 	if (!size())
@@ -896,8 +1077,8 @@ CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::size_type dsaa::DynamicArray
 	return p_position - iterator(&m_elements[0]);
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::iterator dsaa::DynamicArray<Elem, Alloc>::get_iterator(const size_type &p_index) NOEXCEPT
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::iterator dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::get_iterator(const size_type &p_index) NOEXCEPT
 {
 #ifdef PARAM_CHECK
 	if (!size())
@@ -909,32 +1090,30 @@ CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::iterator dsaa::DynamicArray<
 	return iterator(&m_elements[0]) + p_index;
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::iterator dsaa::DynamicArray<Elem, Alloc>::insert_last(const_reference p_value)
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::iterator dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::insert_last(const_reference p_value)
 {
-	if (size() == capacity())
-		reserve(size() == 0 ? 8 : 2 * size()); // Make sure we have enough space.
+	grow(size() + 1); // Make sure we have enough space.
 
 	std::allocator_traits<allocator_type>::construct(m_allocator, &m_elements[m_size], p_value);
 	++m_size;
 	return iterator(end() - 1);
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::iterator dsaa::DynamicArray<Elem, Alloc>::insert_last(value_type &&p_value)
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::iterator dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::insert_last(value_type &&p_value)
 {
-	if (size() == capacity())
-		reserve(size() == 0 ? 8 : 2 * size()); // Make sure we have enough space.
+	grow(size() + 1); // Make sure we have enough space.
 	std::allocator_traits<allocator_type>::construct(m_allocator, &m_elements[m_size], std::move(p_value));
 	++m_size;
 	return end() - 1;
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::iterator dsaa::DynamicArray<Elem, Alloc>::insert_last(const size_type &p_size, const_reference p_value)
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::iterator dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::insert_last(const size_type &p_size, const_reference p_value)
 {
 	if (capacity() < size() + p_size)
-		reserve(size() + p_size);
+		reserve(size() + p_size); // Bulk insertions allocate exactly what they need.
 
 	size_type num_elem(p_size);
 	while (num_elem--)
@@ -945,11 +1124,11 @@ CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::iterator dsaa::DynamicArray<
 	return end() - 1;
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::iterator dsaa::DynamicArray<Elem, Alloc>::insert_last(const std::initializer_list<value_type> &p_elements)
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::iterator dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::insert_last(const std::initializer_list<value_type> &p_elements)
 {
 	if (capacity() < size() + p_elements.size())
-		reserve(size() + p_elements.size());
+		reserve(size() + p_elements.size()); // Bulk insertions allocate exactly what they need.
 
 	for (auto iter(p_elements.begin()); iter != p_elements.end(); ++iter)
 	{
@@ -959,16 +1138,16 @@ CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::iterator dsaa::DynamicArray<
 	return end() - 1;
 }
 
-template <typename Elem, typename Alloc>
+template <typename Elem, typename Alloc, typename GrowthPolicy>
 template <class IIterator>
-CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::iterator dsaa::DynamicArray<Elem, Alloc>::insert_last(const IIterator &p_first, const IIterator &p_last)
+CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::iterator dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::insert_last(const IIterator &p_first, const IIterator &p_last)
 {
 	size_type count_size(0);
 	for (auto iter(p_first); iter != p_last; ++iter)
 		++count_size;
 
 	if (capacity() < size() + count_size)
-		reserve(size() + count_size);
+		reserve(size() + count_size); // Bulk insertions allocate exactly what they need.
 
 	for (auto iter(p_first); iter != p_last; ++iter)
 	{
@@ -979,47 +1158,61 @@ CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::iterator dsaa::DynamicArray<
 	return end() - 1;
 }
 
-template <typename Elem, typename Alloc>
+template <typename Elem, typename Alloc, typename GrowthPolicy>
 template <class... Args>
-CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::iterator dsaa::DynamicArray<Elem, Alloc>::emplace_last(Args &&...p_args)
+CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::iterator dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::emplace_last(Args &&...p_args)
 {
-	if (size() == capacity())
-		reserve(size() == 0 ? 8 : 2 * size()); // Make sure we have enough space.
+	grow(size() + 1); // Make sure we have enough space.
 
 	std::allocator_traits<allocator_type>::construct(m_allocator, &m_elements[m_size], p_args...);
 	++m_size;
 	return iterator(end() - 1);
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::iterator dsaa::DynamicArray<Elem, Alloc>::insert_at(const const_iterator &p_position, const_reference p_value)
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+template <class... Args>
+CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::reference dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::emplace_last_unchecked(Args &&...p_args)
 {
 #ifdef PARAM_CHECK
-	if (p_position < begin())
-		throw std::invalid_argument("p_position can not less than begin().\n");
-	if (end() < p_position)
-		throw std::invalid_argument("p_position can not greater than end().\n");
+	if (size() == capacity())
+		throw std::out_of_range("DynamicArray is full, reserve capacity before emplace_last_unchecked.\n");
 #endif
 
-	size_t index(get_index(p_position)); // reserve can make iterator to p_position become invalid.
-	if (size() == capacity())
-		reserve(size() == 0 ? 8 : 2 * size()); // Make sure we have enough space.
+	std::allocator_traits<allocator_type>::construct(m_allocator, &m_elements[m_size], std::forward<Args>(p_args)...);
+	return m_elements[m_size++];
+}
 
-	// First copy last element into uninitialized space.
-	std::allocator_traits<allocator_type>::construct(m_allocator, &m_elements[m_size], last());
-	++m_size;
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::AppendBuilder dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::append_builder(const size_type &p_count)
+{
+	if (capacity() < size() + p_count)
+		reserve(size() + p_count); // Bulk insertions allocate exactly what they need.
+	return AppendBuilder(*this);
+}
 
-	iterator desired(get_iterator(index)); // The place to put value.
-	for (iterator last_elem(&last()); last_elem != desired; --last_elem)
-		*last_elem = *(last_elem - 1); // Copy element one position to the right.
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+template <typename OtherAlloc>
+CONSTEXPR void dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::append_from(const SinglyLinkList<value_type, OtherAlloc> &p_other)
+{
+	append_sized(p_other.begin(), p_other.size());
+}
 
-	*desired = p_value; // Insert value;
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+template <typename OtherAlloc>
+CONSTEXPR void dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::append_from(const DoublyLinkList<value_type, OtherAlloc> &p_other)
+{
+	append_sized(p_other.begin(), p_other.size());
+}
 
-	return desired;
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+template <typename OtherAlloc>
+CONSTEXPR void dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::append_from(const Queue<value_type, OtherAlloc> &p_other)
+{
+	append_sized(p_other.begin(), p_other.size());
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::iterator dsaa::DynamicArray<Elem, Alloc>::insert_at(const const_iterator &p_position, value_type &&p_value)
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::iterator dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::insert_at(const const_iterator &p_position, const_reference p_value)
 {
 #ifdef PARAM_CHECK
 	if (p_position < begin())
@@ -1028,24 +1221,34 @@ CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::iterator dsaa::DynamicArray<
 		throw std::invalid_argument("p_position can not greater than end().\n");
 #endif
 
-	size_t index(get_index(p_position));
-	if (size() == capacity())
-		reserve(size() == 0 ? 8 : 2 * size()); // Make sure we have enough space.
+	size_type index(p_position - cbegin()); // reserve can make iterator to p_position become invalid.
+	value_type value(p_value);				 // p_value may refer to an element that is about to be relocated.
+	grow(size() + 1); // Make sure we have enough space.
 
-	// First copy last element into uninitialized space.
-	std::allocator_traits<allocator_type>::construct(m_allocator, &m_elements[m_size], last());
-	++m_size;
+	return construct_at_gap(index, 1, [&](pointer p_slot, size_type)
+							{ std::allocator_traits<allocator_type>::construct(m_allocator, p_slot, std::move(value)); });
+}
 
-	iterator position(get_iterator(index)); // The place to put value.
-	for (iterator last_elem(end() - 1); last_elem != position; --last_elem)
-		*last_elem = *(last_elem - 1); // Copy element one position to the right.
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::iterator dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::insert_at(const const_iterator &p_position, value_type &&p_value)
+{
+#ifdef PARAM_CHECK
+	if (p_position < begin())
+		throw std::invalid_argument("p_position can not less than begin().\n");
+	if (end() < p_position)
+		throw std::invalid_argument("p_position can not greater than end().\n");
+#endif
 
-	*position = std::move(p_value); // Insert value;
+	size_type index(p_position - cbegin());
+	value_type value(std::move(p_value));
+	grow(size() + 1); // Make sure we have enough space.
 
-	return position;
+	return construct_at_gap(index, 1, [&](pointer p_slot, size_type)
+							{ std::allocator_traits<allocator_type>::construct(m_allocator, p_slot, std::move(value)); });
 }
-template <typename Elem, typename Alloc>
-CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::iterator dsaa::DynamicArray<Elem, Alloc>::insert_at(const const_iterator &p_position, const size_type &p_size, const_reference p_value)
+
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::iterator dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::insert_at(const const_iterator &p_position, const size_type &p_size, const_reference p_value)
 {
 #ifdef PARAM_CHECK
 	if (p_position < begin())
@@ -1054,38 +1257,18 @@ CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::iterator dsaa::DynamicArray<
 		throw std::invalid_argument("p_position can not greater than end().\n");
 #endif
 
-	size_type index(get_index(p_position));
+	size_type index(p_position - cbegin());
+	value_type value(p_value);
 
 	if (capacity() < size() + p_size)
-		reserve(size() + p_size);
+		reserve(size() + p_size); // Bulk insertions allocate exactly what they need.
 
-	iterator pivot(get_iterator(index));
-	iterator convey(get_iterator(size() - 1));
-	// Have to access element directly, get_iterator when add bound check will cause problem.
-	iterator target(&m_elements[size() + p_size - 1]);
-
-	while (pivot <= convey)
-	{
-		std::allocator_traits<allocator_type>::construct(m_allocator, target.content(), *convey);
-		std::allocator_traits<allocator_type>::destroy(m_allocator, convey.content());
-		--target;
-		--convey;
-	}
-	++convey;
-	++target;
-	while (convey != target)
-	{
-		std::allocator_traits<allocator_type>::construct(m_allocator, convey.content(), p_value);
-		++convey;
-	}
-
-	m_size += p_size;
-
-	return --convey;
+	return construct_at_gap(index, p_size, [&](pointer p_slot, size_type)
+							{ std::allocator_traits<allocator_type>::construct(m_allocator, p_slot, value); });
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::iterator dsaa::DynamicArray<Elem, Alloc>::insert_at(const const_iterator &p_position, const std::initializer_list<value_type> &p_elements)
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::iterator dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::insert_at(const const_iterator &p_position, const std::initializer_list<value_type> &p_elements)
 {
 #ifdef PARAM_CHECK
 	if (p_position < begin())
@@ -1094,36 +1277,18 @@ CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::iterator dsaa::DynamicArray<
 		throw std::invalid_argument("p_position can not greater than end().\n");
 #endif
 
-	size_type index(get_index(p_position));
+	size_type index(p_position - cbegin());
 
 	if (capacity() < size() + p_elements.size())
-		reserve(size() + p_elements.size());
-
-	iterator pivot(get_iterator(index));
-	iterator convey(get_iterator(size() - 1));
-	// Have to access element directly, get_iterator when add bound check will cause problem.
-	iterator target(&m_elements[size() + p_elements.size() - 1]);
-
-	while (pivot <= convey)
-	{
-		std::allocator_traits<allocator_type>::construct(m_allocator, target.content(), *convey);
-		std::allocator_traits<allocator_type>::destroy(m_allocator, convey.content());
-		--target;
-		--convey;
-	}
-	++convey;
-	++target;
-	for (auto iter(p_elements.begin()); iter != p_elements.end(); ++iter, ++convey)
-		std::allocator_traits<allocator_type>::construct(m_allocator, convey.content(), *iter);
-
-	m_size += p_elements.size();
+		reserve(size() + p_elements.size()); // Bulk insertions allocate exactly what they need.
 
-	return --convey;
+	return construct_at_gap(index, p_elements.size(), [&](pointer p_slot, size_type p_offset)
+							{ std::allocator_traits<allocator_type>::construct(m_allocator, p_slot, p_elements.begin()[p_offset]); });
 }
 
-template <typename Elem, typename Alloc>
+template <typename Elem, typename Alloc, typename GrowthPolicy>
 template <class IIterator>
-CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::iterator dsaa::DynamicArray<Elem, Alloc>::insert_at(const const_iterator &p_position, const IIterator &p_first, const IIterator &p_last)
+CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::iterator dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::insert_at(const const_iterator &p_position, const IIterator &p_first, const IIterator &p_last)
 {
 #ifdef PARAM_CHECK
 	if (p_position < begin())
@@ -1132,40 +1297,21 @@ CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::iterator dsaa::DynamicArray<
 		throw std::invalid_argument("p_position can not greater than end().\n");
 #endif
 
-	size_type index(get_index(p_position));
+	size_type index(p_position - cbegin());
 	size_type count_size(0);
 	for (auto i(p_first); i != p_last; ++i)
 		++count_size;
 	if (capacity() < size() + count_size)
-		reserve(size() + count_size);
+		reserve(size() + count_size); // Bulk insertions allocate exactly what they need.
 
-	iterator pivot(get_iterator(index));
-	iterator convey(get_iterator(size() - 1));
-	// Have to access element directly, get_iterator when add bound check will cause problem.
-	iterator target(&m_elements[size() + count_size - 1]);
-
-	while (pivot <= convey)
-	{
-		std::allocator_traits<allocator_type>::construct(m_allocator, target.content(), *convey);
-		std::allocator_traits<allocator_type>::destroy(m_allocator, convey.content());
-		--target;
-		--convey;
-	}
-	++convey;
-	++target;
-	for (auto first(p_first); first != p_last; ++first, ++convey)
-	{
-		std::allocator_traits<allocator_type>::construct(m_allocator, convey.content(), *first);
-	}
-
-	m_size += count_size;
-
-	return --convey;
+	IIterator source(p_first);
+	return construct_at_gap(index, count_size, [&](pointer p_slot, size_type)
+							{ std::allocator_traits<allocator_type>::construct(m_allocator, p_slot, *source++); });
 }
 
-template <typename Elem, typename Alloc>
+template <typename Elem, typename Alloc, typename GrowthPolicy>
 template <class... Args>
-CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::iterator dsaa::DynamicArray<Elem, Alloc>::emplace_at(const const_iterator &p_position, Args &&...p_args)
+CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::iterator dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::emplace_at(const const_iterator &p_position, Args &&...p_args)
 {
 #ifdef PARAM_CHECK
 	if (p_position < begin())
@@ -1174,26 +1320,16 @@ CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc>::iterator dsaa::DynamicArray<
 		throw std::invalid_argument("p_position can not greater than end().\n");
 #endif
 
-	size_t index(get_index(p_position)); // reserve can make iterator to p_position become invalid.
-	if (size() == capacity())
-		reserve(size() == 0 ? 8 : 2 * size()); // Make sure we have enough space.
-
-	// First copy last element into uninitialized space.
-	std::allocator_traits<allocator_type>::construct(m_allocator, &m_elements[m_size], last());
-	++m_size;
-
-	iterator desired(get_iterator(index)); // The place to put value.
-	for (iterator last_elem(&last()); last_elem != desired; --last_elem)
-		*last_elem = *(last_elem - 1); // Copy element one position to the right.
+	size_type index(p_position - cbegin()); // reserve can make iterator to p_position become invalid.
+	value_type value(std::forward<Args>(p_args)...);
+	grow(size() + 1); // Make sure we have enough space.
 
-	std::allocator_traits<allocator_type>::destroy(m_allocator, desired.content());
-	std::allocator_traits<allocator_type>::construct(m_allocator, desired.content(), p_args...);
-
-	return desired;
+	return construct_at_gap(index, 1, [&](pointer p_slot, size_type)
+							{ std::allocator_traits<allocator_type>::construct(m_allocator, p_slot, std::move(value)); });
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR void dsaa::DynamicArray<Elem, Alloc>::erase_at(const const_iterator &p_position) NOEXCEPT
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR void dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::erase_at(const const_iterator &p_position) NOEXCEPT
 {
 #ifdef PARAM_CHECK
 	if (p_position < begin())
@@ -1202,16 +1338,24 @@ CONSTEXPR void dsaa::DynamicArray<Elem, Alloc>::erase_at(const const_iterator &p
 		throw std::invalid_argument("p_position can not greater than last().\n");
 #endif
 
-	for (iterator position(p_position + 1); position != end(); ++position)
+	size_type index(p_position - cbegin());
+	std::allocator_traits<allocator_type>::destroy(m_allocator, &m_elements[index]);
+	// Close the hole by sliding the tail one position to the left.
+	try
 	{
-		*(position - 1) = *position;
+		dsaa::relocate_left(m_allocator, &m_elements[index + 1], size() - index - 1, 1);
 	}
-
-	erase_last();
+	catch (...)
+	{
+		// A throwing copy destroyed the tail.
+		m_size = index;
+		throw;
+	}
+	--m_size;
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR void dsaa::DynamicArray<Elem, Alloc>::erase(const const_iterator &p_first, const const_iterator &p_last) NOEXCEPT
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR void dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::erase(const const_iterator &p_first, const const_iterator &p_last) NOEXCEPT
 {
 #ifdef PARAM_CHECK
 	if (p_last < p_first)
@@ -1222,26 +1366,87 @@ CONSTEXPR void dsaa::DynamicArray<Elem, Alloc>::erase(const const_iterator &p_fi
 		throw std::invalid_argument("p_last can not greater than end().\n");
 #endif
 
-	iterator first(p_first), last(p_last);
+	size_type first(p_first - cbegin()), last(p_last - cbegin());
+	if (first == last)
+		return;
 
-	while (last != end())
+	for (size_type i(first); i != last; ++i)
+		std::allocator_traits<allocator_type>::destroy(m_allocator, &m_elements[i]);
+	// Close the hole by sliding the tail to the left.
+	try
+	{
+		dsaa::relocate_left(m_allocator, &m_elements[last], size() - last, last - first);
+	}
+	catch (...)
 	{
-		*first = *last;
-		++first;
-		++last;
+		// A throwing copy destroyed the tail.
+		m_size = first;
+		throw;
 	}
+	m_size -= last - first;
+}
+
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR void dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::grow(const size_type &p_required)
+{
+	if (capacity() < p_required)
+		reserve(m_growth_policy(capacity(), p_required));
+}
 
-	int offset(end() - first);
-	while (first != end())
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+template <typename Construct>
+CONSTEXPR typename dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::iterator dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::construct_at_gap(const size_type &p_index, const size_type &p_size, Construct p_construct)
+{
+	pointer gap(m_elements + p_index);
+	// Move the tail out of the way, leaving p_size uninitialized slots at p_index.
+	try
 	{
-		std::allocator_traits<allocator_type>::destroy(m_allocator, first.content());
-		++first;
+		dsaa::relocate_right(m_allocator, gap, size() - p_index, p_size);
 	}
-	m_size -= offset;
+	catch (...)
+	{
+		// A throwing copy destroyed the tail.
+		m_size = p_index;
+		throw;
+	}
+
+	size_type constructed(0);
+	try
+	{
+		for (; constructed != p_size; ++constructed)
+			p_construct(gap + constructed, constructed);
+	}
+	catch (...)
+	{
+		// Put the container back the way it was.
+		while (constructed)
+			std::allocator_traits<allocator_type>::destroy(m_allocator, gap + --constructed);
+		try
+		{
+			dsaa::relocate_left(m_allocator, gap + p_size, size() - p_index, p_size);
+		}
+		catch (...)
+		{
+			m_size = p_index;
+			throw;
+		}
+		throw;
+	}
+
+	m_size += p_size;
+	return iterator(gap + (p_size ? p_size - 1 : 0));
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR void dsaa::DynamicArray<Elem, Alloc>::erase_last() noexcept
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+template <typename IIterator>
+CONSTEXPR void dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::append_sized(IIterator p_first, const size_type &p_size)
+{
+	AppendBuilder builder(append_builder(p_size));
+	for (size_type i(0); i != p_size; ++i, ++p_first)
+		builder.emplace_last_unchecked(*p_first);
+}
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR void dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::erase_last() noexcept
 {
 #ifdef PARAM_CHECK
 	if (size() == 0)
@@ -1253,8 +1458,8 @@ CONSTEXPR void dsaa::DynamicArray<Elem, Alloc>::erase_last() noexcept
 	--m_size;
 }
 
-template <typename Elem, typename Alloc>
-CONSTEXPR void dsaa::DynamicArray<Elem, Alloc>::clear() noexcept
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+CONSTEXPR void dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::clear() noexcept
 {
 	// Clean up all elements.
 	for (iterator i(begin()); i != end(); ++i)
@@ -1263,8 +1468,8 @@ CONSTEXPR void dsaa::DynamicArray<Elem, Alloc>::clear() noexcept
 	m_size = 0;
 }
 
-// template <typename Elem, typename Alloc>
-// CONSTEXPR void dsaa::DynamicArray<Elem, Alloc>::swap(DynamicArray &p_other) noexcept(std::allocator_traits<allocator_type>::propagate_on_container_swap::value || std::allocator_traits<allocator_type>::is_always_equal::value)
+// template <typename Elem, typename Alloc, typename GrowthPolicy>
+// CONSTEXPR void dsaa::DynamicArray<Elem, Alloc, GrowthPolicy>::swap(DynamicArray &p_other) noexcept(std::allocator_traits<allocator_type>::propagate_on_container_swap::value || std::allocator_traits<allocator_type>::is_always_equal::value)
 // {
 // }
 
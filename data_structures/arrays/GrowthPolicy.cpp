@@ -0,0 +1 @@
+#include "GrowthPolicy.h"
\ No newline at end of file
@@ -0,0 +1,109 @@
+#ifndef DSAA_GROWTH_POLICY_H
+#define DSAA_GROWTH_POLICY_H
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "dsaaTypedefs.h"
+
+namespace dsaa
+{
+	// A growth policy decides the new capacity of a container that ran out of space.
+	// It is any callable `size_t(size_t p_capacity, size_t p_required)` returning a capacity not less than p_required.
+	// A policy may also provide `void on_reallocate(size_t p_bytes_relocated, size_t p_bytes_allocated)` to observe every
+	// reallocation: the element bytes moved to the new block and the size of that block.
+
+	// Doubles the capacity, starting from 8 elements.
+	struct DoublingGrowth
+	{
+		NODISCARD CONSTEXPR INLINE size_t operator()(size_t p_capacity, size_t p_required) const noexcept
+		{
+			size_t result(p_capacity == 0 ? 8 : 2 * p_capacity);
+			return result < p_required ? p_required : result;
+		}
+	};
+
+	// Grows the capacity by half, starting from 8 elements.
+	// Peak memory during a reallocation is 2.5 times the old buffer instead of 3 times with doubling.
+	struct HalfGrowth
+	{
+		NODISCARD CONSTEXPR INLINE size_t operator()(size_t p_capacity, size_t p_required) const noexcept
+		{
+			size_t result(p_capacity < 8 ? 8 : p_capacity + p_capacity / 2);
+			return result < p_required ? p_required : result;
+		}
+	};
+
+	// Grows the capacity by a fixed number of elements.
+	// Insertion is no longer amortized constant time, but memory overhead is bounded by Chunk elements.
+	template <size_t Chunk>
+	struct ChunkGrowth
+	{
+		static_assert(0 < Chunk, "Chunk must be greater than zero.");
+
+		NODISCARD CONSTEXPR INLINE size_t operator()(size_t, size_t p_required) const noexcept
+		{
+			return (p_required + Chunk - 1) / Chunk * Chunk;
+		}
+	};
+
+	// Wraps Policy and counts the reallocations and the bytes relocated and allocated by the container using it.
+	// Assigning one takes only the wrapped Policy and resets the counters, so an assigned container counts its own reallocations.
+	template <typename Policy = DoublingGrowth>
+	class CountingGrowth : public Policy
+	{
+	public:
+		CONSTEXPR CountingGrowth() = default;
+		CONSTEXPR explicit CountingGrowth(const Policy &p_policy) : Policy(p_policy) {}
+		CONSTEXPR CountingGrowth(const CountingGrowth &) = default;
+		CONSTEXPR CountingGrowth(CountingGrowth &&) = default;
+
+		CONSTEXPR CountingGrowth &operator=(const CountingGrowth &p_other) noexcept(std::is_nothrow_copy_assignable_v<Policy>)
+		{
+			Policy::operator=(p_other);
+			reset();
+			return *this;
+		}
+		CONSTEXPR CountingGrowth &operator=(CountingGrowth &&p_other) noexcept(std::is_nothrow_move_assignable_v<Policy>)
+		{
+			Policy::operator=(static_cast<Policy &&>(p_other));
+			reset();
+			return *this;
+		}
+
+		CONSTEXPR INLINE void on_reallocate(size_t p_bytes_relocated, size_t p_bytes_allocated) noexcept
+		{
+			++m_reallocations;
+			m_bytes_relocated += p_bytes_relocated;
+			m_bytes_allocated += p_bytes_allocated;
+		}
+
+		// Returns the number of times the container moved to a new buffer.
+		NODISCARD CONSTEXPR INLINE size_t reallocations() const noexcept { return m_reallocations; }
+		// Returns the number of element bytes the container moved to new buffers.
+		// Blocks grown in place by an allocator's reallocate count as zero bytes.
+		NODISCARD CONSTEXPR INLINE size_t bytes_relocated() const noexcept { return m_bytes_relocated; }
+		// Returns the number of bytes of the blocks the container reallocated to, including the ones grown in place.
+		NODISCARD CONSTEXPR INLINE size_t bytes_allocated() const noexcept { return m_bytes_allocated; }
+
+		CONSTEXPR INLINE void reset() noexcept { m_reallocations = m_bytes_relocated = m_bytes_allocated = 0; }
+
+	private:
+		size_t m_reallocations = 0;
+		size_t m_bytes_relocated = 0;
+		size_t m_bytes_allocated = 0;
+	};
+
+	template <typename Policy, typename = void>
+	struct has_on_reallocate : std::false_type
+	{
+	};
+
+	template <typename Policy>
+	struct has_on_reallocate<Policy, std::void_t<decltype(std::declval<Policy &>().on_reallocate(size_t(), size_t()))>> : std::true_type
+	{
+	};
+}
+
+#endif // !DSAA_GROWTH_POLICY_H
@@ -0,0 +1 @@
+#include "MappedDynamicArray.h"
\ No newline at end of file
@@ -0,0 +1,596 @@
+#ifndef DSAA_MAPPED_ARRAY_H
+#define DSAA_MAPPED_ARRAY_H
+
+#include <cstdint>
+#include <cstring>
+#include <cerrno>
+#include <string>
+#include <iterator>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "dsaaTypedefs.h"
+#include "GrowthPolicy.h"
+#include "DynamicArray.h"
+#include "memory/BinaryHeader.h"
+
+namespace dsaa
+{
+	// How a MappedDynamicArray opens its file.
+	enum class MappedMode
+	{
+		open_or_create, // Reopens the elements saved in the file, or starts an empty array if there is no file.
+		truncate		// Discards the content of the file.
+	};
+
+	// Access pattern hints forwarded to madvise.
+	enum class MappedAdvice
+	{
+		normal,
+		sequential,
+		random,
+		will_need,
+		dont_need
+	};
+
+	// A DynamicArray whose elements live in a file mapped with mmap, so it can hold more data than RAM.
+	// The file starts with a BinaryHeader recording the element type and count, followed by the elements,
+	// so reopening a file maps the saved elements back without reading or copying them. Being the format of save,
+	// a saved DynamicArray opens as a MappedDynamicArray, and load or MappedView read the file of a closed one.
+	// Growing extends the file with ftruncate and the mapping with mremap. Linux only.
+	template <typename Elem, typename GrowthPolicy = DoublingGrowth>
+	class MappedDynamicArray final
+	{
+	public:
+		using value_type = Elem;
+		using growth_policy_type = GrowthPolicy;
+		using reference = value_type &;
+		using const_reference = value_type const &;
+		using pointer = value_type *;
+		using const_pointer = value_type const *;
+		using const_iterator = typename DynamicArray<Elem>::const_iterator;
+		using iterator = typename DynamicArray<Elem>::iterator;
+		using reverse_iterator = std::reverse_iterator<iterator>;
+		using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+		using difference_type = typename std::iterator_traits<iterator>::difference_type;
+		using size_type = size_t;
+
+		static_assert(std::is_trivially_copyable_v<value_type>, "MappedDynamicArray stores elements as raw bytes in a file.");
+		static_assert(alignof(value_type) <= 64, "MappedDynamicArray aligns elements to 64 bytes.");
+
+		// Returns an iterator pointing to the first element in the container.
+		NODISCARD CONSTEXPR INLINE iterator begin() noexcept;
+		NODISCARD CONSTEXPR INLINE const_iterator begin() const noexcept;
+		NODISCARD CONSTEXPR INLINE const_iterator cbegin() const noexcept;
+		// Returns an iterator referring to the past-the-end element in the container.
+		NODISCARD CONSTEXPR INLINE iterator end() noexcept;
+		NODISCARD CONSTEXPR INLINE const_iterator end() const noexcept;
+		NODISCARD CONSTEXPR INLINE const_iterator cend() const noexcept;
+		// Returns a reverse_iterator pointing to the last element in the container.
+		NODISCARD CONSTEXPR INLINE reverse_iterator rbegin() noexcept;
+		NODISCARD CONSTEXPR INLINE const_reverse_iterator rbegin() const noexcept;
+		// Returns a reverse iterator pointing to the theoretical element preceding the first element in the container.
+		NODISCARD CONSTEXPR INLINE reverse_iterator rend() noexcept;
+		NODISCARD CONSTEXPR INLINE const_reverse_iterator rend() const noexcept;
+
+		// Maps the file at p_path, creating it when needed.
+		explicit MappedDynamicArray(const std::string &p_path, MappedMode p_mode = MappedMode::open_or_create);
+		MappedDynamicArray(const MappedDynamicArray &) = delete;
+		// Takes over the mapping of p_other, which is left closed.
+		MappedDynamicArray(MappedDynamicArray &&p_other) noexcept;
+		MappedDynamicArray &operator=(const MappedDynamicArray &) = delete;
+		MappedDynamicArray &operator=(MappedDynamicArray &&p_other) noexcept;
+		// Records the size in the file and unmaps it. Dirty pages are written back by the kernel.
+		~MappedDynamicArray();
+
+		// Returns a reference to the element at position p_index in the container.
+		NODISCARD CONSTEXPR INLINE reference operator[](const size_type &p_index) NOEXCEPT;
+		NODISCARD CONSTEXPR INLINE const_reference operator[](const size_type &p_index) const NOEXCEPT;
+		// Bounds checking that returns a reference to the element at position p_index in the container.
+		NODISCARD CONSTEXPR INLINE reference at(const size_type &p_index);
+		NODISCARD CONSTEXPR INLINE const_reference at(const size_type &p_index) const;
+		// Returns a reference to the first element in the container.
+		NODISCARD CONSTEXPR INLINE reference first() NOEXCEPT;
+		NODISCARD CONSTEXPR INLINE const_reference first() const NOEXCEPT;
+		// Returns a reference to the last element in the container.
+		NODISCARD CONSTEXPR INLINE reference last() NOEXCEPT;
+		NODISCARD CONSTEXPR INLINE const_reference last() const NOEXCEPT;
+		// Returns a direct pointer to the mapped elements.
+		NODISCARD CONSTEXPR INLINE pointer data() noexcept;
+		NODISCARD CONSTEXPR INLINE const_pointer data() const noexcept;
+		// Returns the path of the backing file.
+		NODISCARD CONSTEXPR INLINE const std::string &path() const noexcept;
+
+		// Test whether container is empty.
+		NODISCARD CONSTEXPR INLINE bool empty() const noexcept;
+		// Returns the number of elements the file currently has room for.
+		NODISCARD CONSTEXPR INLINE size_type capacity() const noexcept;
+		// Returns the number of elements in the container.
+		NODISCARD CONSTEXPR INLINE size_type size() const noexcept;
+		// Resizes the container so that it contains p_size elements.
+		void resize(const size_type &p_size, const_reference p_value = value_type());
+		// Extends the file and the mapping to hold p_capacity elements.
+		void reserve(const size_type &p_capacity);
+		// Truncates the file to the elements in use.
+		void shrink_to_fit();
+
+		// Increase MappedDynamicArray size by one, initialize new element with p_value.
+		iterator insert_last(const_reference p_value);
+		template <class IIterator>
+		iterator insert_last(const IIterator &p_first, const IIterator &p_last);
+		// Removes the last element, effectively reducing the container size by one.
+		CONSTEXPR INLINE void erase_last() noexcept;
+		// Removes all elements. The file keeps its capacity.
+		CONSTEXPR INLINE void clear() noexcept;
+
+		// Tells the kernel how the elements are going to be accessed.
+		void advise(MappedAdvice p_advice);
+		// Records the size in the file and writes dirty pages back, waiting for the writes unless p_async is set.
+		void sync(bool p_async = false);
+
+	private:
+		// The file starts with the BinaryHeader of save and MappedView, recording the size as its single extent. Elements start right after it.
+		static constexpr size_type header_size = BinaryHeader::header_size;
+
+		NODISCARD INLINE BinaryHeader *header() noexcept;
+		NODISCARD static INLINE size_type file_size(const size_type &p_capacity) noexcept;
+		[[noreturn]] static void throw_errno(const char *p_what);
+		// Records the size in the header, unmaps the file and closes it.
+		void close() noexcept;
+
+		std::string m_path;
+		int m_file;
+		unsigned char *m_mapping;
+		size_type m_capacity;
+		size_type m_size;
+		[[no_unique_address]] growth_policy_type m_growth_policy;
+	};
+}
+
+template <typename Elem, typename GrowthPolicy>
+CONSTEXPR typename dsaa::MappedDynamicArray<Elem, GrowthPolicy>::iterator dsaa::MappedDynamicArray<Elem, GrowthPolicy>::begin() noexcept
+{
+	return size() ? iterator(data()) : iterator(nullptr);
+}
+
+template <typename Elem, typename GrowthPolicy>
+CONSTEXPR typename dsaa::MappedDynamicArray<Elem, GrowthPolicy>::const_iterator dsaa::MappedDynamicArray<Elem, GrowthPolicy>::begin() const noexcept
+{
+	return size() ? const_iterator(data()) : const_iterator(nullptr);
+}
+
+template <typename Elem, typename GrowthPolicy>
+CONSTEXPR typename dsaa::MappedDynamicArray<Elem, GrowthPolicy>::const_iterator dsaa::MappedDynamicArray<Elem, GrowthPolicy>::cbegin() const noexcept
+{
+	return begin();
+}
+
+template <typename Elem, typename GrowthPolicy>
+CONSTEXPR typename dsaa::MappedDynamicArray<Elem, GrowthPolicy>::iterator dsaa::MappedDynamicArray<Elem, GrowthPolicy>::end() noexcept
+{
+	return size() ? iterator(data() + size()) : iterator(nullptr);
+}
+
+template <typename Elem, typename GrowthPolicy>
+CONSTEXPR typename dsaa::MappedDynamicArray<Elem, GrowthPolicy>::const_iterator dsaa::MappedDynamicArray<Elem, GrowthPolicy>::end() const noexcept
+{
+	return size() ? const_iterator(data() + size()) : const_iterator(nullptr);
+}
+
+template <typename Elem, typename GrowthPolicy>
+CONSTEXPR typename dsaa::MappedDynamicArray<Elem, GrowthPolicy>::const_iterator dsaa::MappedDynamicArray<Elem, GrowthPolicy>::cend() const noexcept
+{
+	return end();
+}
+
+template <typename Elem, typename GrowthPolicy>
+CONSTEXPR typename dsaa::MappedDynamicArray<Elem, GrowthPolicy>::reverse_iterator dsaa::MappedDynamicArray<Elem, GrowthPolicy>::rbegin() noexcept
+{
+	return reverse_iterator(end());
+}
+
+template <typename Elem, typename GrowthPolicy>
+CONSTEXPR typename dsaa::MappedDynamicArray<Elem, GrowthPolicy>::const_reverse_iterator dsaa::MappedDynamicArray<Elem, GrowthPolicy>::rbegin() const noexcept
+{
+	return const_reverse_iterator(end());
+}
+
+template <typename Elem, typename GrowthPolicy>
+CONSTEXPR typename dsaa::MappedDynamicArray<Elem, GrowthPolicy>::reverse_iterator dsaa::MappedDynamicArray<Elem, GrowthPolicy>::rend() noexcept
+{
+	return reverse_iterator(begin());
+}
+
+template <typename Elem, typename GrowthPolicy>
+CONSTEXPR typename dsaa::MappedDynamicArray<Elem, GrowthPolicy>::const_reverse_iterator dsaa::MappedDynamicArray<Elem, GrowthPolicy>::rend() const noexcept
+{
+	return const_reverse_iterator(begin());
+}
+
+template <typename Elem, typename GrowthPolicy>
+dsaa::MappedDynamicArray<Elem, GrowthPolicy>::MappedDynamicArray(const std::string &p_path, MappedMode p_mode)
+	: m_path(p_path), m_file(-1), m_mapping(nullptr), m_capacity(0), m_size(0), m_growth_policy()
+{
+	m_file = ::open(m_path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC | (p_mode == MappedMode::truncate ? O_TRUNC : 0), 0644);
+	if (m_file < 0)
+		throw_errno("MappedDynamicArray: can not open file");
+
+	struct stat status;
+	if (::fstat(m_file, &status) < 0)
+	{
+		::close(m_file);
+		throw_errno("MappedDynamicArray: can not stat file");
+	}
+
+	size_type bytes(static_cast<size_type>(status.st_size));
+	bool fresh(bytes == 0);
+	if (fresh)
+	{
+		bytes = header_size;
+		if (::ftruncate(m_file, bytes) < 0)
+		{
+			::close(m_file);
+			throw_errno("MappedDynamicArray: can not extend file");
+		}
+	}
+	else if (bytes < header_size)
+	{
+		::close(m_file);
+		throw std::runtime_error("MappedDynamicArray: file is too small to hold a header.");
+	}
+
+	void *mapping(::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, m_file, 0));
+	if (MAP_FAILED == mapping)
+	{
+		::close(m_file);
+		throw_errno("MappedDynamicArray: can not map file");
+	}
+	m_mapping = static_cast<unsigned char *>(mapping);
+	m_capacity = (bytes - header_size) / sizeof(value_type);
+
+	if (fresh)
+	{
+		*header() = BinaryHeader::make<value_type>(1, 0);
+		return;
+	}
+
+	try
+	{
+		header()->template check<value_type>(1, bytes - header_size);
+	}
+	catch (const std::runtime_error &p_error)
+	{
+		// Leave a foreign file untouched, close() would write our header into it.
+		::munmap(m_mapping, bytes);
+		::close(m_file);
+		throw std::runtime_error(std::string("MappedDynamicArray: ") + p_error.what());
+	}
+	m_size = header()->extents[0];
+}
+
+template <typename Elem, typename GrowthPolicy>
+dsaa::MappedDynamicArray<Elem, GrowthPolicy>::MappedDynamicArray(MappedDynamicArray &&p_other) noexcept
+	: m_path(std::move(p_other.m_path)), m_file(p_other.m_file), m_mapping(p_other.m_mapping),
+	  m_capacity(p_other.m_capacity), m_size(p_other.m_size), m_growth_policy(std::move(p_other.m_growth_policy))
+{
+	p_other.m_file = -1;
+	p_other.m_mapping = nullptr;
+	p_other.m_capacity = p_other.m_size = 0;
+}
+
+template <typename Elem, typename GrowthPolicy>
+dsaa::MappedDynamicArray<Elem, GrowthPolicy> &dsaa::MappedDynamicArray<Elem, GrowthPolicy>::operator=(MappedDynamicArray &&p_other) noexcept
+{
+	if (this == &p_other)
+		return *this;
+
+	close();
+	m_path = std::move(p_other.m_path);
+	m_file = p_other.m_file;
+	m_mapping = p_other.m_mapping;
+	m_capacity = p_other.m_capacity;
+	m_size = p_other.m_size;
+	m_growth_policy = std::move(p_other.m_growth_policy);
+
+	p_other.m_file = -1;
+	p_other.m_mapping = nullptr;
+	p_other.m_capacity = p_other.m_size = 0;
+	return *this;
+}
+
+template <typename Elem, typename GrowthPolicy>
+dsaa::MappedDynamicArray<Elem, GrowthPolicy>::~MappedDynamicArray()
+{
+	close();
+}
+
+template <typename Elem, typename GrowthPolicy>
+CONSTEXPR typename dsaa::MappedDynamicArray<Elem, GrowthPolicy>::reference dsaa::MappedDynamicArray<Elem, GrowthPolicy>::operator[](const size_type &p_index) NOEXCEPT
+{
+#ifdef PARAM_CHECK
+	if (size() <= p_index)
+		throw std::out_of_range("p_index out of range exception.\n;");
+#endif
+
+	return data()[p_index];
+}
+
+template <typename Elem, typename GrowthPolicy>
+CONSTEXPR typename dsaa::MappedDynamicArray<Elem, GrowthPolicy>::const_reference dsaa::MappedDynamicArray<Elem, GrowthPolicy>::operator[](const size_type &p_index) const NOEXCEPT
+{
+#ifdef PARAM_CHECK
+	if (size() <= p_index)
+		throw std::out_of_range("p_index out of range exception.\n;");
+#endif
+
+	return data()[p_index];
+}
+
+template <typename Elem, typename GrowthPolicy>
+CONSTEXPR typename dsaa::MappedDynamicArray<Elem, GrowthPolicy>::reference dsaa::MappedDynamicArray<Elem, GrowthPolicy>::at(const size_type &p_index)
+{
+	if (size() <= p_index)
+		throw std::out_of_range("p_index out of range exception.\n");
+
+	return data()[p_index];
+}
+
+template <typename Elem, typename GrowthPolicy>
+CONSTEXPR typename dsaa::MappedDynamicArray<Elem, GrowthPolicy>::const_reference dsaa::MappedDynamicArray<Elem, GrowthPolicy>::at(const size_type &p_index) const
+{
+	if (size() <= p_index)
+		throw std::out_of_range("p_index out of range exception.\n");
+
+	return data()[p_index];
+}
+
+template <typename Elem, typename GrowthPolicy>
+CONSTEXPR typename dsaa::MappedDynamicArray<Elem, GrowthPolicy>::reference dsaa::MappedDynamicArray<Elem, GrowthPolicy>::first() NOEXCEPT
+{
+#ifdef PARAM_CHECK
+	if (!size())
+		throw std::runtime_error("size() is zero, which means MappedDynamicArray currently empty.");
+#endif
+
+	return data()[0];
+}
+
+template <typename Elem, typename GrowthPolicy>
+CONSTEXPR typename dsaa::MappedDynamicArray<Elem, GrowthPolicy>::const_reference dsaa::MappedDynamicArray<Elem, GrowthPolicy>::first() const NOEXCEPT
+{
+#ifdef PARAM_CHECK
+	if (!size())
+		throw std::runtime_error("size() is zero, which means MappedDynamicArray currently empty.");
+#endif
+
+	return data()[0];
+}
+
+template <typename Elem, typename GrowthPolicy>
+CONSTEXPR typename dsaa::MappedDynamicArray<Elem, GrowthPolicy>::reference dsaa::MappedDynamicArray<Elem, GrowthPolicy>::last() NOEXCEPT
+{
+#ifdef PARAM_CHECK
+	if (!size())
+		throw std::runtime_error("size() is zero, which means MappedDynamicArray currently empty.");
+#endif
+
+	return data()[size() - 1];
+}
+
+template <typename Elem, typename GrowthPolicy>
+CONSTEXPR typename dsaa::MappedDynamicArray<Elem, GrowthPolicy>::const_reference dsaa::MappedDynamicArray<Elem, GrowthPolicy>::last() const NOEXCEPT
+{
+#ifdef PARAM_CHECK
+	if (!size())
+		throw std::runtime_error("size() is zero, which means MappedDynamicArray currently empty.");
+#endif
+
+	return data()[size() - 1];
+}
+
+template <typename Elem, typename GrowthPolicy>
+CONSTEXPR typename dsaa::MappedDynamicArray<Elem, GrowthPolicy>::pointer dsaa::MappedDynamicArray<Elem, GrowthPolicy>::data() noexcept
+{
+	return m_mapping ? reinterpret_cast<pointer>(m_mapping + header_size) : nullptr;
+}
+
+template <typename Elem, typename GrowthPolicy>
+CONSTEXPR typename dsaa::MappedDynamicArray<Elem, GrowthPolicy>::const_pointer dsaa::MappedDynamicArray<Elem, GrowthPolicy>::data() const noexcept
+{
+	return m_mapping ? reinterpret_cast<const_pointer>(m_mapping + header_size) : nullptr;
+}
+
+template <typename Elem, typename GrowthPolicy>
+CONSTEXPR const std::string &dsaa::MappedDynamicArray<Elem, GrowthPolicy>::path() const noexcept
+{
+	return m_path;
+}
+
+template <typename Elem, typename GrowthPolicy>
+CONSTEXPR bool dsaa::MappedDynamicArray<Elem, GrowthPolicy>::empty() const noexcept
+{
+	return size() == 0;
+}
+
+template <typename Elem, typename GrowthPolicy>
+CONSTEXPR typename dsaa::MappedDynamicArray<Elem, GrowthPolicy>::size_type dsaa::MappedDynamicArray<Elem, GrowthPolicy>::capacity() const noexcept
+{
+	return m_capacity;
+}
+
+template <typename Elem, typename GrowthPolicy>
+CONSTEXPR typename dsaa::MappedDynamicArray<Elem, GrowthPolicy>::size_type dsaa::MappedDynamicArray<Elem, GrowthPolicy>::size() const noexcept
+{
+	return m_size;
+}
+
+template <typename Elem, typename GrowthPolicy>
+void dsaa::MappedDynamicArray<Elem, GrowthPolicy>::resize(const size_type &p_size, const_reference p_value)
+{
+	value_type value(p_value); // p_value may live in the mapping that reserve moves.
+	reserve(p_size);
+	for (; m_size < p_size; ++m_size)
+		data()[m_size] = value;
+	m_size = p_size;
+}
+
+template <typename Elem, typename GrowthPolicy>
+void dsaa::MappedDynamicArray<Elem, GrowthPolicy>::reserve(const size_type &p_capacity)
+{
+	// Never decrease allocation.
+	if (p_capacity <= m_capacity)
+		return;
+
+	if (::ftruncate(m_file, file_size(p_capacity)) < 0)
+		throw_errno("MappedDynamicArray: can not extend file");
+
+	// The kernel moves the page table entries, the elements themselves are never copied.
+	void *mapping(::mremap(m_mapping, file_size(m_capacity), file_size(p_capacity), MREMAP_MAYMOVE));
+	if (MAP_FAILED == mapping)
+		throw_errno("MappedDynamicArray: can not remap file");
+
+	m_mapping = static_cast<unsigned char *>(mapping);
+	m_capacity = p_capacity;
+	if constexpr (dsaa::has_on_reallocate<growth_policy_type>::value)
+		m_growth_policy.on_reallocate(0, p_capacity * sizeof(value_type));
+}
+
+template <typename Elem, typename GrowthPolicy>
+void dsaa::MappedDynamicArray<Elem, GrowthPolicy>::shrink_to_fit()
+{
+	if (size() == capacity())
+		return;
+
+	void *mapping(::mremap(m_mapping, file_size(m_capacity), file_size(m_size), MREMAP_MAYMOVE));
+	if (MAP_FAILED == mapping)
+		throw_errno("MappedDynamicArray: can not remap file");
+	m_mapping = static_cast<unsigned char *>(mapping);
+	m_capacity = m_size;
+
+	if (::ftruncate(m_file, file_size(m_capacity)) < 0)
+		throw_errno("MappedDynamicArray: can not truncate file");
+}
+
+template <typename Elem, typename GrowthPolicy>
+typename dsaa::MappedDynamicArray<Elem, GrowthPolicy>::iterator dsaa::MappedDynamicArray<Elem, GrowthPolicy>::insert_last(const_reference p_value)
+{
+	value_type value(p_value); // p_value may live in the mapping that reserve moves.
+	if (size() == capacity())
+		reserve(m_growth_policy(capacity(), size() + 1));
+
+	data()[m_size++] = value;
+	return end() - 1;
+}
+
+template <typename Elem, typename GrowthPolicy>
+template <class IIterator>
+typename dsaa::MappedDynamicArray<Elem, GrowthPolicy>::iterator dsaa::MappedDynamicArray<Elem, GrowthPolicy>::insert_last(const IIterator &p_first, const IIterator &p_last)
+{
+	size_type count_size(0);
+	for (auto i(p_first); i != p_last; ++i)
+		++count_size;
+	if (!count_size)
+		return end();
+	if (capacity() < size() + count_size)
+		reserve(m_growth_policy(capacity(), size() + count_size));
+
+	pointer destination(data() + size());
+	for (auto i(p_first); i != p_last; ++i)
+		*destination++ = *i;
+	m_size += count_size;
+	return end() - 1;
+}
+
+template <typename Elem, typename GrowthPolicy>
+CONSTEXPR void dsaa::MappedDynamicArray<Elem, GrowthPolicy>::erase_last() noexcept
+{
+#ifdef PARAM_CHECK
+	if (size() == 0)
+		std::terminate();
+#endif
+
+	--m_size;
+}
+
+template <typename Elem, typename GrowthPolicy>
+CONSTEXPR void dsaa::MappedDynamicArray<Elem, GrowthPolicy>::clear() noexcept
+{
+	m_size = 0;
+}
+
+template <typename Elem, typename GrowthPolicy>
+void dsaa::MappedDynamicArray<Elem, GrowthPolicy>::advise(MappedAdvice p_advice)
+{
+	int advice(MADV_NORMAL);
+	switch (p_advice)
+	{
+	case MappedAdvice::sequential:
+		advice = MADV_SEQUENTIAL;
+		break;
+	case MappedAdvice::random:
+		advice = MADV_RANDOM;
+		break;
+	case MappedAdvice::will_need:
+		advice = MADV_WILLNEED;
+		break;
+	case MappedAdvice::dont_need:
+		advice = MADV_DONTNEED;
+		break;
+	default:
+		break;
+	}
+
+	if (::madvise(m_mapping, file_size(m_capacity), advice) < 0)
+		throw_errno("MappedDynamicArray: madvise failed");
+}
+
+template <typename Elem, typename GrowthPolicy>
+void dsaa::MappedDynamicArray<Elem, GrowthPolicy>::sync(bool p_async)
+{
+	header()->extents[0] = m_size;
+	if (::msync(m_mapping, file_size(m_capacity), p_async ? MS_ASYNC : MS_SYNC) < 0)
+		throw_errno("MappedDynamicArray: msync failed");
+}
+
+template <typename Elem, typename GrowthPolicy>
+dsaa::BinaryHeader *dsaa::MappedDynamicArray<Elem, GrowthPolicy>::header() noexcept
+{
+	return reinterpret_cast<BinaryHeader *>(m_mapping);
+}
+
+template <typename Elem, typename GrowthPolicy>
+typename dsaa::MappedDynamicArray<Elem, GrowthPolicy>::size_type dsaa::MappedDynamicArray<Elem, GrowthPolicy>::file_size(const size_type &p_capacity) noexcept
+{
+	return header_size + p_capacity * sizeof(value_type);
+}
+
+template <typename Elem, typename GrowthPolicy>
+void dsaa::MappedDynamicArray<Elem, GrowthPolicy>::throw_errno(const char *p_what)
+{
+	throw std::system_error(errno, std::generic_category(), p_what);
+}
+
+template <typename Elem, typename GrowthPolicy>
+void dsaa::MappedDynamicArray<Elem, GrowthPolicy>::close() noexcept
+{
+	if (m_mapping)
+	{
+		header()->extents[0] = m_size;
+		::munmap(m_mapping, file_size(m_capacity));
+		m_mapping = nullptr;
+	}
+	if (0 <= m_file)
+	{
+		::close(m_file);
+		m_file = -1;
+	}
+	m_capacity = m_size = 0;
+}
+
+#endif // !DSAA_MAPPED_ARRAY_H
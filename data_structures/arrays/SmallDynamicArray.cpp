@@ -0,0 +1 @@
+#include "SmallDynamicArray.h"
\ No newline at end of file
@@ -0,0 +1,1009 @@
+#ifndef DSAA_SMALL_ARRAY_H
+#define DSAA_SMALL_ARRAY_H
+
+#include <memory>
+#include <initializer_list>
+#include <algorithm>
+#include <stdexcept>
+#include <iterator>
+#include <type_traits>
+
+#include "dsaaTypedefs.h"
+#include "memory/Relocate.h"
+#include "GrowthPolicy.h"
+#include "DynamicArray.h"
+
+namespace dsaa
+{
+	// A DynamicArray that keeps up to N elements inside the object and only allocates once it grows past N.
+	// Iterators are the ones of DynamicArray, so every algorithm working on a DynamicArray works on it too.
+	// Unlike DynamicArray, moving a SmallDynamicArray whose elements are inline moves the elements one by one.
+	template <typename Elem, size_t N, typename Alloc = std::allocator<Elem>, typename GrowthPolicy = DoublingGrowth>
+	class SmallDynamicArray
+	{
+	public:
+		using value_type = Elem;
+		using allocator_type = Alloc;
+		using growth_policy_type = GrowthPolicy;
+		using reference = value_type &;
+		using const_reference = value_type const &;
+		using pointer = typename std::allocator_traits<allocator_type>::pointer;
+		using const_pointer = typename std::allocator_traits<allocator_type>::const_pointer;
+		using const_iterator = typename DynamicArray<Elem, Alloc, GrowthPolicy>::const_iterator;
+		using iterator = typename DynamicArray<Elem, Alloc, GrowthPolicy>::iterator;
+		using reverse_iterator = std::reverse_iterator<iterator>;
+		using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+		using difference_type = typename std::iterator_traits<iterator>::difference_type;
+		using size_type = size_t;
+
+		static_assert(0 < N, "SmallDynamicArray needs room for at least one inline element.");
+		static_assert(std::is_pointer_v<pointer>, "SmallDynamicArray requires an allocator with raw pointers.");
+
+		// Returns an iterator pointing to the first element in the container.
+		NODISCARD CONSTEXPR INLINE iterator begin() noexcept;
+		NODISCARD CONSTEXPR INLINE const_iterator begin() const noexcept;
+		NODISCARD CONSTEXPR INLINE const_iterator cbegin() const noexcept;
+		// Returns an iterator referring to the past-the-end element in the container.
+		NODISCARD CONSTEXPR INLINE iterator end() noexcept;
+		NODISCARD CONSTEXPR INLINE const_iterator end() const noexcept;
+		NODISCARD CONSTEXPR INLINE const_iterator cend() const noexcept;
+		// Returns a reverse_iterator pointing to the last element in the container.
+		NODISCARD CONSTEXPR INLINE reverse_iterator rbegin() noexcept;
+		NODISCARD CONSTEXPR INLINE const_reverse_iterator rbegin() const noexcept;
+		NODISCARD CONSTEXPR INLINE const_reverse_iterator crbegin() const noexcept;
+		// Returns a reverse iterator pointing to the theoretical element preceding the first element in the container.
+		NODISCARD CONSTEXPR INLINE reverse_iterator rend() noexcept;
+		NODISCARD CONSTEXPR INLINE const_reverse_iterator rend() const noexcept;
+		NODISCARD CONSTEXPR INLINE const_reverse_iterator crend() const noexcept;
+
+		// Creates a container with no element.
+		SmallDynamicArray(const allocator_type &p_allocator = allocator_type()) noexcept;
+		// Creates a container's p_size elements with default value.
+		explicit SmallDynamicArray(const size_type &p_size, const allocator_type &p_allocator = allocator_type());
+		// Creates a container's p_size elements and init its element by p_value.
+		SmallDynamicArray(const size_type &p_size, const_reference p_value, const allocator_type &p_allocator = allocator_type());
+		// Creates a container's size equal to p_elements's size and init its elements by p_elements's element.
+		SmallDynamicArray(const std::initializer_list<value_type> &p_elements, const allocator_type &p_allocator = allocator_type());
+		// Creates a container and init its elements by content of IIterator in range (first, last].
+		template <typename IIterator>
+		SmallDynamicArray(const IIterator &p_first, const IIterator &p_last, const allocator_type &p_allocator = allocator_type());
+		// Creates a container and copy all emements from p_other.
+		SmallDynamicArray(const SmallDynamicArray &p_other);
+		// Creates a container and copy all emements from p_other.
+		SmallDynamicArray(const SmallDynamicArray &p_other, const allocator_type &p_allocator);
+		// Moves all elements from p_other into this.
+		SmallDynamicArray(SmallDynamicArray &&p_other) noexcept(std::is_nothrow_move_constructible_v<value_type>);
+		// Moves all elements from p_other into this. A heap block is only stolen when p_allocator equals p_other's allocator.
+		SmallDynamicArray(SmallDynamicArray &&p_other, const allocator_type &p_allocator) noexcept(std::is_nothrow_move_constructible_v<value_type> && std::allocator_traits<allocator_type>::is_always_equal::value);
+		// Destroys old elements and copy all emements from p_other into this.
+		SmallDynamicArray &operator=(const SmallDynamicArray &p_other);
+		// Destroys old elements and moves all emements from p_other into this. The allocator follows the elements when it
+		// propagates on move assignment, otherwise a heap block is only stolen when both allocators are equal.
+		SmallDynamicArray &operator=(SmallDynamicArray &&p_other) noexcept(std::is_nothrow_move_constructible_v<value_type> && (std::allocator_traits<allocator_type>::propagate_on_container_move_assignment::value || std::allocator_traits<allocator_type>::is_always_equal::value));
+		// Destroys old elements and copy all elements from p_elements.
+		SmallDynamicArray &operator=(const std::initializer_list<value_type> &p_elements);
+		// Destroys all elements and clean used space.
+		~SmallDynamicArray();
+
+		// Assigns new contents to the container, replacing its current contents, and modifying its size accordingly.
+		template <typename IIterator>
+		void assign(const IIterator &p_first, const IIterator &p_last);
+		void assign(const size_type &p_size, const value_type &p_value = value_type());
+		void assign(const std::initializer_list<value_type> &p_elements);
+
+		// Returns a reference to the element at position p_index in the container.
+		NODISCARD CONSTEXPR INLINE reference operator[](const size_type &p_index) NOEXCEPT;
+		NODISCARD CONSTEXPR INLINE const_reference operator[](const size_type &p_index) const NOEXCEPT;
+		// Bounds checking that returns a reference to the element at position p_index in the container.
+		NODISCARD CONSTEXPR INLINE reference at(const size_type &p_index);
+		NODISCARD CONSTEXPR INLINE const_reference at(const size_type &p_index) const;
+		// Returns a reference to the first element in the container.
+		NODISCARD CONSTEXPR INLINE reference first() NOEXCEPT;
+		NODISCARD CONSTEXPR INLINE const_reference first() const NOEXCEPT;
+		// Returns a reference to the last element in the container.
+		NODISCARD CONSTEXPR INLINE reference last() NOEXCEPT;
+		NODISCARD CONSTEXPR INLINE const_reference last() const NOEXCEPT;
+		// Returns a direct pointer to the memory array used internally by the container to store its owned elements.
+		NODISCARD CONSTEXPR INLINE pointer data() noexcept;
+		NODISCARD CONSTEXPR INLINE const_pointer data() const noexcept;
+		// Returns a copy of the allocator object associated with the container.
+		NODISCARD CONSTEXPR INLINE allocator_type get_allocator() const noexcept;
+		// Returns the growth policy object, e.g. to read the counters of a CountingGrowth.
+		NODISCARD CONSTEXPR INLINE growth_policy_type &growth_policy() noexcept;
+		NODISCARD CONSTEXPR INLINE growth_policy_type const &growth_policy() const noexcept;
+
+		// Test whether container is empty.
+		NODISCARD CONSTEXPR INLINE bool empty() const noexcept;
+		// Returns true while the elements live in the inline buffer.
+		NODISCARD CONSTEXPR INLINE bool is_small() const noexcept;
+		// Returns the number of elements the inline buffer can hold.
+		NODISCARD static CONSTEXPR INLINE size_type inline_capacity() noexcept;
+		// Returns the size of the storage space currently available for the container.
+		NODISCARD CONSTEXPR INLINE size_type capacity() const noexcept;
+		// Returns the number of elements in the container.
+		NODISCARD CONSTEXPR INLINE size_type size() const noexcept;
+		// Returns the maximum number of elements that the container can hold.
+		NODISCARD CONSTEXPR INLINE size_type max_size() const noexcept;
+		// Gets the corresponding index for given iterator.
+		NODISCARD CONSTEXPR INLINE size_type get_index(const const_iterator &p_position) NOEXCEPT;
+		// Gets the corresponding iterator for given index.
+		NODISCARD CONSTEXPR INLINE iterator get_iterator(const size_type &p_index) NOEXCEPT;
+		// Resizes the container so that it contains p_size elements.
+		void resize(const size_type &p_size, const_reference p_value = value_type());
+		// Moves the elements to a heap block of p_capacity elements when the current storage is too small.
+		void reserve(const size_type &p_capacity);
+		// Requests the container to reduce its capacity to fit its size, moving back inline when it fits.
+		void shrink_to_fit();
+
+		// Increase SmallDynamicArray size by one, initialize new element with p_value.
+		iterator insert_last(const_reference p_value);
+		iterator insert_last(value_type &&p_value);
+		iterator insert_last(const size_type &p_size, const_reference p_value);
+		iterator insert_last(const std::initializer_list<value_type> &p_elements);
+		template <class IIterator>
+		iterator insert_last(const IIterator &p_first, const IIterator &p_last);
+		template <class... Args>
+		iterator emplace_last(Args &&...p_args);
+
+		iterator insert_at(const const_iterator &p_position, const_reference p_value);
+		iterator insert_at(const const_iterator &p_position, value_type &&p_value);
+		iterator insert_at(const const_iterator &p_position, const size_type &p_size, const_reference p_value);
+		iterator insert_at(const const_iterator &p_position, const std::initializer_list<value_type> &p_elements);
+		template <class IIterator>
+		iterator insert_at(const const_iterator &p_position, const IIterator &p_first, const IIterator &p_last);
+		template <class... Args>
+		iterator emplace_at(const const_iterator &p_position, Args &&...p_args);
+
+		// Destroy element at p_position and reduce size of container.
+		void erase_at(const const_iterator &p_position) NOEXCEPT;
+		// Destroy element in range (first,last] and reduce size of container.
+		void erase(const const_iterator &p_first, const const_iterator &p_last) NOEXCEPT;
+		// Removes the last element, effectively reducing the container size by one.
+		CONSTEXPR INLINE void erase_last() noexcept;
+		// Destroys all elements from the container, leaving the size of 0.
+		CONSTEXPR INLINE void clear() noexcept;
+
+		// Exchanges the content of the container by the content of p_other. Sizes may differ.
+		void swap(SmallDynamicArray &p_other);
+
+	protected:
+		NODISCARD CONSTEXPR INLINE pointer inline_data() noexcept;
+		NODISCARD CONSTEXPR INLINE const_pointer inline_data() const noexcept;
+		// Gives heap storage back to the allocator and points the container at its inline buffer. Elements must be destroyed.
+		CONSTEXPR INLINE void release_storage() noexcept;
+		// Takes the elements of p_other, stealing its heap block when this allocator can free it, or else relocating them
+		// into this container's own storage. This must be empty and small.
+		void take(SmallDynamicArray &p_other);
+		// Makes sure there is space for p_required elements, asking the growth policy for the new capacity.
+		INLINE void grow(const size_type &p_required);
+		// Opens p_size uninitialized slots at p_index, fills them by calling p_construct(slot, offset) and returns the last one.
+		template <typename Construct>
+		iterator construct_at_gap(const size_type &p_index, const size_type &p_size, Construct p_construct);
+
+		allocator_type m_allocator;
+		size_type m_capacity;
+		size_type m_size;
+		pointer m_elements;
+		[[no_unique_address]] growth_policy_type m_growth_policy;
+		alignas(value_type) unsigned char m_buffer[N * sizeof(value_type)];
+	};
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::iterator dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::begin() noexcept
+{
+	return size() ? iterator(&m_elements[0]) : iterator(nullptr);
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::const_iterator dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::begin() const noexcept
+{
+	return size() ? const_iterator(&m_elements[0]) : const_iterator(nullptr);
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::const_iterator dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::cbegin() const noexcept
+{
+	return size() ? const_iterator(&m_elements[0]) : const_iterator(nullptr);
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::iterator dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::end() noexcept
+{
+	return size() ? iterator(&m_elements[size()]) : iterator(nullptr);
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::const_iterator dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::end() const noexcept
+{
+	return size() ? const_iterator(&m_elements[size()]) : const_iterator(nullptr);
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::const_iterator dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::cend() const noexcept
+{
+	return size() ? const_iterator(&m_elements[size()]) : const_iterator(nullptr);
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::reverse_iterator dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::rbegin() noexcept
+{
+	return reverse_iterator(end());
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::const_reverse_iterator dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::rbegin() const noexcept
+{
+	return const_reverse_iterator(end());
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::const_reverse_iterator dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::crbegin() const noexcept
+{
+	return const_reverse_iterator(end());
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::reverse_iterator dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::rend() noexcept
+{
+	return reverse_iterator(begin());
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::const_reverse_iterator dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::rend() const noexcept
+{
+	return const_reverse_iterator(begin());
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::const_reverse_iterator dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::crend() const noexcept
+{
+	return const_reverse_iterator(begin());
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::SmallDynamicArray(const allocator_type &p_allocator) noexcept
+	: m_allocator(p_allocator), m_capacity(N), m_size(0), m_elements(inline_data()), m_growth_policy() {}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::SmallDynamicArray(const size_type &p_size, const allocator_type &p_allocator)
+	: SmallDynamicArray(p_allocator)
+{
+	resize(p_size);
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::SmallDynamicArray(const size_type &p_size, const_reference p_value, const allocator_type &p_allocator)
+	: SmallDynamicArray(p_allocator)
+{
+	resize(p_size, p_value);
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::SmallDynamicArray(const std::initializer_list<value_type> &p_elements, const allocator_type &p_allocator)
+	: SmallDynamicArray(p_allocator)
+{
+	insert_last(p_elements);
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+template <typename IIterator>
+dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::SmallDynamicArray(const IIterator &p_first, const IIterator &p_last, const allocator_type &p_allocator)
+	: SmallDynamicArray(p_allocator)
+{
+	insert_last(p_first, p_last);
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::SmallDynamicArray(const SmallDynamicArray &p_other)
+	: SmallDynamicArray(std::allocator_traits<allocator_type>::select_on_container_copy_construction(p_other.get_allocator()))
+{
+	m_growth_policy = p_other.m_growth_policy;
+	insert_last(p_other.begin(), p_other.end());
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::SmallDynamicArray(const SmallDynamicArray &p_other, const allocator_type &p_allocator)
+	: SmallDynamicArray(p_allocator)
+{
+	m_growth_policy = p_other.m_growth_policy;
+	insert_last(p_other.begin(), p_other.end());
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::SmallDynamicArray(SmallDynamicArray &&p_other) noexcept(std::is_nothrow_move_constructible_v<value_type>)
+	: SmallDynamicArray(p_other.get_allocator())
+{
+	take(p_other);
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::SmallDynamicArray(SmallDynamicArray &&p_other, const allocator_type &p_allocator) noexcept(std::is_nothrow_move_constructible_v<value_type> && std::allocator_traits<allocator_type>::is_always_equal::value)
+	: SmallDynamicArray(p_allocator)
+{
+	take(p_other);
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy> &dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::operator=(const SmallDynamicArray &p_other)
+{
+	// Avoid self-reference.
+	if (this == &p_other)
+		return *this;
+
+	m_growth_policy = p_other.m_growth_policy;
+	assign(p_other.begin(), p_other.end());
+	return *this;
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy> &dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::operator=(SmallDynamicArray &&p_other) noexcept(std::is_nothrow_move_constructible_v<value_type> && (std::allocator_traits<allocator_type>::propagate_on_container_move_assignment::value || std::allocator_traits<allocator_type>::is_always_equal::value))
+{
+	if (this == &p_other)
+		return *this;
+
+	clear();
+	release_storage();
+	if constexpr (std::allocator_traits<allocator_type>::propagate_on_container_move_assignment::value)
+		m_allocator = p_other.m_allocator;
+	take(p_other);
+	return *this;
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy> &dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::operator=(const std::initializer_list<value_type> &p_elements)
+{
+	assign(p_elements);
+	return *this;
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::~SmallDynamicArray()
+{
+	clear();
+	release_storage();
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+template <typename IIterator>
+void dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::assign(const IIterator &p_first, const IIterator &p_last)
+{
+	clear();
+	insert_last(p_first, p_last);
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+void dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::assign(const size_type &p_size, const value_type &p_value)
+{
+	value_type value(p_value); // p_value may be one of the elements being cleared.
+	clear();
+	resize(p_size, value);
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+void dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::assign(const std::initializer_list<value_type> &p_elements)
+{
+	clear();
+	insert_last(p_elements);
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::reference dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::operator[](const size_type &p_index) NOEXCEPT
+{
+#ifdef PARAM_CHECK
+	if (size() <= p_index)
+		throw std::out_of_range("p_index out of range exception.\n;");
+#endif
+
+	return m_elements[p_index];
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::const_reference dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::operator[](const size_type &p_index) const NOEXCEPT
+{
+#ifdef PARAM_CHECK
+	if (size() <= p_index)
+		throw std::out_of_range("p_index out of range exception.\n;");
+#endif
+
+	return m_elements[p_index];
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::reference dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::at(const size_type &p_index)
+{
+	if (size() <= p_index)
+		throw std::out_of_range("p_index out of range exception.\n");
+
+	return m_elements[p_index];
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::const_reference dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::at(const size_type &p_index) const
+{
+	if (size() <= p_index)
+		throw std::out_of_range("p_index out of range exception.\n");
+
+	return m_elements[p_index];
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::reference dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::first() NOEXCEPT
+{
+#ifdef PARAM_CHECK
+	if (!size())
+		throw std::runtime_error("size() is zero, which means SmallDynamicArray currently empty.");
+#endif
+
+	return m_elements[0];
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::const_reference dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::first() const NOEXCEPT
+{
+#ifdef PARAM_CHECK
+	if (!size())
+		throw std::runtime_error("size() is zero, which means SmallDynamicArray currently empty.");
+#endif
+
+	return m_elements[0];
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::reference dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::last() NOEXCEPT
+{
+#ifdef PARAM_CHECK
+	if (!size())
+		throw std::runtime_error("size() is zero, which means SmallDynamicArray currently empty.");
+#endif
+
+	return m_elements[size() - 1];
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::const_reference dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::last() const NOEXCEPT
+{
+#ifdef PARAM_CHECK
+	if (!size())
+		throw std::runtime_error("size() is zero, which means SmallDynamicArray currently empty.");
+#endif
+
+	return m_elements[size() - 1];
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::pointer dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::data() noexcept
+{
+	return m_elements;
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::const_pointer dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::data() const noexcept
+{
+	return m_elements;
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::allocator_type dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::get_allocator() const noexcept
+{
+	return m_allocator;
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::growth_policy_type &dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::growth_policy() noexcept
+{
+	return m_growth_policy;
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::growth_policy_type const &dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::growth_policy() const noexcept
+{
+	return m_growth_policy;
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+CONSTEXPR bool dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::empty() const noexcept
+{
+	return size() == 0;
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+CONSTEXPR bool dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::is_small() const noexcept
+{
+	return m_elements == inline_data();
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::size_type dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::inline_capacity() noexcept
+{
+	return N;
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::size_type dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::capacity() const noexcept
+{
+	return m_capacity;
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::size_type dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::size() const noexcept
+{
+	return m_size;
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::size_type dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::max_size() const noexcept
+{
+	return std::allocator_traits<allocator_type>::max_size(m_allocator);
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::size_type dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::get_index(const const_iterator &p_position) NOEXCEPT
+{
+#ifdef PARAM_CHECK
+	if (!size())
+		throw std::runtime_error("size() is zero, which means SmallDynamicArray currently empty.");
+	if (p_position < begin())
+		throw std::range_error("Specified position is smaller than the index in array.\n");
+	if (end() < p_position)
+		throw std::range_error("Specified position is greater than the index in array.\n");
+#endif
+
+	return p_position - cbegin();
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::iterator dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::get_iterator(const size_type &p_index) NOEXCEPT
+{
+#ifdef PARAM_CHECK
+	if (!size())
+		throw std::runtime_error("size() is zero, which means SmallDynamicArray currently empty.");
+	if (size() < p_index)
+		throw std::range_error("Specified position is greater than the index in array.\n");
+#endif
+
+	return iterator(&m_elements[0]) + p_index;
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+void dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::resize(const size_type &p_size, const value_type &p_value)
+{
+	if (size() < p_size)
+	{
+		value_type value(p_value); // p_value may refer to an element that is about to be relocated.
+		reserve(p_size);
+		for (; m_size != p_size; ++m_size)
+			std::allocator_traits<allocator_type>::construct(m_allocator, &m_elements[m_size], value);
+	}
+	else
+	{
+		while (p_size != m_size)
+			erase_last();
+	}
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+void dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::reserve(const size_type &p_capacity)
+{
+	// Never decrease allocation.
+	if (p_capacity <= m_capacity)
+		return;
+
+	pointer elements = std::allocator_traits<allocator_type>::allocate(m_allocator, p_capacity);
+	// Relocate old elements to new place.
+	try
+	{
+		dsaa::uninitialized_relocate(m_allocator, m_elements, size(), elements);
+	}
+	catch (...)
+	{
+		std::allocator_traits<allocator_type>::deallocate(m_allocator, elements, p_capacity);
+		throw;
+	}
+	release_storage();
+	if constexpr (dsaa::has_on_reallocate<growth_policy_type>::value)
+		m_growth_policy.on_reallocate(size() * sizeof(value_type), p_capacity * sizeof(value_type));
+
+	m_capacity = p_capacity;
+	m_elements = elements;
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+void dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::shrink_to_fit()
+{
+	if (is_small() || size() == capacity())
+		return;
+
+	pointer elements(size() <= N ? inline_data() : std::allocator_traits<allocator_type>::allocate(m_allocator, size()));
+	try
+	{
+		dsaa::uninitialized_relocate(m_allocator, m_elements, size(), elements);
+	}
+	catch (...)
+	{
+		if (elements != inline_data())
+			std::allocator_traits<allocator_type>::deallocate(m_allocator, elements, size());
+		throw;
+	}
+	release_storage();
+	if constexpr (dsaa::has_on_reallocate<growth_policy_type>::value)
+		m_growth_policy.on_reallocate(size() * sizeof(value_type), elements == inline_data() ? 0 : size() * sizeof(value_type));
+
+	m_capacity = elements == inline_data() ? N : size();
+	m_elements = elements;
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+typename dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::iterator dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::insert_last(const_reference p_value)
+{
+	if (size() == capacity())
+	{
+		value_type value(p_value); // p_value may refer to an element that is about to be relocated.
+		grow(size() + 1);
+		std::allocator_traits<allocator_type>::construct(m_allocator, &m_elements[m_size], std::move(value));
+	}
+	else
+		std::allocator_traits<allocator_type>::construct(m_allocator, &m_elements[m_size], p_value);
+	++m_size;
+	return end() - 1;
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+typename dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::iterator dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::insert_last(value_type &&p_value)
+{
+	if (size() == capacity())
+	{
+		value_type value(std::move(p_value));
+		grow(size() + 1);
+		std::allocator_traits<allocator_type>::construct(m_allocator, &m_elements[m_size], std::move(value));
+	}
+	else
+		std::allocator_traits<allocator_type>::construct(m_allocator, &m_elements[m_size], std::move(p_value));
+	++m_size;
+	return end() - 1;
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+typename dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::iterator dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::insert_last(const size_type &p_size, const_reference p_value)
+{
+	return insert_at(cend(), p_size, p_value);
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+typename dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::iterator dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::insert_last(const std::initializer_list<value_type> &p_elements)
+{
+	return insert_at(cend(), p_elements);
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+template <class IIterator>
+typename dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::iterator dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::insert_last(const IIterator &p_first, const IIterator &p_last)
+{
+	return insert_at(cend(), p_first, p_last);
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+template <class... Args>
+typename dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::iterator dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::emplace_last(Args &&...p_args)
+{
+	if (size() == capacity())
+		return emplace_at(cend(), std::forward<Args>(p_args)...);
+
+	std::allocator_traits<allocator_type>::construct(m_allocator, &m_elements[m_size], std::forward<Args>(p_args)...);
+	++m_size;
+	return end() - 1;
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+typename dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::iterator dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::insert_at(const const_iterator &p_position, const_reference p_value)
+{
+#ifdef PARAM_CHECK
+	if (p_position < begin())
+		throw std::invalid_argument("p_position can not less than begin().\n");
+	if (end() < p_position)
+		throw std::invalid_argument("p_position can not greater than end().\n");
+#endif
+
+	size_type index(p_position - cbegin()); // reserve can make iterator to p_position become invalid.
+	value_type value(p_value);				 // p_value may refer to an element that is about to be relocated.
+	grow(size() + 1);
+
+	return construct_at_gap(index, 1, [&](pointer p_slot, size_type)
+							{ std::allocator_traits<allocator_type>::construct(m_allocator, p_slot, std::move(value)); });
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+typename dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::iterator dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::insert_at(const const_iterator &p_position, value_type &&p_value)
+{
+#ifdef PARAM_CHECK
+	if (p_position < begin())
+		throw std::invalid_argument("p_position can not less than begin().\n");
+	if (end() < p_position)
+		throw std::invalid_argument("p_position can not greater than end().\n");
+#endif
+
+	size_type index(p_position - cbegin());
+	value_type value(std::move(p_value));
+	grow(size() + 1);
+
+	return construct_at_gap(index, 1, [&](pointer p_slot, size_type)
+							{ std::allocator_traits<allocator_type>::construct(m_allocator, p_slot, std::move(value)); });
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+typename dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::iterator dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::insert_at(const const_iterator &p_position, const size_type &p_size, const_reference p_value)
+{
+#ifdef PARAM_CHECK
+	if (p_position < begin())
+		throw std::invalid_argument("p_position can not less than begin().\n");
+	if (end() < p_position)
+		throw std::invalid_argument("p_position can not greater than end().\n");
+#endif
+
+	size_type index(p_position - cbegin());
+	value_type value(p_value);
+	grow(size() + p_size);
+
+	return construct_at_gap(index, p_size, [&](pointer p_slot, size_type)
+							{ std::allocator_traits<allocator_type>::construct(m_allocator, p_slot, value); });
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+typename dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::iterator dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::insert_at(const const_iterator &p_position, const std::initializer_list<value_type> &p_elements)
+{
+#ifdef PARAM_CHECK
+	if (p_position < begin())
+		throw std::invalid_argument("p_position can not less than begin().\n");
+	if (end() < p_position)
+		throw std::invalid_argument("p_position can not greater than end().\n");
+#endif
+
+	size_type index(p_position - cbegin());
+	grow(size() + p_elements.size());
+
+	return construct_at_gap(index, p_elements.size(), [&](pointer p_slot, size_type p_offset)
+							{ std::allocator_traits<allocator_type>::construct(m_allocator, p_slot, p_elements.begin()[p_offset]); });
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+template <class IIterator>
+typename dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::iterator dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::insert_at(const const_iterator &p_position, const IIterator &p_first, const IIterator &p_last)
+{
+#ifdef PARAM_CHECK
+	if (p_position < begin())
+		throw std::invalid_argument("p_position can not less than begin().\n");
+	if (end() < p_position)
+		throw std::invalid_argument("p_position can not greater than end().\n");
+#endif
+
+	size_type index(p_position - cbegin());
+	size_type count_size(0);
+	for (auto i(p_first); i != p_last; ++i)
+		++count_size;
+	grow(size() + count_size);
+
+	IIterator source(p_first);
+	return construct_at_gap(index, count_size, [&](pointer p_slot, size_type)
+							{ std::allocator_traits<allocator_type>::construct(m_allocator, p_slot, *source++); });
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+template <class... Args>
+typename dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::iterator dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::emplace_at(const const_iterator &p_position, Args &&...p_args)
+{
+#ifdef PARAM_CHECK
+	if (p_position < begin())
+		throw std::invalid_argument("p_position can not less than begin().\n");
+	if (end() < p_position)
+		throw std::invalid_argument("p_position can not greater than end().\n");
+#endif
+
+	size_type index(p_position - cbegin()); // reserve can make iterator to p_position become invalid.
+	value_type value(std::forward<Args>(p_args)...);
+	grow(size() + 1);
+
+	return construct_at_gap(index, 1, [&](pointer p_slot, size_type)
+							{ std::allocator_traits<allocator_type>::construct(m_allocator, p_slot, std::move(value)); });
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+void dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::erase_at(const const_iterator &p_position) NOEXCEPT
+{
+#ifdef PARAM_CHECK
+	if (p_position < begin())
+		throw std::invalid_argument("p_position can not less than begin().\n");
+	if (end() <= p_position)
+		throw std::invalid_argument("p_position can not greater than last().\n");
+#endif
+
+	size_type index(p_position - cbegin());
+	std::allocator_traits<allocator_type>::destroy(m_allocator, &m_elements[index]);
+	// Close the hole by sliding the tail one position to the left.
+	try
+	{
+		dsaa::relocate_left(m_allocator, &m_elements[index + 1], size() - index - 1, 1);
+	}
+	catch (...)
+	{
+		// A throwing copy destroyed the tail.
+		m_size = index;
+		throw;
+	}
+	--m_size;
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+void dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::erase(const const_iterator &p_first, const const_iterator &p_last) NOEXCEPT
+{
+#ifdef PARAM_CHECK
+	if (p_last < p_first)
+		throw std::invalid_argument("p_first can not less than p_last.\n");
+	if (p_first < begin())
+		throw std::invalid_argument("p_first can not less than begin().\n");
+	if (end() < p_last)
+		throw std::invalid_argument("p_last can not greater than end().\n");
+#endif
+
+	size_type first(p_first - cbegin()), last(p_last - cbegin());
+	if (first == last)
+		return;
+
+	for (size_type i(first); i != last; ++i)
+		std::allocator_traits<allocator_type>::destroy(m_allocator, &m_elements[i]);
+	// Close the hole by sliding the tail to the left.
+	try
+	{
+		dsaa::relocate_left(m_allocator, &m_elements[last], size() - last, last - first);
+	}
+	catch (...)
+	{
+		// A throwing copy destroyed the tail.
+		m_size = first;
+		throw;
+	}
+	m_size -= last - first;
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+CONSTEXPR void dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::erase_last() noexcept
+{
+#ifdef PARAM_CHECK
+	if (size() == 0)
+		std::terminate();
+#endif
+
+	std::allocator_traits<allocator_type>::destroy(m_allocator, &m_elements[size() - 1]);
+	--m_size;
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+CONSTEXPR void dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::clear() noexcept
+{
+	// Clean up all elements.
+	for (size_type i(0); i != size(); ++i)
+		std::allocator_traits<allocator_type>::destroy(m_allocator, &m_elements[i]);
+
+	m_size = 0;
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+void dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::swap(SmallDynamicArray &p_other)
+{
+	if (this == &p_other)
+		return;
+
+	SmallDynamicArray temporary(std::move(p_other));
+	p_other = std::move(*this);
+	*this = std::move(temporary);
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::pointer dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::inline_data() noexcept
+{
+	return reinterpret_cast<pointer>(m_buffer);
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+CONSTEXPR typename dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::const_pointer dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::inline_data() const noexcept
+{
+	return reinterpret_cast<const_pointer>(m_buffer);
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+CONSTEXPR void dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::release_storage() noexcept
+{
+	if (!is_small())
+		std::allocator_traits<allocator_type>::deallocate(m_allocator, m_elements, capacity());
+
+	m_elements = inline_data();
+	m_capacity = N;
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+void dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::take(SmallDynamicArray &p_other)
+{
+	m_growth_policy = std::move(p_other.m_growth_policy);
+	if (p_other.is_small() || m_allocator != p_other.m_allocator)
+	{
+		// A block from another allocator can not be freed through ours, so its elements move like inline ones.
+		if (N < p_other.size())
+		{
+			m_elements = std::allocator_traits<allocator_type>::allocate(m_allocator, p_other.size());
+			m_capacity = p_other.size();
+		}
+		try
+		{
+			dsaa::uninitialized_relocate(m_allocator, p_other.m_elements, p_other.size(), m_elements);
+		}
+		catch (...)
+		{
+			release_storage();
+			throw;
+		}
+		m_size = p_other.size();
+		p_other.m_size = 0;
+		p_other.release_storage();
+		return;
+	}
+
+	m_capacity = p_other.capacity();
+	m_size = p_other.size();
+	m_elements = p_other.m_elements;
+
+	p_other.m_size = 0;
+	p_other.m_elements = p_other.inline_data();
+	p_other.m_capacity = N;
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+void dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::grow(const size_type &p_required)
+{
+	if (capacity() < p_required)
+		reserve(m_growth_policy(capacity(), p_required));
+}
+
+template <typename Elem, size_t N, typename Alloc, typename GrowthPolicy>
+template <typename Construct>
+typename dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::iterator dsaa::SmallDynamicArray<Elem, N, Alloc, GrowthPolicy>::construct_at_gap(const size_type &p_index, const size_type &p_size, Construct p_construct)
+{
+	pointer gap(m_elements + p_index);
+	// Move the tail out of the way, leaving p_size uninitialized slots at p_index.
+	try
+	{
+		dsaa::relocate_right(m_allocator, gap, size() - p_index, p_size);
+	}
+	catch (...)
+	{
+		// A throwing copy destroyed the tail.
+		m_size = p_index;
+		throw;
+	}
+
+	size_type constructed(0);
+	try
+	{
+		for (; constructed != p_size; ++constructed)
+			p_construct(gap + constructed, constructed);
+	}
+	catch (...)
+	{
+		// Put the container back the way it was.
+		while (constructed)
+			std::allocator_traits<allocator_type>::destroy(m_allocator, gap + --constructed);
+		try
+		{
+			dsaa::relocate_left(m_allocator, gap + p_size, size() - p_index, p_size);
+		}
+		catch (...)
+		{
+			m_size = p_index;
+			throw;
+		}
+		throw;
+	}
+
+	m_size += p_size;
+	return iterator(gap + (p_size ? p_size - 1 : 0));
+}
+
+#endif // !DSAA_SMALL_ARRAY_H
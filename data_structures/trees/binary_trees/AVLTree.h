@@ -638,37 +638,30 @@ CONSTEXPR void dsaa::AVLTree<Elem, Alloc>::erase(pointer& p_node)
 {
 	// The moment p_node transplant with its child, p_node will become invalid.
 	pointer substitute(p_node);
-	pointer tracker(p_node->parent());
+	pointer tracker(substitute->parent());
 
-
-	if (nullptr == p_node->left())
-		transplant(p_node, p_node->right());
-	else if (nullptr == p_node->right())
-		transplant(p_node, p_node->left());
+	if (nullptr == substitute->left())
+		transplant(substitute, substitute->right());
+	else if (nullptr == substitute->right())
+		transplant(substitute, substitute->left());
 	else
 	{
-		pointer succ = iterative_minimum(p_node->right());
+		pointer succ = iterative_minimum(substitute->right());
 
-		if (succ->parent() == p_node)
-		{
+		if (succ->parent() == substitute)
 			tracker = succ;
-			tracker->parent() = nullptr;
-		}
 		else
 		{
 			tracker = succ->parent();
 
 			transplant(succ, succ->right());
-			succ->right() = p_node->right();
+			succ->right() = substitute->right();
 			succ->right()->parent() = succ;
 		}
-		transplant(p_node, succ);
+		transplant(substitute, succ);
 		succ->left() = substitute->left();
 		succ->left()->parent() = succ;
-		succ->parent() = nullptr;
 	}
-	if (p_node == m_root && p_node)
-		p_node->parent() = nullptr;
 
 	std::allocator_traits<allocator_type>::destroy(m_allocator, substitute);
 	std::allocator_traits<allocator_type>::deallocate(m_allocator, substitute, 1);
@@ -682,72 +675,45 @@ CONSTEXPR void dsaa::AVLTree<Elem, Alloc>::erase(pointer& p_node)
 template <typename Elem, typename Alloc>
 CONSTEXPR void dsaa::AVLTree<Elem, Alloc>::erase_fixup(pointer p_node)
 {
-	pointer child((height(p_node->left()) < height(p_node->right())) ? p_node->right() : p_node->left());
-	pointer grand_child(nullptr);
-	if (child)
-	{
-		// This only matters if rotations happen. Don't clarify this check will make
-		// unnecessarily two or more rotations if child == p_node->right().
-		if (child == p_node->left())
-			grand_child = (height(child->left()) < height(child->right())) ? child->right() : child->left();
-		else
-			grand_child = (height(child->right()) < height(child->left())) ? child->left() : child->right();
-	}
-
 	// Update height.
 	while (p_node)
 	{
 		p_node->height() = std::max(height(p_node->left()), height(p_node->right())) + 1;
 
-		// Fix unbalance tree.
-		while (balance_factor(p_node) < -1 || 1 < balance_factor(p_node))
+		// Fix unbalance tree. After an erase the taller side of p_node decides the rotation.
+		if (balance_factor(p_node) < -1 || 1 < balance_factor(p_node))
 		{
-			if (child == p_node->left())
+			if (balance_factor(p_node) < 0)
 			{
-				// Case 1: grandchild located on left side of p_node, and is left child of its parent.
-				if (grand_child == child->left())
-				{
-					right_rotate(p_node);
-					p_node->height() = std::max(height(p_node->left()), height(p_node->right())) + 1;
-				}
-				// Case 2: grandchild located on left side of p_node, and is right child of its parent.
-				// Convert it into case 1.
-				else
+				pointer child(p_node->left());
+				// Grandchild is right child of its parent, convert it into a single right rotation.
+				if (balance_factor(child) > 0)
 				{
 					left_rotate(child);
-
 					child->height() = std::max(height(child->left()), height(child->right())) + 1;
-					grand_child->height() = std::max(height(grand_child->left()), height(grand_child->right())) + 1;
-
-					child = p_node->left();
-					grand_child = p_node->left()->left();
+					child->parent()->height() = std::max(height(child->parent()->left()), height(child->parent()->right())) + 1;
 				}
+				right_rotate(p_node);
 			}
 			else
 			{
-				// Case 3: grandchild located on right side of p_node, and is right child of its parent.
-				if (grand_child == child->right())
-				{
-					left_rotate(p_node);
-
-					p_node->height() = std::max(height(p_node->left()), height(p_node->right())) + 1;
-				}
-				// Case 4: grandchild located on right side of p_node, and is left child of its parent.
-				// Convert it into case 3.
-				else
+				pointer child(p_node->right());
+				// Grandchild is left child of its parent, convert it into a single left rotation.
+				if (balance_factor(child) < 0)
 				{
 					right_rotate(child);
 					child->height() = std::max(height(child->left()), height(child->right())) + 1;
-					grand_child->height() = std::max(height(grand_child->left()), height(grand_child->right())) + 1;
-
-					child = p_node->right();
-					grand_child = p_node->right()->right();
+					child->parent()->height() = std::max(height(child->parent()->left()), height(child->parent()->right())) + 1;
 				}
+				left_rotate(p_node);
 			}
+
+			p_node->height() = std::max(height(p_node->left()), height(p_node->right())) + 1;
+			// Continue from the new root of this subtree.
+			p_node = p_node->parent();
+			p_node->height() = std::max(height(p_node->left()), height(p_node->right())) + 1;
 		}
 
-		grand_child = child;
-		child = p_node;
 		p_node = p_node->parent();
 	}
 }
@@ -16,7 +16,7 @@ Purpose: Implement max heap data structure, this class fully support max priorit
 namespace dsaa
 {
   template <typename Elem, typename Alloc = std::allocator<Elem>, typename Compare = std::greater_equal<Elem>>
-  class MaxHeap
+  class MaxHeap final
   {
   public:
     class ConstIterator;
@@ -80,7 +80,7 @@ namespace dsaa
     // Destroys old elements and copy all elements from p_elements.
     CONSTEXPR MaxHeap &operator=(const std::initializer_list<value_type> &p_elements);
     // Destroys all elements and clean/free used space.
-    virtual ~MaxHeap();
+    ~MaxHeap();
 
     // Assigns new contents to the container, replacing its current contents, and modifying its size accordingly.
     template <typename IIterator>
@@ -168,15 +168,8 @@ public:
 
   CONSTEXPR ConstIterator() noexcept : m_pointer(nullptr) {}
   CONSTEXPR explicit ConstIterator(const_pointer p_pointer) noexcept : m_pointer(const_cast<pointer>(p_pointer)) {}
-  CONSTEXPR ConstIterator(const ConstIterator &p_iterator) noexcept : m_pointer(p_iterator.m_pointer) {}
-
-  CONSTEXPR ConstIterator &operator=(const ConstIterator &p_iterator) noexcept
-  {
-    m_pointer = p_iterator.m_pointer;
-    return *this;
-  }
-
-  virtual ~ConstIterator() {}
+  CONSTEXPR ConstIterator(const ConstIterator &p_iterator) noexcept = default;
+  CONSTEXPR ConstIterator &operator=(const ConstIterator &p_iterator) noexcept = default;
 
   NODISCARD CONSTEXPR INLINE bool operator==(const ConstIterator &p_iterator) const noexcept { return m_pointer == p_iterator.m_pointer; }
   NODISCARD CONSTEXPR INLINE bool operator!=(const ConstIterator &p_iterator) const noexcept { return m_pointer != p_iterator.m_pointer; }
@@ -268,21 +261,15 @@ protected:
 };
 
 template <typename Elem, typename Alloc, typename Compare>
-class dsaa::MaxHeap<Elem, Alloc, Compare>::Iterator : public dsaa::MaxHeap<Elem, Alloc, Compare>::ConstIterator
+class dsaa::MaxHeap<Elem, Alloc, Compare>::Iterator final : public dsaa::MaxHeap<Elem, Alloc, Compare>::ConstIterator
 {
 public:
   CONSTEXPR Iterator() noexcept : ConstIterator() {}
   CONSTEXPR Iterator(pointer p_pointer) noexcept : ConstIterator(p_pointer) {}
-  CONSTEXPR Iterator(const Iterator &p_iterator) noexcept : ConstIterator(p_iterator) {}
+  CONSTEXPR Iterator(const Iterator &p_iterator) noexcept = default;
   CONSTEXPR Iterator(const ConstIterator &p_iterator) noexcept : ConstIterator(p_iterator) {}
 
-  CONSTEXPR Iterator &operator=(const Iterator &p_iterator) noexcept
-  {
-    content() = p_iterator.content();
-    return *this;
-  }
-
-  virtual ~Iterator() {}
+  CONSTEXPR Iterator &operator=(const Iterator &p_iterator) noexcept = default;
 
   NODISCARD CONSTEXPR INLINE bool operator==(const Iterator &p_iterator) const noexcept { return content() == p_iterator.content(); }
   NODISCARD CONSTEXPR INLINE bool operator!=(const Iterator &p_iterator) const noexcept { return content() != p_iterator.content(); }
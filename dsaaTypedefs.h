@@ -43,4 +43,9 @@
 #define NOEXCEPT noexcept
 #endif //!PARAM_CHECK
 
+// Makes the adapters of Counting.h count by default.
+#ifdef DSAA_COUNT_OPERATIONS
+#define COUNT_OPERATIONS
+#endif //!DSAA_COUNT_OPERATIONS
+
 #endif //!DSAA_TYPEDEFS_H
\ No newline at end of file
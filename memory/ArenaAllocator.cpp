@@ -0,0 +1,76 @@
+#include "ArenaAllocator.h"
+
+dsaa::MonotonicArena::MonotonicArena(size_t p_initial_size) noexcept
+	: m_chunks(nullptr), m_current(nullptr), m_end(nullptr), m_next_chunk_size(p_initial_size < header_size ? header_size * 2 : p_initial_size), m_used(0), m_capacity(0) {}
+
+dsaa::MonotonicArena::~MonotonicArena()
+{
+	release();
+}
+
+void dsaa::MonotonicArena::reset() noexcept
+{
+	Chunk *largest(m_chunks);
+	for (Chunk *chunk(m_chunks); chunk; chunk = chunk->m_next)
+		if (largest->m_size < chunk->m_size)
+			largest = chunk;
+
+	while (m_chunks)
+	{
+		Chunk *next(m_chunks->m_next);
+		if (m_chunks != largest)
+			::operator delete(m_chunks);
+		m_chunks = next;
+	}
+
+	m_used = 0;
+	m_capacity = 0;
+	m_current = m_end = nullptr;
+	if (largest)
+	{
+		largest->m_next = nullptr;
+		m_chunks = largest;
+		m_capacity = largest->m_size;
+		use_chunk(largest);
+	}
+}
+
+void dsaa::MonotonicArena::release() noexcept
+{
+	while (m_chunks)
+	{
+		Chunk *next(m_chunks->m_next);
+		::operator delete(m_chunks);
+		m_chunks = next;
+	}
+	m_current = m_end = nullptr;
+	m_used = 0;
+	m_capacity = 0;
+}
+
+void *dsaa::MonotonicArena::allocate_from_new_chunk(size_t p_bytes, size_t p_alignment)
+{
+	if (SIZE_MAX - header_size - p_alignment < p_bytes)
+		throw std::bad_alloc();
+
+	// Requests larger than the next chunk get a chunk of their own size.
+	size_t size(header_size + p_bytes + p_alignment);
+	if (size < m_next_chunk_size)
+		size = m_next_chunk_size;
+	Chunk *chunk(static_cast<Chunk *>(::operator new(size)));
+	chunk->m_next = m_chunks;
+	chunk->m_size = size;
+	m_chunks = chunk;
+	m_capacity += size;
+	if (m_next_chunk_size <= SIZE_MAX / 2)
+		m_next_chunk_size *= 2;
+
+	use_chunk(chunk);
+	return allocate(p_bytes, p_alignment);
+}
+
+void dsaa::MonotonicArena::use_chunk(Chunk *p_chunk) noexcept
+{
+	m_current = reinterpret_cast<unsigned char *>(p_chunk) + header_size;
+	m_end = reinterpret_cast<unsigned char *>(p_chunk) + p_chunk->m_size;
+}
\ No newline at end of file
@@ -0,0 +1,133 @@
+#ifndef DSAA_ARENA_ALLOCATOR_H
+#define DSAA_ARENA_ALLOCATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+#include "dsaaTypedefs.h"
+
+namespace dsaa
+{
+	// Monotonic memory resource: hands out memory by bumping a pointer through chunks that grow geometrically.
+	// Deallocation is a no-op; everything is released at once by reset() or when the arena is destroyed.
+	// Containers using the arena must be destroyed before it is reset.
+	class MonotonicArena final
+	{
+	public:
+		// Creates an arena whose first chunk holds p_initial_size bytes. No memory is taken until the first allocation.
+		explicit MonotonicArena(size_t p_initial_size = 4096) noexcept;
+		MonotonicArena(const MonotonicArena &) = delete;
+		MonotonicArena &operator=(const MonotonicArena &) = delete;
+		~MonotonicArena();
+
+		// Returns p_bytes bytes aligned to p_alignment, which must be a power of two.
+		NODISCARD void *allocate(size_t p_bytes, size_t p_alignment = alignof(std::max_align_t));
+		// Does nothing, memory is given back by reset().
+		void deallocate(void *, size_t, size_t = alignof(std::max_align_t)) noexcept {}
+		// Releases every allocation at once. The largest chunk is kept for the next round.
+		void reset() noexcept;
+		// Releases every allocation and returns all chunks to the system.
+		void release() noexcept;
+
+		// Returns the number of bytes handed out since the last reset.
+		NODISCARD size_t used() const noexcept { return m_used; }
+		// Returns the number of bytes held in chunks.
+		NODISCARD size_t capacity() const noexcept { return m_capacity; }
+
+	private:
+		struct Chunk
+		{
+			Chunk *m_next;
+			size_t m_size;
+		};
+
+		static constexpr size_t header_size = (sizeof(Chunk) + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+
+		NODISCARD void *allocate_from_new_chunk(size_t p_bytes, size_t p_alignment);
+		void use_chunk(Chunk *p_chunk) noexcept;
+
+		Chunk *m_chunks;
+		unsigned char *m_current;
+		unsigned char *m_end;
+		size_t m_next_chunk_size;
+		size_t m_used;
+		size_t m_capacity;
+	};
+
+	// Allocator handing out memory from a MonotonicArena.
+	// A default constructed allocator is not bound to an arena and forwards to std::allocator.
+	template <typename Elem>
+	class ArenaAllocator
+	{
+	public:
+		using value_type = Elem;
+		using size_type = size_t;
+		using difference_type = std::ptrdiff_t;
+		using propagate_on_container_copy_assignment = std::true_type;
+		using propagate_on_container_move_assignment = std::true_type;
+		using propagate_on_container_swap = std::true_type;
+		using is_always_equal = std::false_type;
+
+		template <typename Other>
+		struct rebind
+		{
+			using other = ArenaAllocator<Other>;
+		};
+
+		CONSTEXPR ArenaAllocator() noexcept = default;
+		CONSTEXPR ArenaAllocator(MonotonicArena &p_arena) noexcept : m_arena(&p_arena) {}
+		template <typename Other>
+		CONSTEXPR ArenaAllocator(const ArenaAllocator<Other> &p_other) noexcept : m_arena(p_other.arena()) {}
+
+		NODISCARD Elem *allocate(size_type p_size);
+		void deallocate(Elem *p_pointer, size_type p_size) noexcept;
+
+		// Returns the arena this allocator draws from, or nullptr.
+		NODISCARD CONSTEXPR MonotonicArena *arena() const noexcept { return m_arena; }
+
+	private:
+		MonotonicArena *m_arena = nullptr;
+	};
+
+	template <typename Elem1, typename Elem2>
+	CONSTEXPR INLINE bool operator==(const ArenaAllocator<Elem1> &p_lhs, const ArenaAllocator<Elem2> &p_rhs) noexcept { return p_lhs.arena() == p_rhs.arena(); }
+	template <typename Elem1, typename Elem2>
+	CONSTEXPR INLINE bool operator!=(const ArenaAllocator<Elem1> &p_lhs, const ArenaAllocator<Elem2> &p_rhs) noexcept { return p_lhs.arena() != p_rhs.arena(); }
+}
+
+inline void *dsaa::MonotonicArena::allocate(size_t p_bytes, size_t p_alignment)
+{
+	const uintptr_t current(reinterpret_cast<uintptr_t>(m_current));
+	const uintptr_t aligned((current + p_alignment - 1) & ~(p_alignment - 1));
+	if (m_current && aligned <= reinterpret_cast<uintptr_t>(m_end) && p_bytes <= reinterpret_cast<uintptr_t>(m_end) - aligned)
+	{
+		m_current = reinterpret_cast<unsigned char *>(aligned + p_bytes);
+		m_used += p_bytes;
+		return reinterpret_cast<void *>(aligned);
+	}
+	return allocate_from_new_chunk(p_bytes, p_alignment);
+}
+
+template <typename Elem>
+Elem *dsaa::ArenaAllocator<Elem>::allocate(size_type p_size)
+{
+	if (!m_arena)
+		return std::allocator<Elem>().allocate(p_size);
+	if (!p_size)
+		return nullptr;
+	if (SIZE_MAX / sizeof(Elem) < p_size)
+		throw std::bad_array_new_length();
+	return static_cast<Elem *>(m_arena->allocate(p_size * sizeof(Elem), alignof(Elem)));
+}
+
+template <typename Elem>
+void dsaa::ArenaAllocator<Elem>::deallocate(Elem *p_pointer, size_type p_size) noexcept
+{
+	if (!m_arena)
+		std::allocator<Elem>().deallocate(p_pointer, p_size);
+}
+
+#endif // !DSAA_ARENA_ALLOCATOR_H
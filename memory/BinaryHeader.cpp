@@ -0,0 +1 @@
+#include "BinaryHeader.h"
\ No newline at end of file
@@ -0,0 +1,73 @@
+#ifndef DSAA_BINARY_HEADER_H
+#define DSAA_BINARY_HEADER_H
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+#include "dsaaTypedefs.h"
+
+namespace dsaa
+{
+	// Binary format of arrays on disk, shared by save, load, MappedView and MappedDynamicArray. Values are stored in native byte order.
+	// A 64-byte header is followed by the elements, row by row for a matrix. A MappedDynamicArray file may hold spare capacity after them.
+	struct BinaryHeader
+	{
+		static constexpr size_t header_size = 64;
+		static constexpr uint32_t current_version = 1;
+
+		char magic[8];
+		uint32_t version;
+		uint32_t element_size;
+		uint32_t element_alignment;
+		uint32_t rank;		  // 1 for a DynamicArray, 2 for a Matrix.
+		uint64_t extents[2]; // Element count, or rows and columns.
+
+		// Returns a header describing rank-p_rank data of Elem with the given extents.
+		template <typename Elem>
+		NODISCARD static BinaryHeader make(uint32_t p_rank, uint64_t p_extent0, uint64_t p_extent1 = 0) noexcept;
+		// Throws std::runtime_error when the header does not describe rank-p_rank data of Elem,
+		// or when its elements do not fit in the p_payload_bytes bytes following it.
+		template <typename Elem>
+		void check(uint32_t p_rank, uint64_t p_payload_bytes) const;
+		// Returns the number of elements in the payload. Only meaningful once check has passed, extents[0] * extents[1] may overflow before.
+		NODISCARD CONSTEXPR INLINE uint64_t count() const noexcept { return rank == 1 ? extents[0] : extents[0] * extents[1]; }
+	};
+
+	static_assert(sizeof(BinaryHeader) <= BinaryHeader::header_size, "BinaryHeader must fit in its reserved space.");
+}
+
+template <typename Elem>
+dsaa::BinaryHeader dsaa::BinaryHeader::make(uint32_t p_rank, uint64_t p_extent0, uint64_t p_extent1) noexcept
+{
+	BinaryHeader result{};
+	std::memcpy(result.magic, "DSAABIN", 8);
+	result.version = current_version;
+	result.element_size = sizeof(Elem);
+	result.element_alignment = alignof(Elem);
+	result.rank = p_rank;
+	result.extents[0] = p_extent0;
+	result.extents[1] = p_extent1;
+	return result;
+}
+
+template <typename Elem>
+void dsaa::BinaryHeader::check(uint32_t p_rank, uint64_t p_payload_bytes) const
+{
+	if (std::memcmp(magic, "DSAABIN", 8) != 0)
+		throw std::runtime_error("Not a dsaa binary file.");
+	if (version != current_version)
+		throw std::runtime_error("Unsupported dsaa binary version.");
+	if (element_size != sizeof(Elem) || element_alignment != alignof(Elem))
+		throw std::runtime_error("dsaa binary file holds a different element type.");
+	if (rank != p_rank)
+		throw std::runtime_error("dsaa binary file holds data of a different rank.");
+	// Dividing rather than multiplying, a crafted header can not overflow past the check.
+	if (rank == 2 && extents[1] && std::numeric_limits<uint64_t>::max() / extents[1] < extents[0])
+		throw std::runtime_error("dsaa binary file has corrupt extents.");
+	if (p_payload_bytes / sizeof(Elem) < count())
+		throw std::runtime_error("dsaa binary file is truncated.");
+}
+
+#endif // !DSAA_BINARY_HEADER_H
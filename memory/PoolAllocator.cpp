@@ -0,0 +1,70 @@
+#include "PoolAllocator.h"
+
+dsaa::BlockPool::BlockPool(size_t p_block_size, size_t p_block_alignment, size_t p_blocks_per_chunk) noexcept
+	: m_block_size(0), m_block_alignment(p_block_alignment < alignof(FreeBlock) ? alignof(FreeBlock) : p_block_alignment),
+	  m_blocks_per_chunk(p_blocks_per_chunk ? p_blocks_per_chunk : 1), m_capacity(0), m_free(nullptr), m_chunks(nullptr), m_active(nullptr), m_current(nullptr), m_end(nullptr)
+{
+	// Every block must hold a free list link and keep the next block aligned.
+	if (p_block_size < sizeof(FreeBlock))
+		p_block_size = sizeof(FreeBlock);
+	m_block_size = (p_block_size + m_block_alignment - 1) / m_block_alignment * m_block_alignment;
+}
+
+dsaa::BlockPool::~BlockPool()
+{
+	release();
+}
+
+void dsaa::BlockPool::reset() noexcept
+{
+	m_free = nullptr;
+	m_active = m_chunks;
+	if (m_active)
+		use_chunk(m_active);
+}
+
+void dsaa::BlockPool::release() noexcept
+{
+	while (m_chunks)
+	{
+		Chunk *next(m_chunks->m_next);
+		::operator delete(m_chunks, std::align_val_t(m_block_alignment));
+		m_chunks = next;
+	}
+	m_free = nullptr;
+	m_active = nullptr;
+	m_current = m_end = nullptr;
+	m_capacity = 0;
+}
+
+void *dsaa::BlockPool::allocate_from_chunk()
+{
+	// Chunks kept by reset are carved again before new ones are taken.
+	if (m_active && m_active->m_next)
+		m_active = m_active->m_next;
+	else
+	{
+		Chunk *chunk(static_cast<Chunk *>(::operator new(header_size() + m_blocks_per_chunk * m_block_size, std::align_val_t(m_block_alignment))));
+		chunk->m_next = nullptr;
+		if (m_active)
+			m_active->m_next = chunk;
+		else
+			m_chunks = chunk;
+		m_active = chunk;
+		m_capacity += m_blocks_per_chunk;
+	}
+
+	use_chunk(m_active);
+	return allocate();
+}
+
+size_t dsaa::BlockPool::header_size() const noexcept
+{
+	return (sizeof(Chunk) + m_block_alignment - 1) / m_block_alignment * m_block_alignment;
+}
+
+void dsaa::BlockPool::use_chunk(Chunk *p_chunk) noexcept
+{
+	m_current = reinterpret_cast<unsigned char *>(p_chunk) + header_size();
+	m_end = m_current + m_blocks_per_chunk * m_block_size;
+}
\ No newline at end of file
@@ -0,0 +1,151 @@
+#ifndef DSAA_POOL_ALLOCATOR_H
+#define DSAA_POOL_ALLOCATOR_H
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+#include "dsaaTypedefs.h"
+
+namespace dsaa
+{
+	// Memory resource of fixed-size blocks. Freed blocks go to a free list and are reused first,
+	// fresh blocks are carved from chunks of p_blocks_per_chunk blocks.
+	// Containers using the pool must be destroyed before it is reset.
+	class BlockPool final
+	{
+	public:
+		// Creates a pool of blocks holding p_block_size bytes aligned to p_block_alignment, which must be a power of two.
+		// No memory is taken until the first allocation.
+		explicit BlockPool(size_t p_block_size, size_t p_block_alignment = alignof(std::max_align_t), size_t p_blocks_per_chunk = 256) noexcept;
+		BlockPool(const BlockPool &) = delete;
+		BlockPool &operator=(const BlockPool &) = delete;
+		~BlockPool();
+
+		// Returns one block.
+		NODISCARD void *allocate();
+		// Gives p_block back to the pool.
+		void deallocate(void *p_block) noexcept;
+		// Returns every block to the pool at once. Chunks are kept for the next round.
+		void reset() noexcept;
+		// Returns every block to the pool and all chunks to the system.
+		void release() noexcept;
+
+		// Returns whether a block can hold p_bytes bytes aligned to p_alignment.
+		NODISCARD bool fits(size_t p_bytes, size_t p_alignment) const noexcept { return p_bytes <= m_block_size && p_alignment <= m_block_alignment; }
+		NODISCARD size_t block_size() const noexcept { return m_block_size; }
+		NODISCARD size_t block_alignment() const noexcept { return m_block_alignment; }
+		// Returns the number of blocks held in chunks.
+		NODISCARD size_t capacity() const noexcept { return m_capacity; }
+
+	private:
+		struct FreeBlock
+		{
+			FreeBlock *m_next;
+		};
+		struct Chunk
+		{
+			Chunk *m_next;
+		};
+
+		NODISCARD void *allocate_from_chunk();
+		NODISCARD size_t header_size() const noexcept;
+		void use_chunk(Chunk *p_chunk) noexcept;
+
+		size_t m_block_size;
+		size_t m_block_alignment;
+		size_t m_blocks_per_chunk;
+		size_t m_capacity;
+		FreeBlock *m_free;
+		Chunk *m_chunks;
+		Chunk *m_active;
+		unsigned char *m_current;
+		unsigned char *m_end;
+	};
+
+	// Allocator handing out single elements from a BlockPool. Arrays and elements the blocks can not hold go to std::allocator,
+	// as does everything when the allocator is default constructed.
+	template <typename Elem>
+	class PoolAllocator
+	{
+	public:
+		using value_type = Elem;
+		using size_type = size_t;
+		using difference_type = std::ptrdiff_t;
+		using propagate_on_container_copy_assignment = std::true_type;
+		using propagate_on_container_move_assignment = std::true_type;
+		using propagate_on_container_swap = std::true_type;
+		using is_always_equal = std::false_type;
+
+		template <typename Other>
+		struct rebind
+		{
+			using other = PoolAllocator<Other>;
+		};
+
+		CONSTEXPR PoolAllocator() noexcept = default;
+		CONSTEXPR PoolAllocator(BlockPool &p_pool) noexcept : m_pool(&p_pool) {}
+		template <typename Other>
+		CONSTEXPR PoolAllocator(const PoolAllocator<Other> &p_other) noexcept : m_pool(p_other.pool()) {}
+
+		NODISCARD Elem *allocate(size_type p_size);
+		void deallocate(Elem *p_pointer, size_type p_size) noexcept;
+
+		// Returns the pool this allocator draws from, or nullptr.
+		NODISCARD CONSTEXPR BlockPool *pool() const noexcept { return m_pool; }
+
+	private:
+		NODISCARD bool from_pool(size_type p_size) const noexcept { return m_pool && p_size == 1 && m_pool->fits(sizeof(Elem), alignof(Elem)); }
+
+		BlockPool *m_pool = nullptr;
+	};
+
+	template <typename Elem1, typename Elem2>
+	CONSTEXPR INLINE bool operator==(const PoolAllocator<Elem1> &p_lhs, const PoolAllocator<Elem2> &p_rhs) noexcept { return p_lhs.pool() == p_rhs.pool(); }
+	template <typename Elem1, typename Elem2>
+	CONSTEXPR INLINE bool operator!=(const PoolAllocator<Elem1> &p_lhs, const PoolAllocator<Elem2> &p_rhs) noexcept { return p_lhs.pool() != p_rhs.pool(); }
+}
+
+inline void *dsaa::BlockPool::allocate()
+{
+	if (m_free)
+	{
+		FreeBlock *block(m_free);
+		m_free = block->m_next;
+		return block;
+	}
+	if (m_current != m_end)
+	{
+		void *block(m_current);
+		m_current += m_block_size;
+		return block;
+	}
+	return allocate_from_chunk();
+}
+
+inline void dsaa::BlockPool::deallocate(void *p_block) noexcept
+{
+	FreeBlock *block(static_cast<FreeBlock *>(p_block));
+	block->m_next = m_free;
+	m_free = block;
+}
+
+template <typename Elem>
+Elem *dsaa::PoolAllocator<Elem>::allocate(size_type p_size)
+{
+	if (from_pool(p_size))
+		return static_cast<Elem *>(m_pool->allocate());
+	return std::allocator<Elem>().allocate(p_size);
+}
+
+template <typename Elem>
+void dsaa::PoolAllocator<Elem>::deallocate(Elem *p_pointer, size_type p_size) noexcept
+{
+	if (from_pool(p_size))
+		m_pool->deallocate(p_pointer);
+	else
+		std::allocator<Elem>().deallocate(p_pointer, p_size);
+}
+
+#endif // !DSAA_POOL_ALLOCATOR_H
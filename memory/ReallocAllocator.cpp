@@ -0,0 +1 @@
+#include "ReallocAllocator.h"
\ No newline at end of file
@@ -0,0 +1,183 @@
+#ifndef DSAA_REALLOC_ALLOCATOR_H
+#define DSAA_REALLOC_ALLOCATOR_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "dsaaTypedefs.h"
+
+namespace dsaa
+{
+	// Allocator that can grow a block in place.
+	// Blocks of at least Threshold bytes are mapped with mmap and grown with mremap on Linux, so the kernel
+	// moves page table entries instead of copying bytes. Smaller blocks come from malloc and grow with realloc.
+	// Only usable for element types that can be relocated with memcpy.
+	template <typename Elem, size_t Threshold = (size_t(1) << 20)>
+	class ReallocAllocator
+	{
+	public:
+		using value_type = Elem;
+		using size_type = size_t;
+		using difference_type = std::ptrdiff_t;
+		using propagate_on_container_move_assignment = std::true_type;
+		using is_always_equal = std::true_type;
+
+		template <typename Other>
+		struct rebind
+		{
+			using other = ReallocAllocator<Other, Threshold>;
+		};
+
+		CONSTEXPR ReallocAllocator() noexcept = default;
+		template <typename Other>
+		CONSTEXPR ReallocAllocator(const ReallocAllocator<Other, Threshold> &) noexcept {}
+
+		NODISCARD Elem *allocate(size_type p_size);
+		void deallocate(Elem *p_pointer, size_type p_size) noexcept;
+		// Resizes the block at p_pointer from p_old_size to p_new_size elements, preserving min(p_old_size, p_new_size) elements.
+		// The block is extended in place when possible. p_pointer may be nullptr when p_old_size is 0.
+		NODISCARD Elem *reallocate(Elem *p_pointer, size_type p_old_size, size_type p_new_size);
+
+		// Returns whether a block of p_size elements is backed by its own mapping.
+		NODISCARD static CONSTEXPR INLINE bool is_mapped(size_type p_size) noexcept;
+
+	private:
+		NODISCARD static INLINE size_t mapping_size(size_type p_size) noexcept;
+	};
+
+	template <typename Elem1, typename Elem2, size_t Threshold>
+	CONSTEXPR INLINE bool operator==(const ReallocAllocator<Elem1, Threshold> &, const ReallocAllocator<Elem2, Threshold> &) noexcept { return true; }
+	template <typename Elem1, typename Elem2, size_t Threshold>
+	CONSTEXPR INLINE bool operator!=(const ReallocAllocator<Elem1, Threshold> &, const ReallocAllocator<Elem2, Threshold> &) noexcept { return false; }
+
+	// Tells whether Alloc provides reallocate(pointer, old_size, new_size).
+	template <typename Alloc, typename = void>
+	struct has_reallocate : std::false_type
+	{
+	};
+
+	template <typename Alloc>
+	struct has_reallocate<Alloc, std::void_t<decltype(std::declval<Alloc &>().reallocate(std::declval<typename Alloc::value_type *>(), size_t(), size_t()))>> : std::true_type
+	{
+	};
+}
+
+template <typename Elem, size_t Threshold>
+CONSTEXPR bool dsaa::ReallocAllocator<Elem, Threshold>::is_mapped(size_type p_size) noexcept
+{
+#if defined(__linux__)
+	return Threshold <= p_size * sizeof(Elem);
+#else
+	(void)p_size;
+	return false;
+#endif
+}
+
+template <typename Elem, size_t Threshold>
+size_t dsaa::ReallocAllocator<Elem, Threshold>::mapping_size(size_type p_size) noexcept
+{
+#if defined(__linux__)
+	static const size_t page_size(static_cast<size_t>(sysconf(_SC_PAGESIZE)));
+	return (p_size * sizeof(Elem) + page_size - 1) / page_size * page_size;
+#else
+	return p_size * sizeof(Elem);
+#endif
+}
+
+template <typename Elem, size_t Threshold>
+Elem *dsaa::ReallocAllocator<Elem, Threshold>::allocate(size_type p_size)
+{
+	static_assert(alignof(Elem) <= alignof(std::max_align_t), "ReallocAllocator does not support over-aligned types.");
+
+	if (!p_size)
+		return nullptr;
+	if (std::numeric_limits<size_type>::max() / sizeof(Elem) < p_size)
+		throw std::bad_array_new_length();
+
+#if defined(__linux__)
+	if (is_mapped(p_size))
+	{
+		void *result(mmap(nullptr, mapping_size(p_size), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+		if (MAP_FAILED == result)
+			throw std::bad_alloc();
+		return static_cast<Elem *>(result);
+	}
+#endif
+
+	void *result(std::malloc(p_size * sizeof(Elem)));
+	if (!result)
+		throw std::bad_alloc();
+	return static_cast<Elem *>(result);
+}
+
+template <typename Elem, size_t Threshold>
+void dsaa::ReallocAllocator<Elem, Threshold>::deallocate(Elem *p_pointer, size_type p_size) noexcept
+{
+	if (!p_pointer)
+		return;
+
+#if defined(__linux__)
+	if (is_mapped(p_size))
+	{
+		munmap(p_pointer, mapping_size(p_size));
+		return;
+	}
+#endif
+
+	std::free(p_pointer);
+}
+
+template <typename Elem, size_t Threshold>
+Elem *dsaa::ReallocAllocator<Elem, Threshold>::reallocate(Elem *p_pointer, size_type p_old_size, size_type p_new_size)
+{
+	static_assert(std::is_trivially_copyable_v<Elem>, "ReallocAllocator::reallocate requires a trivially copyable type.");
+
+	if (!p_pointer || !p_old_size)
+	{
+		deallocate(p_pointer, p_old_size);
+		return allocate(p_new_size);
+	}
+	if (!p_new_size)
+	{
+		deallocate(p_pointer, p_old_size);
+		return nullptr;
+	}
+
+	if (!is_mapped(p_old_size) && !is_mapped(p_new_size))
+	{
+		if (std::numeric_limits<size_type>::max() / sizeof(Elem) < p_new_size)
+			throw std::bad_array_new_length();
+		void *result(std::realloc(p_pointer, p_new_size * sizeof(Elem)));
+		if (!result)
+			throw std::bad_alloc();
+		return static_cast<Elem *>(result);
+	}
+
+#if defined(__linux__)
+	if (is_mapped(p_old_size) && is_mapped(p_new_size))
+	{
+		void *result(mremap(p_pointer, mapping_size(p_old_size), mapping_size(p_new_size), MREMAP_MAYMOVE));
+		if (MAP_FAILED == result)
+			throw std::bad_alloc();
+		return static_cast<Elem *>(result);
+	}
+#endif
+
+	// Crossing the threshold: move between malloc and a mapping.
+	Elem *result(allocate(p_new_size));
+	std::memcpy(static_cast<void *>(result), static_cast<const void *>(p_pointer), (p_old_size < p_new_size ? p_old_size : p_new_size) * sizeof(Elem));
+	deallocate(p_pointer, p_old_size);
+	return result;
+}
+
+#endif // !DSAA_REALLOC_ALLOCATOR_H
@@ -0,0 +1 @@
+#include "Relocate.h"
\ No newline at end of file
@@ -0,0 +1,178 @@
+#ifndef DSAA_RELOCATE_H
+#define DSAA_RELOCATE_H
+
+#include <memory>
+#include <cstring>
+#include <type_traits>
+
+#include "dsaaTypedefs.h"
+
+namespace dsaa
+{
+	// Tells whether moving an Elem to a new address and destroying the source is equivalent to copying its bytes.
+	// Specialize for types that own resources through pointers to themselves only indirectly (e.g. unique_ptr-like handles).
+	template <typename Elem>
+	struct is_trivially_relocatable : std::is_trivially_copyable<Elem>
+	{
+	};
+
+	template <typename Elem>
+	inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<Elem>::value;
+
+	// Tells whether relocation of Elem inside a container of allocator Alloc may be done with memcpy/memmove.
+	// Allocators with fancy pointers opt out, since their storage may not be plain bytes.
+	template <typename Elem, typename Alloc>
+	inline constexpr bool is_memcpy_relocatable_v = is_trivially_relocatable_v<Elem> &&
+													std::is_pointer_v<typename std::allocator_traits<Alloc>::pointer>;
+
+	// Moves p_size elements from p_source into the uninitialized storage at p_destination and ends the lifetime of the sources.
+	// The two ranges must not overlap.
+	template <typename Alloc>
+	void uninitialized_relocate(Alloc &p_allocator, typename std::allocator_traits<Alloc>::pointer p_source, size_t p_size, typename std::allocator_traits<Alloc>::pointer p_destination);
+
+	// Relocates p_size elements starting at p_source by p_offset positions toward the end of the storage.
+	// The p_offset slots past the range must be uninitialized, and the p_offset slots at p_source are left uninitialized.
+	// Elements whose move may throw are copied instead. If a copy throws, every element of the range, relocated or not,
+	// is destroyed before the exception is rethrown, so the caller must drop the whole range.
+	template <typename Alloc>
+	void relocate_right(Alloc &p_allocator, typename std::allocator_traits<Alloc>::pointer p_source, size_t p_size, size_t p_offset);
+
+	// Relocates p_size elements starting at p_source by p_offset positions toward the beginning of the storage.
+	// The p_offset slots before the range must be uninitialized, and the p_offset slots at its end are left uninitialized.
+	// If a copy throws, every element of the range is destroyed before the exception is rethrown, as with relocate_right.
+	template <typename Alloc>
+	void relocate_left(Alloc &p_allocator, typename std::allocator_traits<Alloc>::pointer p_source, size_t p_size, size_t p_offset);
+}
+
+template <typename Alloc>
+void dsaa::uninitialized_relocate(Alloc &p_allocator, typename std::allocator_traits<Alloc>::pointer p_source, size_t p_size, typename std::allocator_traits<Alloc>::pointer p_destination)
+{
+	using traits = std::allocator_traits<Alloc>;
+	using value_type = typename traits::value_type;
+
+	if (!p_size)
+		return;
+
+	if constexpr (dsaa::is_memcpy_relocatable_v<value_type, Alloc>)
+	{
+		std::memcpy(static_cast<void *>(p_destination), static_cast<const void *>(p_source), p_size * sizeof(value_type));
+	}
+	else if constexpr (std::is_nothrow_move_constructible_v<value_type> || !std::is_copy_constructible_v<value_type>)
+	{
+		for (size_t i(0); i != p_size; ++i)
+		{
+			traits::construct(p_allocator, &p_destination[i], std::move(p_source[i]));
+			traits::destroy(p_allocator, &p_source[i]);
+		}
+	}
+	else
+	{
+		// Copy everything first, so the sources stay intact if a copy throws.
+		size_t constructed(0);
+		try
+		{
+			for (; constructed != p_size; ++constructed)
+				traits::construct(p_allocator, &p_destination[constructed], p_source[constructed]);
+		}
+		catch (...)
+		{
+			while (constructed)
+				traits::destroy(p_allocator, &p_destination[--constructed]);
+			throw;
+		}
+
+		for (size_t i(0); i != p_size; ++i)
+			traits::destroy(p_allocator, &p_source[i]);
+	}
+}
+
+template <typename Alloc>
+void dsaa::relocate_right(Alloc &p_allocator, typename std::allocator_traits<Alloc>::pointer p_source, size_t p_size, size_t p_offset)
+{
+	using traits = std::allocator_traits<Alloc>;
+	using value_type = typename traits::value_type;
+
+	if (!p_size || !p_offset)
+		return;
+
+	if constexpr (dsaa::is_memcpy_relocatable_v<value_type, Alloc>)
+	{
+		std::memmove(static_cast<void *>(p_source + p_offset), static_cast<const void *>(p_source), p_size * sizeof(value_type));
+	}
+	else if constexpr (std::is_nothrow_move_constructible_v<value_type> || !std::is_copy_constructible_v<value_type>)
+	{
+		// Walk backward so every target slot is uninitialized by the time we reach it.
+		for (size_t i(p_size); i != 0; --i)
+		{
+			traits::construct(p_allocator, &p_source[i - 1 + p_offset], std::move(p_source[i - 1]));
+			traits::destroy(p_allocator, &p_source[i - 1]);
+		}
+	}
+	else
+	{
+		size_t i(p_size);
+		try
+		{
+			for (; i != 0; --i)
+			{
+				traits::construct(p_allocator, &p_source[i - 1 + p_offset], p_source[i - 1]);
+				traits::destroy(p_allocator, &p_source[i - 1]);
+			}
+		}
+		catch (...)
+		{
+			// The first i elements are still in place and the others were relocated, the ranges can not be joined without copying again.
+			for (size_t j(0); j != i; ++j)
+				traits::destroy(p_allocator, &p_source[j]);
+			for (size_t j(i); j != p_size; ++j)
+				traits::destroy(p_allocator, &p_source[j + p_offset]);
+			throw;
+		}
+	}
+}
+
+template <typename Alloc>
+void dsaa::relocate_left(Alloc &p_allocator, typename std::allocator_traits<Alloc>::pointer p_source, size_t p_size, size_t p_offset)
+{
+	using traits = std::allocator_traits<Alloc>;
+	using value_type = typename traits::value_type;
+
+	if (!p_size || !p_offset)
+		return;
+
+	if constexpr (dsaa::is_memcpy_relocatable_v<value_type, Alloc>)
+	{
+		std::memmove(static_cast<void *>(p_source - p_offset), static_cast<const void *>(p_source), p_size * sizeof(value_type));
+	}
+	else if constexpr (std::is_nothrow_move_constructible_v<value_type> || !std::is_copy_constructible_v<value_type>)
+	{
+		for (size_t i(0); i != p_size; ++i)
+		{
+			traits::construct(p_allocator, &p_source[i] - p_offset, std::move(p_source[i]));
+			traits::destroy(p_allocator, &p_source[i]);
+		}
+	}
+	else
+	{
+		size_t i(0);
+		try
+		{
+			for (; i != p_size; ++i)
+			{
+				traits::construct(p_allocator, &p_source[i] - p_offset, p_source[i]);
+				traits::destroy(p_allocator, &p_source[i]);
+			}
+		}
+		catch (...)
+		{
+			// The first i elements were relocated and the others are still in place.
+			for (size_t j(0); j != i; ++j)
+				traits::destroy(p_allocator, &p_source[j] - p_offset);
+			for (size_t j(i); j != p_size; ++j)
+				traits::destroy(p_allocator, &p_source[j]);
+			throw;
+		}
+	}
+}
+
+#endif // !DSAA_RELOCATE_H
@@ -0,0 +1 @@
+#include "Serialize.h"
\ No newline at end of file
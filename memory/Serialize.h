@@ -0,0 +1,427 @@
+#ifndef DSAA_SERIALIZE_H
+#define DSAA_SERIALIZE_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <cerrno>
+#include <string>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "dsaaTypedefs.h"
+#include "BinaryHeader.h"
+#include "DynamicArray.h"
+#include "Matrix.h"
+
+namespace dsaa
+{
+	// Writes p_array with a single write of its elements.
+	template <typename Elem, typename Alloc, typename GrowthPolicy>
+	void save(std::ostream &p_stream, const DynamicArray<Elem, Alloc, GrowthPolicy> &p_array);
+	template <typename Elem, typename Alloc, typename GrowthPolicy>
+	void save(const std::string &p_path, const DynamicArray<Elem, Alloc, GrowthPolicy> &p_array);
+	// Replaces the content of p_array by the elements read with a single read.
+	template <typename Elem, typename Alloc, typename GrowthPolicy>
+	void load(std::istream &p_stream, DynamicArray<Elem, Alloc, GrowthPolicy> &p_array);
+	template <typename Elem, typename Alloc, typename GrowthPolicy>
+	void load(const std::string &p_path, DynamicArray<Elem, Alloc, GrowthPolicy> &p_array);
+
+	// Writes p_matrix row by row, one write per row.
+	template <typename Elem, typename ElementAllocator, typename ContainerAllocator>
+	void save(std::ostream &p_stream, const Matrix<Elem, ElementAllocator, ContainerAllocator> &p_matrix);
+	template <typename Elem, typename ElementAllocator, typename ContainerAllocator>
+	void save(const std::string &p_path, const Matrix<Elem, ElementAllocator, ContainerAllocator> &p_matrix);
+	// Replaces the content of p_matrix, reading each row with a single read.
+	template <typename Elem, typename ElementAllocator, typename ContainerAllocator>
+	void load(std::istream &p_stream, Matrix<Elem, ElementAllocator, ContainerAllocator> &p_matrix);
+	template <typename Elem, typename ElementAllocator, typename ContainerAllocator>
+	void load(const std::string &p_path, Matrix<Elem, ElementAllocator, ContainerAllocator> &p_matrix);
+
+	// Read-only view of a file written by save, mapped with mmap. Elements are used in place, never copied.
+	template <typename Elem>
+	class MappedView final
+	{
+	public:
+		using value_type = Elem;
+		using const_reference = value_type const &;
+		using const_pointer = value_type const *;
+		using const_iterator = typename DynamicArray<Elem>::const_iterator;
+		using size_type = size_t;
+
+		static_assert(std::is_trivially_copyable_v<value_type>, "MappedView reads elements as raw bytes.");
+
+		// Maps the file at p_path and checks that it holds elements of type Elem.
+		explicit MappedView(const std::string &p_path);
+		MappedView(const MappedView &) = delete;
+		MappedView(MappedView &&p_other) noexcept;
+		MappedView &operator=(const MappedView &) = delete;
+		MappedView &operator=(MappedView &&p_other) noexcept;
+		~MappedView();
+
+		NODISCARD CONSTEXPR INLINE const_iterator begin() const noexcept;
+		NODISCARD CONSTEXPR INLINE const_iterator end() const noexcept;
+		NODISCARD CONSTEXPR INLINE const_reference operator[](const size_type &p_index) const NOEXCEPT;
+		NODISCARD CONSTEXPR INLINE const_pointer data() const noexcept;
+		// Returns a pointer to the first element of row p_row of a saved matrix.
+		NODISCARD CONSTEXPR INLINE const_pointer row(const size_type &p_row) const NOEXCEPT;
+
+		// Returns 1 for a saved DynamicArray and 2 for a saved Matrix.
+		NODISCARD CONSTEXPR INLINE size_type rank() const noexcept;
+		// Returns the total number of elements.
+		NODISCARD CONSTEXPR INLINE size_type size() const noexcept;
+		NODISCARD CONSTEXPR INLINE bool empty() const noexcept;
+		NODISCARD CONSTEXPR INLINE size_type row_size() const noexcept;
+		NODISCARD CONSTEXPR INLINE size_type column_size() const noexcept;
+
+	private:
+		NODISCARD CONSTEXPR INLINE const BinaryHeader &header() const noexcept;
+		void close() noexcept;
+
+		const unsigned char *m_mapping;
+		size_type m_bytes;
+	};
+}
+
+namespace dsaa
+{
+	namespace detail
+	{
+		inline void write_header(std::ostream &p_stream, const BinaryHeader &p_header)
+		{
+			unsigned char block[BinaryHeader::header_size]{};
+			std::memcpy(block, &p_header, sizeof(BinaryHeader));
+			p_stream.write(reinterpret_cast<const char *>(block), sizeof(block));
+		}
+
+		inline BinaryHeader read_header(std::istream &p_stream)
+		{
+			unsigned char block[BinaryHeader::header_size];
+			if (!p_stream.read(reinterpret_cast<char *>(block), sizeof(block)))
+				throw std::runtime_error("Can not read dsaa binary header.");
+
+			BinaryHeader result;
+			std::memcpy(&result, block, sizeof(BinaryHeader));
+			return result;
+		}
+
+		// Bytes read at a time from a stream whose length is unknown.
+		inline constexpr size_t load_chunk_bytes = size_t(1) << 20;
+
+		// Returns the number of bytes left in p_stream, or the largest value when the stream can not seek.
+		inline uint64_t remaining_bytes(std::istream &p_stream)
+		{
+			const std::istream::pos_type position(p_stream.tellg());
+			if (position == std::istream::pos_type(-1))
+				return std::numeric_limits<uint64_t>::max();
+
+			p_stream.seekg(0, std::ios::end);
+			const std::istream::pos_type end(p_stream.tellg());
+			p_stream.clear();
+			p_stream.seekg(position);
+			if (end == std::istream::pos_type(-1) || end < position)
+				return std::numeric_limits<uint64_t>::max();
+			return static_cast<uint64_t>(end - position);
+		}
+
+		// Appends p_count elements read from p_stream to p_array, returns false when the stream ends first.
+		// A stream of unknown length is read a chunk at a time, so a corrupt count runs out of bytes before all of them are allocated.
+		template <typename Elem, typename Alloc, typename GrowthPolicy>
+		bool read_elements(std::istream &p_stream, DynamicArray<Elem, Alloc, GrowthPolicy> &p_array, uint64_t p_count, bool p_bounded)
+		{
+			const size_t first(p_array.size()), chunk(p_bounded ? p_count : std::max<size_t>(load_chunk_bytes / sizeof(Elem), 1));
+			for (size_t loaded(0); loaded != p_count;)
+			{
+				const size_t count(std::min<uint64_t>(p_count - loaded, chunk));
+				if (p_array.capacity() < first + loaded + count)
+					p_array.reserve(std::max(2 * p_array.capacity(), first + loaded + count));
+				p_array.resize_default_init(first + loaded + count); // Every element is overwritten by the read.
+				if (!p_stream.read(reinterpret_cast<char *>(p_array.data() + first + loaded), static_cast<std::streamsize>(count * sizeof(Elem))))
+					return false;
+				loaded += count;
+			}
+			return true;
+		}
+
+		template <typename Stream>
+		Stream open_file(const std::string &p_path, std::ios::openmode p_mode)
+		{
+			Stream result(p_path, p_mode | std::ios::binary);
+			if (!result)
+				throw std::runtime_error("Can not open " + p_path + ".");
+			return result;
+		}
+	}
+}
+
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+void dsaa::save(std::ostream &p_stream, const DynamicArray<Elem, Alloc, GrowthPolicy> &p_array)
+{
+	static_assert(std::is_trivially_copyable_v<Elem>, "save writes elements as raw bytes.");
+
+	detail::write_header(p_stream, BinaryHeader::make<Elem>(1, p_array.size()));
+	p_stream.write(reinterpret_cast<const char *>(p_array.data()), p_array.size() * sizeof(Elem));
+	if (!p_stream)
+		throw std::runtime_error("Can not write dsaa binary data.");
+}
+
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+void dsaa::save(const std::string &p_path, const DynamicArray<Elem, Alloc, GrowthPolicy> &p_array)
+{
+	auto stream(detail::open_file<std::ofstream>(p_path, std::ios::out | std::ios::trunc));
+	save(stream, p_array);
+}
+
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+void dsaa::load(std::istream &p_stream, DynamicArray<Elem, Alloc, GrowthPolicy> &p_array)
+{
+	static_assert(std::is_trivially_copyable_v<Elem>, "load reads elements as raw bytes.");
+
+	BinaryHeader header(detail::read_header(p_stream));
+	const uint64_t remaining(detail::remaining_bytes(p_stream));
+	header.check<Elem>(1, remaining);
+
+	p_array.clear();
+	if (!detail::read_elements(p_stream, p_array, header.count(), remaining != std::numeric_limits<uint64_t>::max()))
+	{
+		p_array.clear();
+		throw std::runtime_error("dsaa binary file is truncated.");
+	}
+}
+
+template <typename Elem, typename Alloc, typename GrowthPolicy>
+void dsaa::load(const std::string &p_path, DynamicArray<Elem, Alloc, GrowthPolicy> &p_array)
+{
+	auto stream(detail::open_file<std::ifstream>(p_path, std::ios::in));
+	load(stream, p_array);
+}
+
+template <typename Elem, typename ElementAllocator, typename ContainerAllocator>
+void dsaa::save(std::ostream &p_stream, const Matrix<Elem, ElementAllocator, ContainerAllocator> &p_matrix)
+{
+	static_assert(std::is_trivially_copyable_v<Elem>, "save writes elements as raw bytes.");
+
+	const size_t columns(p_matrix.column_size());
+	detail::write_header(p_stream, BinaryHeader::make<Elem>(2, p_matrix.row_size(), columns));
+	for (size_t i(0); i != p_matrix.row_size(); ++i)
+	{
+		if (p_matrix[i].size() != columns)
+			throw std::invalid_argument("save requires all rows of the matrix to have the same size.");
+		p_stream.write(reinterpret_cast<const char *>(p_matrix[i].data()), columns * sizeof(Elem));
+	}
+	if (!p_stream)
+		throw std::runtime_error("Can not write dsaa binary data.");
+}
+
+template <typename Elem, typename ElementAllocator, typename ContainerAllocator>
+void dsaa::save(const std::string &p_path, const Matrix<Elem, ElementAllocator, ContainerAllocator> &p_matrix)
+{
+	auto stream(detail::open_file<std::ofstream>(p_path, std::ios::out | std::ios::trunc));
+	save(stream, p_matrix);
+}
+
+template <typename Elem, typename ElementAllocator, typename ContainerAllocator>
+void dsaa::load(std::istream &p_stream, Matrix<Elem, ElementAllocator, ContainerAllocator> &p_matrix)
+{
+	static_assert(std::is_trivially_copyable_v<Elem>, "load reads elements as raw bytes.");
+
+	BinaryHeader header(detail::read_header(p_stream));
+	const uint64_t remaining(detail::remaining_bytes(p_stream));
+	header.check<Elem>(2, remaining);
+
+	const size_t rows(header.extents[0]), columns(header.extents[1]);
+	p_matrix.resize(0, 0);
+	if (remaining == std::numeric_limits<uint64_t>::max())
+	{
+		// The length of the stream is unknown: the elements are read first, so that a corrupt header fails before the matrix is allocated.
+		DynamicArray<Elem> elements;
+		if (!detail::read_elements(p_stream, elements, header.count(), false))
+			throw std::runtime_error("dsaa binary file is truncated.");
+		p_matrix.resize(rows, columns);
+		for (size_t i(0); i != rows; ++i)
+			std::copy(elements.data() + i * columns, elements.data() + (i + 1) * columns, p_matrix[i].data());
+		return;
+	}
+	p_matrix.resize(rows, columns);
+	for (size_t i(0); i != rows; ++i)
+	{
+		if (!p_stream.read(reinterpret_cast<char *>(p_matrix[i].data()), columns * sizeof(Elem)))
+		{
+			p_matrix.resize(0, 0);
+			throw std::runtime_error("dsaa binary file is truncated.");
+		}
+	}
+}
+
+template <typename Elem, typename ElementAllocator, typename ContainerAllocator>
+void dsaa::load(const std::string &p_path, Matrix<Elem, ElementAllocator, ContainerAllocator> &p_matrix)
+{
+	auto stream(detail::open_file<std::ifstream>(p_path, std::ios::in));
+	load(stream, p_matrix);
+}
+
+template <typename Elem>
+dsaa::MappedView<Elem>::MappedView(const std::string &p_path)
+	: m_mapping(nullptr), m_bytes(0)
+{
+	int file(::open(p_path.c_str(), O_RDONLY | O_CLOEXEC));
+	if (file < 0)
+		throw std::system_error(errno, std::generic_category(), "MappedView: can not open " + p_path);
+
+	struct stat status;
+	if (::fstat(file, &status) < 0)
+	{
+		int error(errno);
+		::close(file);
+		throw std::system_error(error, std::generic_category(), "MappedView: can not stat " + p_path);
+	}
+	m_bytes = static_cast<size_type>(status.st_size);
+	if (m_bytes < BinaryHeader::header_size)
+	{
+		::close(file);
+		throw std::runtime_error("Not a dsaa binary file.");
+	}
+
+	void *mapping(::mmap(nullptr, m_bytes, PROT_READ, MAP_SHARED, file, 0));
+	int error(errno);
+	// The mapping keeps the file alive.
+	::close(file);
+	if (MAP_FAILED == mapping)
+		throw std::system_error(error, std::generic_category(), "MappedView: can not map " + p_path);
+	m_mapping = static_cast<const unsigned char *>(mapping);
+
+	try
+	{
+		if (header().rank != 1 && header().rank != 2)
+			throw std::runtime_error("dsaa binary file holds data of an unknown rank.");
+		header().template check<Elem>(header().rank, m_bytes - BinaryHeader::header_size);
+	}
+	catch (...)
+	{
+		close();
+		throw;
+	}
+}
+
+template <typename Elem>
+dsaa::MappedView<Elem>::MappedView(MappedView &&p_other) noexcept
+	: m_mapping(p_other.m_mapping), m_bytes(p_other.m_bytes)
+{
+	p_other.m_mapping = nullptr;
+	p_other.m_bytes = 0;
+}
+
+template <typename Elem>
+dsaa::MappedView<Elem> &dsaa::MappedView<Elem>::operator=(MappedView &&p_other) noexcept
+{
+	if (this == &p_other)
+		return *this;
+
+	close();
+	m_mapping = p_other.m_mapping;
+	m_bytes = p_other.m_bytes;
+	p_other.m_mapping = nullptr;
+	p_other.m_bytes = 0;
+	return *this;
+}
+
+template <typename Elem>
+dsaa::MappedView<Elem>::~MappedView()
+{
+	close();
+}
+
+template <typename Elem>
+CONSTEXPR typename dsaa::MappedView<Elem>::const_iterator dsaa::MappedView<Elem>::begin() const noexcept
+{
+	return size() ? const_iterator(data()) : const_iterator(nullptr);
+}
+
+template <typename Elem>
+CONSTEXPR typename dsaa::MappedView<Elem>::const_iterator dsaa::MappedView<Elem>::end() const noexcept
+{
+	return size() ? const_iterator(data() + size()) : const_iterator(nullptr);
+}
+
+template <typename Elem>
+CONSTEXPR typename dsaa::MappedView<Elem>::const_reference dsaa::MappedView<Elem>::operator[](const size_type &p_index) const NOEXCEPT
+{
+#ifdef PARAM_CHECK
+	if (size() <= p_index)
+		throw std::out_of_range("p_index out of range exception.\n;");
+#endif
+
+	return data()[p_index];
+}
+
+template <typename Elem>
+CONSTEXPR typename dsaa::MappedView<Elem>::const_pointer dsaa::MappedView<Elem>::data() const noexcept
+{
+	return m_mapping ? reinterpret_cast<const_pointer>(m_mapping + BinaryHeader::header_size) : nullptr;
+}
+
+template <typename Elem>
+CONSTEXPR typename dsaa::MappedView<Elem>::const_pointer dsaa::MappedView<Elem>::row(const size_type &p_row) const NOEXCEPT
+{
+#ifdef PARAM_CHECK
+	if (row_size() <= p_row)
+		throw std::out_of_range("p_row out of range exception.\n;");
+#endif
+
+	return data() + p_row * column_size();
+}
+
+template <typename Elem>
+CONSTEXPR typename dsaa::MappedView<Elem>::size_type dsaa::MappedView<Elem>::rank() const noexcept
+{
+	return m_mapping ? header().rank : 0;
+}
+
+template <typename Elem>
+CONSTEXPR typename dsaa::MappedView<Elem>::size_type dsaa::MappedView<Elem>::size() const noexcept
+{
+	return m_mapping ? header().count() : 0;
+}
+
+template <typename Elem>
+CONSTEXPR bool dsaa::MappedView<Elem>::empty() const noexcept
+{
+	return size() == 0;
+}
+
+template <typename Elem>
+CONSTEXPR typename dsaa::MappedView<Elem>::size_type dsaa::MappedView<Elem>::row_size() const noexcept
+{
+	return rank() == 2 ? header().extents[0] : 1;
+}
+
+template <typename Elem>
+CONSTEXPR typename dsaa::MappedView<Elem>::size_type dsaa::MappedView<Elem>::column_size() const noexcept
+{
+	return rank() == 2 ? header().extents[1] : size();
+}
+
+template <typename Elem>
+CONSTEXPR const dsaa::BinaryHeader &dsaa::MappedView<Elem>::header() const noexcept
+{
+	return *reinterpret_cast<const BinaryHeader *>(m_mapping);
+}
+
+template <typename Elem>
+void dsaa::MappedView<Elem>::close() noexcept
+{
+	if (m_mapping)
+		::munmap(const_cast<unsigned char *>(m_mapping), m_bytes);
+	m_mapping = nullptr;
+	m_bytes = 0;
+}
+
+#endif // !DSAA_SERIALIZE_H
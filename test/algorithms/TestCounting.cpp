@@ -0,0 +1,282 @@
+#ifndef DSAA_TEST_COUNTING_H
+#define DSAA_TEST_COUNTING_H
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+
+#include "Catch2/Catch.hpp"
+#include "algorithms/Counting.h"
+#include "algorithms/Heap.h"
+#include "algorithms/ParallelSort.h"
+#include "algorithms/Search.h"
+#include "algorithms/Sort.h"
+#include "arrays/DynamicArray.h"
+#include "algorithms/Random.h"
+
+namespace
+{
+    using Element = dsaa::CountedElement<int, true>;
+
+    dsaa::DynamicArray<Element> counted_elements(size_t p_size)
+    {
+        dsaa::DynamicArray<int> param(dsaa::random::random_range_ints<int>(p_size, -100, 100));
+        return dsaa::DynamicArray<Element>(param.begin(), param.end());
+    }
+
+    bool elements_sorted(const dsaa::DynamicArray<Element> &p_arr)
+    {
+        return std::is_sorted(p_arr.begin(), p_arr.end(), [](const Element &p_lhs, const Element &p_rhs)
+                              { return p_lhs.value() < p_rhs.value(); });
+    }
+}
+
+static_assert(sizeof(dsaa::CountingIterator<int *, false>) == sizeof(int *));
+static_assert(sizeof(dsaa::CountedElement<long, false>) == sizeof(long));
+static_assert(std::is_same_v<std::iterator_traits<dsaa::CountingIterator<int *>>::iterator_category, std::random_access_iterator_tag>);
+
+TEST_CASE("Test CountingCompare.", "[Counting]")
+{
+    dsaa::operation_counter.reset();
+
+    SECTION("Every call is counted.")
+    {
+        for (size_t arr_size : {0u, 1u, 2u, 17u, 500u})
+        {
+            dsaa::DynamicArray<int> param(dsaa::random::random_range_ints<int>(arr_size, -50, 50));
+            dsaa::DynamicArray<int> arr(param), reference(param);
+            size_t calls(0);
+
+            dsaa::operation_counter.reset();
+            dsaa::merge_sort(arr.begin(), arr.end(), dsaa::CountingCompare<std::less<int>, true>());
+            dsaa::merge_sort(reference.begin(), reference.end(), [&calls](int p_lhs, int p_rhs)
+                             { return ++calls, p_lhs < p_rhs; });
+
+            REQUIRE(std::is_sorted(arr.begin(), arr.end()));
+            REQUIRE(dsaa::operation_counter.counts().comparisons == calls);
+        }
+    }
+
+    SECTION("Default constructed by the algorithm.")
+    {
+        dsaa::DynamicArray<int> arr(dsaa::random::random_range_ints<int>(100));
+
+        dsaa::build_heap<typename dsaa::DynamicArray<int>::iterator, dsaa::CountingCompare<std::greater_equal<int>, true>>(arr.begin(), arr.end());
+
+        REQUIRE(std::is_heap(arr.begin(), arr.end()));
+        REQUIRE(dsaa::operation_counter.counts().comparisons > 0);
+    }
+
+    SECTION("Counts from several threads.")
+    {
+        dsaa::DynamicArray<int> param(dsaa::random::random_range_ints<int>(20000));
+        dsaa::DynamicArray<int> arr(param), reference(param);
+        dsaa::ParallelSortOptions options;
+        options.thread_count = 4;
+        options.grain_size = 512;
+        size_t calls(0);
+
+        dsaa::parallel_merge_sort(arr.begin(), arr.end(), dsaa::CountingCompare<std::less<int>, true>(), options);
+        dsaa::merge_sort(reference.begin(), reference.end(), [&calls](int p_lhs, int p_rhs)
+                         { return ++calls, p_lhs < p_rhs; });
+
+        REQUIRE(std::is_sorted(arr.begin(), arr.end()));
+        REQUIRE(dsaa::operation_counter.counts().comparisons >= calls / 2);
+    }
+
+    SECTION("Disabled, it only forwards.")
+    {
+        dsaa::DynamicArray<int> arr(dsaa::random::random_range_ints<int>(100));
+
+        dsaa::tim_sort(arr.begin(), arr.end(), dsaa::CountingCompare<std::less<int>, false>());
+
+        REQUIRE(std::is_sorted(arr.begin(), arr.end()));
+        REQUIRE(dsaa::operation_counter.counts().comparisons == 0);
+    }
+}
+
+TEST_CASE("Test CountingIterator.", "[Counting]")
+{
+    dsaa::operation_counter.reset();
+
+    SECTION("Composes with the sorts.")
+    {
+        dsaa::DynamicArray<int> param(dsaa::random::random_range_ints<int>(1000, -100, 100));
+        auto sort_through_counting_iterators = [&param](auto p_sort)
+        {
+            dsaa::DynamicArray<int> arr(param);
+            dsaa::operation_counter.reset();
+            p_sort(dsaa::make_counting_iterator<true>(arr.begin()), dsaa::make_counting_iterator<true>(arr.end()));
+            return std::is_sorted(arr.begin(), arr.end()) && dsaa::operation_counter.counts().dereferences >= arr.size();
+        };
+
+        REQUIRE(sort_through_counting_iterators([](auto p_first, auto p_last)
+                                                { dsaa::insertion_sort(p_first, p_last); }));
+        REQUIRE(sort_through_counting_iterators([](auto p_first, auto p_last)
+                                                { dsaa::merge_sort(p_first, p_last); }));
+        REQUIRE(sort_through_counting_iterators([](auto p_first, auto p_last)
+                                                { dsaa::tim_sort(p_first, p_last); }));
+        REQUIRE(sort_through_counting_iterators([](auto p_first, auto p_last)
+                                                { dsaa::hoare_quick_sort(p_first, p_last); }));
+        REQUIRE(sort_through_counting_iterators([](auto p_first, auto p_last)
+                                                { dsaa::sort(p_first, p_last); }));
+        REQUIRE(sort_through_counting_iterators([](auto p_first, auto p_last)
+                                                { dsaa::partial_sort(p_first, p_last, p_last); }));
+        REQUIRE(sort_through_counting_iterators([](auto p_first, auto p_last)
+                                                { dsaa::counting_sort(p_first, p_last); }));
+        REQUIRE(sort_through_counting_iterators([](auto p_first, auto p_last)
+                                                {
+                                                    dsaa::build_heap(p_first, p_last);
+                                                    dsaa::sort_heap(p_first, p_last); }));
+    }
+
+    SECTION("Composes with the searches.")
+    {
+        dsaa::DynamicArray<int> arr(dsaa::random::random_range_ints<int>(1000));
+        std::sort(arr.begin(), arr.end());
+        auto first(dsaa::make_counting_iterator<true>(arr.begin())), last(dsaa::make_counting_iterator<true>(arr.end()));
+
+        auto result(dsaa::binary_search(first, last, arr[500]));
+
+        REQUIRE(*result == arr[500]);
+        REQUIRE(dsaa::operation_counter.counts().dereferences > 0);
+        REQUIRE(dsaa::operation_counter.counts().dereferences < 100);
+    }
+
+    SECTION("Every access is counted.")
+    {
+        int values[] = {3, 1, 2};
+        auto iter(dsaa::make_counting_iterator<true>(values + 0));
+
+        int sum(*iter + iter[1] + *(iter + 2));
+        iter_swap(iter, iter + 1);
+
+        REQUIRE(sum == 6);
+        REQUIRE(values[0] == 1);
+        REQUIRE(dsaa::operation_counter.counts().dereferences == 3);
+        REQUIRE(dsaa::operation_counter.counts().swaps == 1);
+    }
+
+    SECTION("Disabled, it only forwards.")
+    {
+        dsaa::DynamicArray<int> arr(dsaa::random::random_range_ints<int>(100));
+
+        dsaa::sort(dsaa::make_counting_iterator<false>(arr.begin()), dsaa::make_counting_iterator<false>(arr.end()));
+
+        REQUIRE(std::is_sorted(arr.begin(), arr.end()));
+        REQUIRE(dsaa::operation_counter.counts().dereferences == 0);
+    }
+}
+
+TEST_CASE("Test CountedElement.", "[Counting]")
+{
+    dsaa::operation_counter.reset();
+
+    SECTION("Copies, moves and assignments.")
+    {
+        Element first(1), second(first), third(std::move(first));
+        second = third;
+        third = Element(4);
+
+        dsaa::OperationCounts counts(dsaa::operation_counter.counts());
+        REQUIRE(counts.copies == 1);
+        REQUIRE(counts.moves == 1);
+        REQUIRE(counts.assignments == 2);
+        REQUIRE(third.value() == 4);
+    }
+
+    SECTION("Comparisons and swaps.")
+    {
+        dsaa::DynamicArray<Element> arr(counted_elements(2));
+        arr[0] = Element(2);
+        arr[1] = Element(1);
+        dsaa::operation_counter.reset();
+
+        if (arr[1] < arr[0] && arr[0] != arr[1])
+            std::iter_swap(arr.begin(), arr.begin() + 1);
+
+        dsaa::OperationCounts counts(dsaa::operation_counter.counts());
+        REQUIRE(counts.comparisons == 2);
+        REQUIRE(counts.swaps == 1);
+        REQUIRE(counts.moves + counts.assignments == 0);
+        REQUIRE(arr[0].value() == 1);
+    }
+
+    SECTION("Composes with the sorts.")
+    {
+        dsaa::DynamicArray<Element> arr(counted_elements(1000)), reference(arr);
+        size_t calls(0);
+        dsaa::merge_sort(reference.begin(), reference.end(), [&calls](const Element &p_lhs, const Element &p_rhs)
+                         { return ++calls, p_lhs.value() < p_rhs.value(); });
+        dsaa::operation_counter.reset();
+
+        dsaa::merge_sort(arr.begin(), arr.end());
+
+        dsaa::OperationCounts counts(dsaa::operation_counter.counts());
+        REQUIRE(elements_sorted(arr));
+        REQUIRE(counts.comparisons == calls);
+        REQUIRE(counts.moves + counts.assignments >= 1000);
+
+        arr = counted_elements(1000);
+        dsaa::nth_element(arr.begin(), arr.begin() + 500, arr.end());
+        dsaa::DynamicArray<Element> top(dsaa::top_k(arr.begin(), arr.end(), 10));
+        dsaa::tim_sort(arr.begin(), arr.end());
+
+        REQUIRE(elements_sorted(arr));
+        REQUIRE(top.size() == 10);
+    }
+
+    SECTION("The swaps of the sorts are counted.")
+    {
+        dsaa::DynamicArray<Element> param(counted_elements(1000));
+        auto sort_swaps = [&param](auto p_sort)
+        {
+            dsaa::DynamicArray<Element> arr(param);
+            dsaa::operation_counter.reset();
+            p_sort(arr.begin(), arr.end());
+            return elements_sorted(arr) ? dsaa::operation_counter.counts().swaps : 0;
+        };
+
+        REQUIRE(sort_swaps([](auto p_first, auto p_last)
+                           { dsaa::sort(p_first, p_last); }) > 0);
+        REQUIRE(sort_swaps([](auto p_first, auto p_last)
+                           { dsaa::hoare_quick_sort(p_first, p_last); }) > 0);
+        REQUIRE(sort_swaps([](auto p_first, auto p_last)
+                           { dsaa::lomuto_quick_sort(p_first, p_last); }) > 0);
+        REQUIRE(sort_swaps([](auto p_first, auto p_last)
+                           { dsaa::selection_sort(p_first, p_last); }) > 0);
+        REQUIRE(sort_swaps([](auto p_first, auto p_last)
+                           {
+                               dsaa::build_heap(p_first, p_last);
+                               dsaa::sort_heap(p_first, p_last); }) > 0);
+    }
+
+    SECTION("With every adapter.")
+    {
+        dsaa::DynamicArray<Element> arr(counted_elements(300));
+        dsaa::operation_counter.reset();
+
+        dsaa::hoare_quick_sort(dsaa::make_counting_iterator<true>(arr.begin()), dsaa::make_counting_iterator<true>(arr.end()),
+                               dsaa::CountingCompare<std::less<Element>, true>());
+
+        dsaa::OperationCounts counts(dsaa::operation_counter.counts());
+        REQUIRE(elements_sorted(arr));
+        // Counted by the comparator and by the elements.
+        REQUIRE(counts.comparisons % 2 == 0);
+        REQUIRE(counts.dereferences > 0);
+    }
+
+    SECTION("Disabled, it only forwards.")
+    {
+        dsaa::DynamicArray<int> param(dsaa::random::random_range_ints<int>(100));
+        dsaa::DynamicArray<dsaa::CountedElement<int, false>> arr(param.begin(), param.end());
+
+        dsaa::merge_sort(arr.begin(), arr.end());
+
+        REQUIRE(std::is_sorted(arr.begin(), arr.end()));
+        REQUIRE(dsaa::operation_counter.counts().comparisons == 0);
+        REQUIRE(dsaa::operation_counter.counts().assignments == 0);
+    }
+}
+
+#endif // !DSAA_TEST_COUNTING_H
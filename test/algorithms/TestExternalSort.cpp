@@ -0,0 +1,170 @@
+#ifndef DSAA_TEST_EXTERNAL_SORT_H
+#define DSAA_TEST_EXTERNAL_SORT_H
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "Catch2/Catch.hpp"
+#include "algorithms/ExternalSort.h"
+#include "algorithms/Random.h"
+
+namespace
+{
+    // A directory removed with everything in it at the end of a test.
+    struct TemporaryDirectory
+    {
+        explicit TemporaryDirectory(const char *p_name) : path(std::filesystem::temp_directory_path() / p_name)
+        {
+            std::filesystem::remove_all(path);
+            std::filesystem::create_directory(path);
+        }
+        ~TemporaryDirectory() { std::filesystem::remove_all(path); }
+
+        std::string file(const char *p_name) const { return (path / p_name).string(); }
+        size_t file_count() const { return static_cast<size_t>(std::distance(std::filesystem::directory_iterator(path), std::filesystem::directory_iterator())); }
+
+        std::filesystem::path path;
+    };
+
+    struct LogRecord
+    {
+        uint32_t timestamp;
+        uint32_t line;
+
+        bool operator<(const LogRecord &p_other) const noexcept { return timestamp < p_other.timestamp; }
+        bool operator==(const LogRecord &p_other) const noexcept { return timestamp == p_other.timestamp && line == p_other.line; }
+    };
+
+    template <typename Record>
+    void write_file(const std::string &p_path, const std::vector<Record> &p_records)
+    {
+        std::ofstream stream(p_path, std::ios::binary | std::ios::trunc);
+        stream.write(reinterpret_cast<const char *>(p_records.data()), static_cast<std::streamsize>(p_records.size() * sizeof(Record)));
+    }
+
+    template <typename Record>
+    std::vector<Record> read_file(const std::string &p_path)
+    {
+        std::vector<Record> result(std::filesystem::file_size(p_path) / sizeof(Record));
+        std::ifstream stream(p_path, std::ios::binary);
+        stream.read(reinterpret_cast<char *>(result.data()), static_cast<std::streamsize>(result.size() * sizeof(Record)));
+        return result;
+    }
+
+    std::vector<LogRecord> log_records(size_t p_size, uint32_t p_timestamps)
+    {
+        dsaa::DynamicArray<uint32_t> timestamps(dsaa::random::random_range_ints<uint32_t>(p_size, 0, p_timestamps - 1));
+        std::vector<LogRecord> result;
+        for (size_t i(0); i != p_size; ++i)
+            result.push_back({timestamps[i], static_cast<uint32_t>(i)});
+        return result;
+    }
+}
+
+TEST_CASE("Test external_sort.", "[ExternalSort]")
+{
+    TemporaryDirectory directory("dsaa-test-external-sort");
+    const std::string input(directory.file("input.bin")), output(directory.file("output.bin"));
+    dsaa::ExternalSortOptions options;
+    options.temp_directory = directory.file("");
+    options.sort.thread_count = 2;
+    options.sort.grain_size = 256;
+
+    SECTION("Input sorted in memory.")
+    {
+        std::vector<LogRecord> records(log_records(1000, 100));
+        write_file(input, records);
+
+        dsaa::ExternalSortResult result(dsaa::external_sort<LogRecord>(input, output, std::less<LogRecord>(), options));
+
+        std::stable_sort(records.begin(), records.end());
+        REQUIRE(result.records == 1000);
+        REQUIRE(result.runs == 0);
+        REQUIRE(read_file<LogRecord>(output) == records);
+    }
+
+    SECTION("Runs merged in a single pass are stable.")
+    {
+        options.memory_budget = 3000 * sizeof(LogRecord);
+        options.io_buffer_size = 50 * sizeof(LogRecord);
+        std::vector<LogRecord> records(log_records(20000, 500));
+        write_file(input, records);
+
+        dsaa::ExternalSortResult result(dsaa::external_sort<LogRecord>(input, output, std::less<LogRecord>(), options));
+
+        std::stable_sort(records.begin(), records.end());
+        REQUIRE(result.runs == 20);
+        REQUIRE(result.merge_passes == 1);
+        REQUIRE(read_file<LogRecord>(output) == records);
+        REQUIRE(directory.file_count() == 2);
+    }
+
+    SECTION("Runs merged in several passes are stable.")
+    {
+        // Three runs are merged at a time.
+        options.memory_budget = 24 * sizeof(LogRecord);
+        options.io_buffer_size = 3 * sizeof(LogRecord);
+        std::vector<LogRecord> records(log_records(2000, 50));
+        write_file(input, records);
+
+        dsaa::ExternalSortResult result(dsaa::external_sort<LogRecord>(input, output, std::less<LogRecord>(), options));
+
+        std::stable_sort(records.begin(), records.end());
+        REQUIRE(result.runs == 250);
+        REQUIRE(result.merge_passes == 6);
+        REQUIRE(read_file<LogRecord>(output) == records);
+        REQUIRE(directory.file_count() == 2);
+    }
+
+    SECTION("Every size up to a few runs, with a comparator.")
+    {
+        options.memory_budget = 30 * sizeof(uint64_t);
+        options.io_buffer_size = 4 * sizeof(uint64_t);
+        for (size_t size(0); size != 100; ++size)
+        {
+            dsaa::DynamicArray<uint64_t> param(dsaa::random::random_range_ints<uint64_t>(size, 0, 1000));
+            std::vector<uint64_t> records(param.begin(), param.end());
+            write_file(input, records);
+
+            dsaa::external_sort<uint64_t>(input, output, std::greater<uint64_t>(), options);
+
+            std::sort(records.begin(), records.end(), std::greater<uint64_t>());
+            REQUIRE(read_file<uint64_t>(output) == records);
+        }
+    }
+
+    SECTION("The input is the output.")
+    {
+        options.memory_budget = 300 * sizeof(uint64_t);
+        for (size_t size : {50, 5000})
+        {
+            dsaa::DynamicArray<uint64_t> param(dsaa::random::random_range_ints<uint64_t>(size));
+            std::vector<uint64_t> records(param.begin(), param.end());
+            write_file(input, records);
+
+            dsaa::external_sort<uint64_t>(input, input, std::less<uint64_t>(), options);
+
+            std::sort(records.begin(), records.end());
+            REQUIRE(read_file<uint64_t>(input) == records);
+        }
+    }
+
+    SECTION("A partial record is rejected.")
+    {
+        write_file(input, std::vector<uint32_t>(5, 1));
+
+        REQUIRE_THROWS_AS(dsaa::external_sort<uint64_t>(input, output, std::less<uint64_t>(), options), std::runtime_error);
+    }
+
+    SECTION("A missing input is rejected.")
+    {
+        REQUIRE_THROWS(dsaa::external_sort<uint64_t>(directory.file("missing.bin"), output, std::less<uint64_t>(), options));
+        REQUIRE(directory.file_count() == 0);
+    }
+}
+
+#endif // !DSAA_TEST_EXTERNAL_SORT_H
@@ -0,0 +1,514 @@
+#ifndef DSAA_TEST_PARALLEL_SORT_H
+#define DSAA_TEST_PARALLEL_SORT_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Catch2/Catch.hpp"
+#include "algorithms/ParallelSort.h"
+#include "arrays/DynamicArray.h"
+#include "algorithms/Random.h"
+#include "test/TestObject.h"
+
+TEST_CASE("Test parallel_sort.", "[ParallelSort]")
+{
+    SECTION("Small sequences are sorted serially.")
+    {
+        for (size_t arr_size(0); arr_size != 40; ++arr_size)
+        {
+            dsaa::DynamicArray<int> param(dsaa::random::random_range_ints<int>(arr_size, -10, 10));
+            dsaa::DynamicArray<TestObject<int>> arr(param.begin(), param.end());
+
+            dsaa::parallel_sort(arr.begin(), arr.end());
+
+            REQUIRE(dsaa::is_sorted(arr.begin(), arr.end(), std::less_equal<TestObject<int>>()));
+        }
+    }
+
+    SECTION("Same result as sort for every thread count and grain size.")
+    {
+        using Pair = std::pair<int, int>;
+        auto by_key([](const Pair &p_lhs, const Pair &p_rhs)
+                    { return p_lhs.first < p_rhs.first; });
+
+        dsaa::DynamicArray<int> keys(dsaa::random::random_range_ints<int>(20000, 0, 500));
+        dsaa::DynamicArray<Pair> source;
+        for (size_t i(0); i != keys.size(); ++i)
+            source.insert_last(Pair(keys[i], static_cast<int>(i)));
+        dsaa::DynamicArray<Pair> expected(source);
+        dsaa::sort(expected.begin(), expected.end(), by_key);
+
+        for (size_t thread_count : {1, 2, 4})
+            for (size_t grain_size : {0, 100, 5000})
+            {
+                dsaa::DynamicArray<Pair> arr(source);
+                dsaa::ParallelSortOptions options;
+                options.thread_count = thread_count;
+                options.grain_size = grain_size;
+
+                dsaa::parallel_sort(arr.begin(), arr.end(), by_key, options);
+
+                REQUIRE(std::equal(arr.begin(), arr.end(), expected.begin(), expected.end()));
+            }
+    }
+
+    SECTION("Elements are neither lost nor duplicated.")
+    {
+        {
+            dsaa::DynamicArray<int> param(dsaa::random::random_range_ints<int>(10000, -100, 100));
+            dsaa::DynamicArray<TestObject<int>> arr(param.begin(), param.end());
+            dsaa::ParallelSortOptions options;
+            options.thread_count = 4;
+            options.grain_size = 64;
+
+            dsaa::parallel_sort(arr.begin(), arr.end(), std::less<TestObject<int>>(), options);
+
+            REQUIRE(dsaa::is_sorted(arr.begin(), arr.end(), std::less_equal<TestObject<int>>()));
+            REQUIRE(dsaa::TestObject::livecount == 10000);
+        }
+        REQUIRE(dsaa::TestObject::livecount == 0);
+    }
+
+    SECTION("A shared pool and the heap sort fallback.")
+    {
+        dsaa::TaskPool pool(3);
+        dsaa::ParallelSortOptions options;
+        options.pool = &pool;
+        options.grain_size = 32;
+
+        const int arr_size(5000);
+        dsaa::DynamicArray<int> organ_pipe(arr_size, dsaa::default_init);
+        for (int i(0); i != arr_size; ++i)
+            organ_pipe[i] = i < arr_size / 2 ? i : arr_size - i;
+        dsaa::DynamicArray<int> expected(organ_pipe);
+        dsaa::sort(expected.begin(), expected.end());
+
+        dsaa::parallel_sort(organ_pipe.begin(), organ_pipe.end(), std::less<int>(), options);
+
+        REQUIRE(std::equal(organ_pipe.begin(), organ_pipe.end(), expected.begin(), expected.end()));
+    }
+}
+
+TEST_CASE("Test parallel_merge_sort.", "[ParallelSort]")
+{
+    SECTION("Small sequences.")
+    {
+        for (size_t arr_size(0); arr_size != 40; ++arr_size)
+        {
+            dsaa::DynamicArray<int> param(dsaa::random::random_range_ints<int>(arr_size, -10, 10));
+            dsaa::DynamicArray<TestObject<int>> arr(param.begin(), param.end());
+
+            dsaa::parallel_merge_sort(arr.begin(), arr.end());
+
+            REQUIRE(dsaa::is_sorted(arr.begin(), arr.end(), std::less_equal<TestObject<int>>()));
+        }
+    }
+
+    SECTION("Stable for every thread count and grain size.")
+    {
+        using Pair = std::pair<int, int>;
+        auto by_key([](const Pair &p_lhs, const Pair &p_rhs)
+                    { return p_lhs.first < p_rhs.first; });
+
+        dsaa::DynamicArray<int> keys(dsaa::random::random_range_ints<int>(20000, 0, 100));
+        dsaa::DynamicArray<Pair> source;
+        for (size_t i(0); i != keys.size(); ++i)
+            source.insert_last(Pair(keys[i], static_cast<int>(i)));
+        dsaa::DynamicArray<Pair> expected(source);
+        std::stable_sort(expected.begin(), expected.end(), by_key);
+
+        for (size_t thread_count : {1, 2, 4})
+            for (size_t grain_size : {0, 100, 5000})
+            {
+                dsaa::DynamicArray<Pair> arr(source);
+                dsaa::ParallelSortOptions options;
+                options.thread_count = thread_count;
+                options.grain_size = grain_size;
+
+                dsaa::parallel_merge_sort(arr.begin(), arr.end(), by_key, options);
+
+                REQUIRE(std::equal(arr.begin(), arr.end(), expected.begin(), expected.end()));
+            }
+    }
+
+    SECTION("Unbalanced merges.")
+    {
+        dsaa::DynamicArray<int> arr(dsaa::random::random_range_ints<int>(3000, 0, 3));
+        for (int i(0); i != 1000; ++i)
+            arr.insert_last(-i);
+        dsaa::DynamicArray<int> expected(arr);
+        std::sort(expected.begin(), expected.end(), std::greater<int>());
+        dsaa::ParallelSortOptions options;
+        options.thread_count = 2;
+        options.grain_size = 20;
+
+        dsaa::parallel_merge_sort(arr.begin(), arr.end(), std::greater<int>(), options);
+
+        REQUIRE(std::equal(arr.begin(), arr.end(), expected.begin(), expected.end()));
+    }
+
+    SECTION("Elements are neither lost nor duplicated.")
+    {
+        {
+            dsaa::DynamicArray<int> param(dsaa::random::random_range_ints<int>(10000, -100, 100));
+            dsaa::DynamicArray<TestObject<int>> arr(param.begin(), param.end());
+            dsaa::ParallelSortOptions options;
+            options.thread_count = 4;
+            options.grain_size = 64;
+
+            dsaa::parallel_merge_sort(arr.begin(), arr.end(), std::less<TestObject<int>>(), options);
+
+            REQUIRE(dsaa::is_sorted(arr.begin(), arr.end(), std::less_equal<TestObject<int>>()));
+            REQUIRE(dsaa::TestObject::livecount == 10000);
+        }
+        REQUIRE(dsaa::TestObject::livecount == 0);
+    }
+}
+
+namespace
+{
+    dsaa::DynamicArray<std::string> random_strings(size_t p_size, size_t p_max_length, char p_max_char)
+    {
+        dsaa::DynamicArray<std::string> result;
+        dsaa::DynamicArray<int> lengths(dsaa::random::random_range_ints<int>(p_size, 0, static_cast<int>(p_max_length)));
+        for (size_t i(0); i != p_size; ++i)
+        {
+            std::string value;
+            for (int c : dsaa::random::random_range_ints<int>(lengths[i], 'a', p_max_char))
+                value.push_back(static_cast<char>(c));
+            result.insert_last(std::move(value));
+        }
+        return result;
+    }
+}
+
+TEST_CASE("Test msd_radix_sort.", "[ParallelSort]")
+{
+    SECTION("Short strings over a small alphabet, every thread count and grain size.")
+    {
+        const dsaa::DynamicArray<std::string> source(random_strings(20000, 8, 'd'));
+        dsaa::DynamicArray<std::string> expected(source);
+        std::sort(expected.begin(), expected.end());
+
+        for (size_t thread_count : {1, 2, 4})
+            for (size_t grain_size : {0, 500, 100000})
+            {
+                dsaa::DynamicArray<std::string> arr(source);
+                dsaa::ParallelSortOptions options;
+                options.thread_count = thread_count;
+                options.grain_size = grain_size;
+
+                dsaa::msd_radix_sort(arr.begin(), arr.end(), dsaa::identity_key(), options);
+
+                REQUIRE(std::equal(arr.begin(), arr.end(), expected.begin(), expected.end()));
+            }
+    }
+
+    SECTION("Long common prefixes, empty strings and bytes above 127.")
+    {
+        dsaa::DynamicArray<std::string> arr;
+        const std::string prefix(300, 'x');
+        for (int i(0); i != 500; ++i)
+        {
+            arr.insert_last(prefix + std::string(static_cast<size_t>(i % 7), 'y'));
+            arr.insert_last(std::string(static_cast<size_t>(i), 'a'));
+            arr.insert_last(std::string(1, static_cast<char>(128 + i % 100)) + "z");
+            arr.insert_last(std::string());
+        }
+        dsaa::DynamicArray<std::string> expected(arr);
+        std::sort(expected.begin(), expected.end());
+
+        dsaa::msd_radix_sort(arr.begin(), arr.end());
+
+        REQUIRE(std::equal(arr.begin(), arr.end(), expected.begin(), expected.end()));
+    }
+
+    SECTION("Records by a byte vector key.")
+    {
+        using Record = std::pair<std::vector<unsigned char>, int>;
+        const dsaa::DynamicArray<std::string> names(random_strings(3000, 6, 'z'));
+        std::vector<Record> arr;
+        for (size_t i(0); i != names.size(); ++i)
+            arr.emplace_back(std::vector<unsigned char>(names[i].begin(), names[i].end()), static_cast<int>(i));
+
+        dsaa::msd_radix_sort(arr.begin(), arr.end(), &Record::first);
+
+        REQUIRE(std::is_sorted(arr.begin(), arr.end(), [](const Record &p_lhs, const Record &p_rhs)
+                               { return p_lhs.first < p_rhs.first; }));
+    }
+}
+
+namespace
+{
+    enum class Level : uint8_t
+    {
+        debug,
+        info,
+        warning,
+        error
+    };
+
+    struct LogEntry
+    {
+        Level level;
+        int sequence;
+    };
+}
+
+TEST_CASE("Test counting_sort_by_key.", "[ParallelSort]")
+{
+    SECTION("Stable for every thread count and grain size.")
+    {
+        dsaa::DynamicArray<int> levels(dsaa::random::random_range_ints<int>(30000, 0, 3));
+        dsaa::DynamicArray<LogEntry> source;
+        for (size_t i(0); i != levels.size(); ++i)
+            source.insert_last(LogEntry{static_cast<Level>(levels[i]), static_cast<int>(i)});
+        dsaa::DynamicArray<LogEntry> expected(source);
+        std::stable_sort(expected.begin(), expected.end(), [](const LogEntry &p_lhs, const LogEntry &p_rhs)
+                         { return p_lhs.level < p_rhs.level; });
+
+        for (size_t thread_count : {1, 2, 3, 4})
+            for (size_t grain_size : {0, 1000, 100000})
+            {
+                dsaa::DynamicArray<LogEntry> arr(source.size(), dsaa::default_init);
+                dsaa::ParallelSortOptions options;
+                options.thread_count = thread_count;
+                options.grain_size = grain_size;
+
+                auto last(dsaa::counting_sort_by_key(source.begin(), source.end(), arr.begin(), &LogEntry::level, 4, options));
+
+                REQUIRE(last == arr.end());
+                REQUIRE(std::equal(arr.begin(), arr.end(), expected.begin(), expected.end(), [](const LogEntry &p_lhs, const LogEntry &p_rhs)
+                                   { return p_lhs.level == p_rhs.level && p_lhs.sequence == p_rhs.sequence; }));
+            }
+    }
+
+    SECTION("Small and empty sequences, keys past the inline table.")
+    {
+        for (size_t arr_size(0); arr_size != 50; ++arr_size)
+        {
+            dsaa::DynamicArray<int> source(dsaa::random::random_range_ints<int>(arr_size, 0, 999));
+            dsaa::DynamicArray<int> arr(arr_size, dsaa::default_init), expected(source);
+            std::sort(expected.begin(), expected.end());
+
+            dsaa::counting_sort_by_key(source.begin(), source.end(), arr.begin(), dsaa::identity_key(), 1000);
+
+            REQUIRE(std::equal(arr.begin(), arr.end(), expected.begin(), expected.end()));
+        }
+    }
+
+    SECTION("Records are moved from a move iterator.")
+    {
+        std::vector<std::string> source{"b1", "a1", "c1", "a2", "b2"};
+        std::vector<std::string> arr(source.size());
+
+        dsaa::counting_sort_by_key(std::make_move_iterator(source.begin()), std::make_move_iterator(source.end()), arr.begin(), [](const std::string &p_value) noexcept
+                                   { return p_value[0] - 'a'; },
+                                   3);
+
+        REQUIRE(arr == std::vector<std::string>{"a1", "a2", "b1", "b2", "c1"});
+        REQUIRE(source[0].empty());
+    }
+
+#ifdef PARAM_CHECK
+    SECTION("Keys out of range are rejected.")
+    {
+        dsaa::DynamicArray<int> source{0, 1, 5, 2}, arr(4, dsaa::default_init);
+        dsaa::ParallelSortOptions options;
+        options.thread_count = 2;
+        options.grain_size = 1;
+
+        REQUIRE_THROWS_AS(dsaa::counting_sort_by_key(source.begin(), source.end(), arr.begin(), dsaa::identity_key(), 5), std::out_of_range);
+        REQUIRE_THROWS_AS(dsaa::counting_sort_by_key(source.begin(), source.end(), arr.begin(), dsaa::identity_key(), 5, options), std::out_of_range);
+    }
+#endif
+}
+
+TEST_CASE("Test bucket_sort.", "[ParallelSort]")
+{
+    SECTION("Skewed reals, every thread count and grain size.")
+    {
+        // Log-normal like: most values are small, a few are huge.
+        dsaa::DynamicArray<double> source(dsaa::random::random_range_reals<double>(50000, -3.0, 3.0));
+        for (double &value : source)
+            value = std::exp(value * value * value);
+        dsaa::DynamicArray<double> expected(source);
+        std::sort(expected.begin(), expected.end());
+
+        for (size_t thread_count : {1, 2, 4})
+            for (size_t grain_size : {0, 5000, 100000})
+            {
+                dsaa::DynamicArray<double> arr(source);
+                dsaa::ParallelSortOptions options;
+                options.thread_count = thread_count;
+                options.grain_size = grain_size;
+
+                dsaa::bucket_sort(arr.begin(), arr.end(), std::less<double>(), options);
+
+                REQUIRE(std::equal(arr.begin(), arr.end(), expected.begin(), expected.end()));
+            }
+    }
+
+    SECTION("Heavy duplicates and a single value.")
+    {
+        dsaa::DynamicArray<int> source(dsaa::random::random_range_ints<int>(30000, 0, 99));
+        for (int &value : source)
+            value = value < 90 ? 0 : value;
+        dsaa::DynamicArray<int> expected(source), arr(source);
+        std::sort(expected.begin(), expected.end(), std::greater<int>());
+
+        dsaa::bucket_sort(arr.begin(), arr.end(), std::greater<int>());
+
+        REQUIRE(std::equal(arr.begin(), arr.end(), expected.begin(), expected.end()));
+
+        dsaa::DynamicArray<double> same(20000, 1.0);
+        dsaa::bucket_sort(same.begin(), same.end());
+        REQUIRE(std::all_of(same.begin(), same.end(), [](double p_value)
+                            { return p_value == 1.0; }));
+    }
+
+    SECTION("Sizes around the threshold, elements are neither lost nor duplicated.")
+    {
+        for (size_t arr_size : {0, 1, 2, 1023, 1024, 1025, 4000})
+        {
+            dsaa::DynamicArray<int> param(dsaa::random::random_range_ints<int>(arr_size, -1000, 1000));
+            dsaa::DynamicArray<TestObject<int>> arr(param.begin(), param.end());
+            std::sort(param.begin(), param.end());
+
+            dsaa::bucket_sort(arr.begin(), arr.end());
+
+            for (size_t i(0); i != arr_size; ++i)
+                REQUIRE(arr[i] == TestObject<int>(param[i]));
+        }
+        REQUIRE(dsaa::TestObject::livecount == 0);
+    }
+
+    SECTION("Strings.")
+    {
+        const dsaa::DynamicArray<std::string> source(random_strings(10000, 5, 'f'));
+        std::vector<std::string> arr(source.begin(), source.end()), expected(arr);
+        std::sort(expected.begin(), expected.end());
+
+        dsaa::bucket_sort(arr.begin(), arr.end());
+
+        REQUIRE(arr == expected);
+    }
+}
+
+TEST_CASE("Test SplitterTree.", "[Generic]")
+{
+    SECTION("Every value is in the bucket the splitters define.")
+    {
+        for (size_t splitter_count : {1, 3, 7, 15, 255})
+        {
+            dsaa::DynamicArray<int> splitters(dsaa::random::random_range_ints<int>(splitter_count, -100, 100));
+            std::sort(splitters.begin(), splitters.end());
+            const dsaa::SplitterTree<int> classify(splitters.begin(), splitters.end());
+
+            REQUIRE(classify.bucket_count() == 2 * (splitter_count + 1));
+            for (int value(-102); value != 103; ++value)
+            {
+                const size_t bucket(classify(value)), greater(static_cast<size_t>(std::lower_bound(splitters.begin(), splitters.end(), value) - splitters.begin()));
+                REQUIRE(bucket / 2 == greater);
+                REQUIRE((bucket % 2 == 1) == (greater != splitter_count && splitters[greater] == value));
+            }
+        }
+    }
+
+    SECTION("Equal splitters and another order.")
+    {
+        const int splitters[] = {9, 5, 5, 5, 5, 2, 2};
+        const dsaa::SplitterTree<int, std::greater<int>> classify(std::begin(splitters), std::end(splitters), std::greater<int>());
+
+        REQUIRE(classify(10) == 0);
+        REQUIRE(classify(9) == 1);
+        REQUIRE(classify(7) == 2);
+        REQUIRE(classify(5) == 3);
+        REQUIRE(classify(3) == 10);
+        REQUIRE(classify(2) == 11);
+        REQUIRE(classify(-4) == 14);
+    }
+}
+
+TEST_CASE("Test sample_sort.", "[ParallelSort]")
+{
+    SECTION("Skewed reals, every thread count and grain size.")
+    {
+        dsaa::DynamicArray<double> source(dsaa::random::random_range_reals<double>(200000, -3.0, 3.0));
+        for (double &value : source)
+            value = std::exp(value * value * value);
+        dsaa::DynamicArray<double> expected(source);
+        std::sort(expected.begin(), expected.end());
+
+        for (size_t thread_count : {1, 2, 4})
+            for (size_t grain_size : {0, 20000, 500000})
+            {
+                dsaa::DynamicArray<double> arr(source);
+                dsaa::ParallelSortOptions options;
+                options.thread_count = thread_count;
+                options.grain_size = grain_size;
+
+                dsaa::sample_sort(arr.begin(), arr.end(), std::less<double>(), options);
+
+                REQUIRE(std::equal(arr.begin(), arr.end(), expected.begin(), expected.end()));
+            }
+    }
+
+    SECTION("Heavy duplicates, a few values and a single one.")
+    {
+        dsaa::DynamicArray<int> source(dsaa::random::random_range_ints<int>(100000, 0, 99));
+        for (int &value : source)
+            value = value < 90 ? 0 : value;
+        dsaa::DynamicArray<int> expected(source), arr(source);
+        std::sort(expected.begin(), expected.end(), std::greater<int>());
+
+        dsaa::sample_sort(arr.begin(), arr.end(), std::greater<int>());
+
+        REQUIRE(std::equal(arr.begin(), arr.end(), expected.begin(), expected.end()));
+
+        dsaa::DynamicArray<int> few(dsaa::random::random_range_ints<int>(50000, 0, 3));
+        expected = few;
+        std::sort(expected.begin(), expected.end());
+        dsaa::sample_sort(few.begin(), few.end());
+        REQUIRE(std::equal(few.begin(), few.end(), expected.begin(), expected.end()));
+
+        dsaa::DynamicArray<double> same(20000, 1.0);
+        dsaa::sample_sort(same.begin(), same.end());
+        REQUIRE(std::all_of(same.begin(), same.end(), [](double p_value)
+                            { return p_value == 1.0; }));
+    }
+
+    SECTION("Sizes around the threshold, elements are neither lost nor duplicated.")
+    {
+        for (size_t arr_size : {0, 1, 2, 4095, 4096, 4097, 9000, 70000})
+        {
+            dsaa::DynamicArray<int> param(dsaa::random::random_range_ints<int>(arr_size, -1000, 1000));
+            dsaa::DynamicArray<TestObject<int>> arr(param.begin(), param.end());
+            std::sort(param.begin(), param.end());
+
+            dsaa::sample_sort(arr.begin(), arr.end());
+
+            for (size_t i(0); i != arr_size; ++i)
+                REQUIRE(arr[i] == TestObject<int>(param[i]));
+        }
+        REQUIRE(dsaa::TestObject::livecount == 0);
+    }
+
+    SECTION("Strings.")
+    {
+        const dsaa::DynamicArray<std::string> source(random_strings(30000, 5, 'f'));
+        std::vector<std::string> arr(source.begin(), source.end()), expected(arr);
+        std::sort(expected.begin(), expected.end());
+
+        dsaa::sample_sort(arr.begin(), arr.end());
+
+        REQUIRE(arr == expected);
+    }
+}
+
+#endif // !DSAA_TEST_PARALLEL_SORT_H
@@ -0,0 +1,181 @@
+#ifndef DSAA_TEST_SIMD_SORT_H
+#define DSAA_TEST_SIMD_SORT_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "Catch2/Catch.hpp"
+#include "algorithms/SimdSort.h"
+#include "algorithms/Generic.h"
+#include "arrays/DynamicArray.h"
+#include "algorithms/Random.h"
+
+namespace
+{
+    // Sorts p_values with simd_sort and its scalar kernel and compares both with std::sort.
+    template <typename T>
+    bool simd_sorts_like_std(const std::vector<T> &p_values)
+    {
+        std::vector<T> expected(p_values), simd(p_values), scalar(p_values);
+        std::sort(expected.begin(), expected.end());
+        dsaa::simd_sort(simd.begin(), simd.end());
+        dsaa::detail::scalar_simd_sort(scalar.data(), scalar.data() + scalar.size());
+        return expected == simd && expected == scalar;
+    }
+
+    // Checks that p_sorted is p_values with the NaNs behind a sorted prefix of every other value.
+    template <typename T>
+    bool nans_back_rest_sorted(const std::vector<T> &p_values, const std::vector<T> &p_sorted)
+    {
+        auto is_nan([](T p_value)
+                    { return std::isnan(p_value); });
+        std::vector<T> expected(p_values);
+        const auto expected_nans(std::partition(expected.begin(), expected.end(), [&is_nan](T p_value)
+                                                { return !is_nan(p_value); }));
+        std::sort(expected.begin(), expected_nans);
+        const auto nans(std::find_if(p_sorted.begin(), p_sorted.end(), is_nan));
+        return p_sorted.size() == expected.size() && std::all_of(nans, p_sorted.end(), is_nan) &&
+               std::equal(p_sorted.begin(), nans, expected.begin(), expected_nans);
+    }
+
+    template <typename T>
+    bool simd_moves_nans_back(const std::vector<T> &p_values)
+    {
+        std::vector<T> simd(p_values), scalar(p_values);
+        dsaa::simd_sort(simd.begin(), simd.end());
+        dsaa::detail::scalar_simd_sort(scalar.data(), scalar.data() + scalar.size());
+        return nans_back_rest_sorted(p_values, simd) && nans_back_rest_sorted(p_values, scalar);
+    }
+
+    template <typename T>
+    std::vector<T> random_values(size_t p_size, T p_first, T p_last)
+    {
+        dsaa::DynamicArray<T> values;
+        if constexpr (std::is_integral_v<T>)
+            values = dsaa::random::random_range_ints<T>(p_size, p_first, p_last);
+        else
+            values = dsaa::random::random_range_reals<T>(p_size, p_first, p_last);
+        return std::vector<T>(values.begin(), values.end());
+    }
+
+    template <typename T>
+    bool simd_sorts_shapes(T p_first, T p_last)
+    {
+        bool result(true);
+        // Every size around the vector widths and the small sort threshold.
+        for (size_t size(0); size != 100; ++size)
+        {
+            result = result && simd_sorts_like_std(random_values<T>(size, p_first, p_last));
+            result = result && simd_sorts_like_std(random_values<T>(size, T(0), T(3)));
+        }
+        for (size_t size : {1000u, 4099u, 100000u})
+        {
+            std::vector<T> values(random_values<T>(size, p_first, p_last));
+            result = result && simd_sorts_like_std(values);
+            std::sort(values.begin(), values.end());
+            result = result && simd_sorts_like_std(values);
+            std::reverse(values.begin(), values.end());
+            result = result && simd_sorts_like_std(values);
+            result = result && simd_sorts_like_std(std::vector<T>(size, p_last));
+            result = result && simd_sorts_like_std(random_values<T>(size, T(0), T(2)));
+        }
+        return result;
+    }
+}
+
+TEST_CASE("Test simd_sort.", "[SimdSort]")
+{
+    SECTION("int32_t.")
+    {
+        REQUIRE(simd_sorts_shapes<int32_t>(std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::max()));
+        REQUIRE(simd_sorts_shapes<int32_t>(-100, 100));
+    }
+
+    SECTION("int64_t.")
+    {
+        REQUIRE(simd_sorts_shapes<int64_t>(std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max()));
+        REQUIRE(simd_sorts_shapes<int64_t>(-100, 100));
+    }
+
+    SECTION("float.")
+    {
+        REQUIRE(simd_sorts_shapes<float>(-1e30f, 1e30f));
+    }
+
+    SECTION("double.")
+    {
+        REQUIRE(simd_sorts_shapes<double>(-1e300, 1e300));
+    }
+
+    SECTION("Infinities and extreme values.")
+    {
+        const float inf(std::numeric_limits<float>::infinity());
+        REQUIRE(simd_sorts_like_std<float>({inf, -inf, 0.0f, 1.0f, inf, std::numeric_limits<float>::max(), -inf, std::numeric_limits<float>::lowest(),
+                                            2.0f, inf, -1.0f, 0.5f, -inf, 3.0f, inf, 4.0f, -2.0f, 7.0f, inf}));
+        std::vector<int32_t> ints(random_values<int32_t>(50, -5, 5));
+        ints.insert(ints.end(), {std::numeric_limits<int32_t>::max(), std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::max()});
+        REQUIRE(simd_sorts_like_std(ints));
+    }
+
+    SECTION("NaNs go behind every other value.")
+    {
+        const float nan(std::numeric_limits<float>::quiet_NaN());
+        REQUIRE(simd_moves_nans_back<float>({5, 3, nan, 1, 4, 2, 8, 7, 6, 9, 0, 11, 10}));
+        REQUIRE(simd_moves_nans_back<float>({nan, nan, nan}));
+
+        for (size_t size : {7u, 16u, 200u, 5000u})
+        {
+            std::vector<float> floats(random_values<float>(size, -100.0f, 100.0f));
+            std::vector<double> doubles(random_values<double>(size, -100.0, 100.0));
+            // A NaN at both ends and in the middle, where the pivot is taken from.
+            for (size_t index : {size_t(0), size / 2, size - 1})
+            {
+                floats[index] = nan;
+                doubles[index] = std::numeric_limits<double>::quiet_NaN();
+            }
+            REQUIRE(simd_moves_nans_back(floats));
+            REQUIRE(simd_moves_nans_back(doubles));
+        }
+    }
+
+    SECTION("A dsaa::DynamicArray.")
+    {
+        dsaa::DynamicArray<double> arr(dsaa::random::random_range_reals<double>(5000, -1.0, 1.0));
+
+        dsaa::simd_sort(arr.begin(), arr.end());
+
+        REQUIRE(std::is_sorted(arr.begin(), arr.end()));
+    }
+
+    SECTION("The empty sequence.")
+    {
+        dsaa::DynamicArray<int32_t> arr;
+
+        dsaa::simd_sort(arr.begin(), arr.end());
+
+        REQUIRE(arr.empty());
+    }
+}
+
+TEST_CASE("Test branchless_lomuto_partition.", "[Generic]")
+{
+    for (size_t arr_size(1); arr_size != 200; ++arr_size)
+    {
+        dsaa::DynamicArray<int> arr(dsaa::random::random_range_ints<int>(arr_size, -20, 20));
+        const int pivot(arr[arr_size - 1]);
+
+        auto pivot_iter(dsaa::branchless_lomuto_partition(arr.begin(), arr.end()));
+
+        REQUIRE(*pivot_iter == pivot);
+        REQUIRE(std::all_of(arr.begin(), pivot_iter, [pivot](int value)
+                            { return value < pivot; }));
+        REQUIRE(std::all_of(pivot_iter, arr.end(), [pivot](int value)
+                            { return !(value < pivot); }));
+    }
+}
+
+#endif // !DSAA_TEST_SIMD_SORT_H
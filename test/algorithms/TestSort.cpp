@@ -1,6 +1,13 @@
 #ifndef DSAA_TEST_SORT_H
 #define DSAA_TEST_SORT_H
 
+#include <cstdlib>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "Catch2/Catch.hpp"
 #include "algorithms/Sort.h"
 #include "arrays/DynamicArray.h"
@@ -382,6 +389,17 @@ TEST_CASE("Test insertion_sort.", "[Sort]")
 
         REQUIRE(dsaa::is_sorted(arr.begin(), arr.end(), std::less_equal<TestObject<int>>()));
     }
+
+    SECTION("A key that belongs right after the first element.")
+    {
+        dsaa::DynamicArray<int> arr({1, 3, 2});
+
+        dsaa::insertion_sort(arr.begin(), arr.end());
+
+        REQUIRE(arr[0] == 1);
+        REQUIRE(arr[1] == 2);
+        REQUIRE(arr[2] == 3);
+    }
 }
 
 TEST_CASE("Test merge_sort.", "[Sort]")
@@ -510,6 +528,169 @@ TEST_CASE("Test merge_sort.", "[Sort]")
     }
 }
 
+TEST_CASE("Test merge and buffered_merge.", "[Sort]")
+{
+    using Pair = std::pair<int, int>;
+    auto by_key([](const Pair &p_lhs, const Pair &p_rhs)
+                { return p_lhs.first < p_rhs.first; });
+
+    dsaa::DynamicArray<Pair> arr;
+    for (int i(0); i != 50; ++i)
+        arr.insert_last(Pair(i / 5, i));
+    for (int i(0); i != 30; ++i)
+        arr.insert_last(Pair(i / 2, 100 + i));
+    dsaa::DynamicArray<Pair> expected(arr);
+    std::stable_sort(expected.begin(), expected.end(), by_key);
+
+    SECTION("merge is stable.")
+    {
+        dsaa::merge(arr.begin(), arr.begin() + 50, arr.end(), by_key);
+
+        REQUIRE(std::equal(arr.begin(), arr.end(), expected.begin(), expected.end()));
+    }
+
+    SECTION("buffered_merge needs room for the left run only.")
+    {
+        dsaa::DynamicArray<Pair> buffer(50);
+
+        dsaa::buffered_merge(arr.begin(), arr.begin() + 50, arr.end(), buffer.begin(), by_key);
+
+        REQUIRE(std::equal(arr.begin(), arr.end(), expected.begin(), expected.end()));
+    }
+
+    SECTION("Empty runs.")
+    {
+        dsaa::DynamicArray<Pair> buffer(1);
+
+        dsaa::buffered_merge(arr.begin(), arr.begin(), arr.begin() + 50, buffer.begin(), by_key);
+        dsaa::merge(arr.begin(), arr.begin() + 50, arr.begin() + 50, by_key);
+
+        REQUIRE(std::equal(arr.begin(), arr.begin() + 50, expected.begin(), expected.begin() + 50, [](const Pair &p_lhs, const Pair &p_rhs)
+                           { return p_lhs.second == p_rhs.second || p_lhs.second < 50; }));
+    }
+}
+
+TEST_CASE("Test buffered_merge_sort and bottom_up_merge_sort.", "[Sort]")
+{
+    using Pair = std::pair<int, int>;
+    auto by_key([](const Pair &p_lhs, const Pair &p_rhs)
+                { return p_lhs.first < p_rhs.first; });
+
+    SECTION("Stable on every size, with an allocated or a caller supplied buffer.")
+    {
+        dsaa::DynamicArray<Pair> buffer(3000);
+        for (size_t arr_size : {0, 1, 2, 15, 16, 17, 33, 100, 1000, 2999})
+        {
+            dsaa::DynamicArray<int> keys(dsaa::random::random_range_ints<int>(arr_size, 0, 20));
+            dsaa::DynamicArray<Pair> source;
+            for (size_t i(0); i != arr_size; ++i)
+                source.insert_last(Pair(keys[i], static_cast<int>(i)));
+            dsaa::DynamicArray<Pair> expected(source);
+            std::stable_sort(expected.begin(), expected.end(), by_key);
+
+            dsaa::DynamicArray<Pair> top_down(source), buffered(source), bottom_up(source), buffered_bottom_up(source);
+            dsaa::merge_sort(top_down.begin(), top_down.end(), by_key);
+            dsaa::buffered_merge_sort(buffered.begin(), buffered.end(), buffer.begin(), by_key);
+            dsaa::bottom_up_merge_sort(bottom_up.begin(), bottom_up.end(), by_key);
+            dsaa::buffered_bottom_up_merge_sort(buffered_bottom_up.begin(), buffered_bottom_up.end(), buffer.begin(), by_key);
+
+            REQUIRE(std::equal(top_down.begin(), top_down.end(), expected.begin(), expected.end()));
+            REQUIRE(std::equal(buffered.begin(), buffered.end(), expected.begin(), expected.end()));
+            REQUIRE(std::equal(bottom_up.begin(), bottom_up.end(), expected.begin(), expected.end()));
+            REQUIRE(std::equal(buffered_bottom_up.begin(), buffered_bottom_up.end(), expected.begin(), expected.end()));
+        }
+    }
+
+    SECTION("Objects are moved, not copied or lost.")
+    {
+        {
+            dsaa::DynamicArray<int> param(dsaa::random::random_range_ints<int>(1000, -100, 100));
+            dsaa::DynamicArray<TestObject<int>> arr(param.begin(), param.end());
+            dsaa::DynamicArray<TestObject<int>> arr2(arr);
+
+            dsaa::bottom_up_merge_sort(arr.begin(), arr.end());
+            dsaa::merge_sort(arr2.begin(), arr2.end(), std::greater<TestObject<int>>());
+
+            REQUIRE(dsaa::is_sorted(arr.begin(), arr.end(), std::less_equal<TestObject<int>>()));
+            REQUIRE(dsaa::is_sorted(arr2.begin(), arr2.end(), std::greater_equal<TestObject<int>>()));
+            REQUIRE(dsaa::TestObject::livecount == 2000);
+        }
+        REQUIRE(dsaa::TestObject::livecount == 0);
+    }
+}
+
+TEST_CASE("Test tim_sort.", "[Sort]")
+{
+    using Pair = std::pair<int, int>;
+    auto by_key([](const Pair &p_lhs, const Pair &p_rhs)
+                { return p_lhs.first < p_rhs.first; });
+    auto check([&by_key](dsaa::DynamicArray<int> p_keys)
+               {
+                   dsaa::DynamicArray<Pair> arr;
+                   for (size_t i(0); i != p_keys.size(); ++i)
+                       arr.insert_last(Pair(p_keys[i], static_cast<int>(i)));
+                   dsaa::DynamicArray<Pair> expected(arr);
+                   std::stable_sort(expected.begin(), expected.end(), by_key);
+
+                   dsaa::tim_sort(arr.begin(), arr.end(), by_key);
+
+                   REQUIRE(std::equal(arr.begin(), arr.end(), expected.begin(), expected.end())); });
+
+    SECTION("Random sequences of every small size and a few large ones, with many equal keys.")
+    {
+        for (size_t arr_size(0); arr_size != 140; ++arr_size)
+            check(dsaa::random::random_range_ints<int>(arr_size, 0, 10));
+        for (size_t arr_size : {1000, 4097, 50000})
+            check(dsaa::random::random_range_ints<int>(arr_size, 0, static_cast<int>(arr_size) / 4));
+    }
+
+    SECTION("Sorted, reversed, with equal keys in descending runs, and nearly sorted.")
+    {
+        const int arr_size(20000);
+        dsaa::DynamicArray<int> sorted(arr_size, dsaa::default_init), reversed(arr_size, dsaa::default_init);
+        dsaa::DynamicArray<int> steps(arr_size, dsaa::default_init), nearly(arr_size, dsaa::default_init);
+        for (int i(0); i != arr_size; ++i)
+        {
+            sorted[i] = i;
+            reversed[i] = arr_size - i;
+            steps[i] = (arr_size - i) / 3;
+            nearly[i] = i;
+        }
+        dsaa::DynamicArray<int> swaps(dsaa::random::random_range_ints<int>(200, 0, arr_size - 10));
+        for (int position : swaps)
+            std::swap(nearly[position], nearly[position + 7]);
+
+        check(sorted);
+        check(reversed);
+        check(steps);
+        check(nearly);
+    }
+
+    SECTION("Runs that make galloping pay off.")
+    {
+        // Interleaved blocks of two ascending runs, so merges switch between galloping and one at a time.
+        dsaa::DynamicArray<int> keys;
+        for (int block_size : {1, 50, 3, 200, 1, 1, 1000, 7})
+            for (int i(0); i != 2000; ++i)
+                keys.insert_last((i / block_size) % 2 ? i : i + 100000);
+        check(keys);
+    }
+
+    SECTION("Objects are moved, not copied or lost.")
+    {
+        {
+            dsaa::DynamicArray<int> param(dsaa::random::random_range_ints<int>(3000, -100, 100));
+            dsaa::DynamicArray<TestObject<int>> arr(param.begin(), param.end());
+
+            dsaa::tim_sort(arr.begin(), arr.end(), std::greater<TestObject<int>>());
+
+            REQUIRE(dsaa::is_sorted(arr.begin(), arr.end(), std::greater_equal<TestObject<int>>()));
+            REQUIRE(dsaa::TestObject::livecount == 3000);
+        }
+        REQUIRE(dsaa::TestObject::livecount == 0);
+    }
+}
+
 TEST_CASE("Test sort_heap.", "[Sort]")
 {
     SECTION("Test sort_heap using std::less_equal as comparer.")
@@ -1811,6 +1992,158 @@ TEST_CASE("Test randomized_tail_hoare_quick_sort.", "[Sort]")
     }
 }
 
+TEST_CASE("Test sort.", "[Sort]")
+{
+    SECTION("Sequences of every small size.")
+    {
+        for (size_t arr_size(0); arr_size != 40; ++arr_size)
+        {
+            dsaa::DynamicArray<int> param(dsaa::random::random_range_ints<int>(arr_size, -10, 10));
+            dsaa::DynamicArray<TestObject<int>> arr(param.begin(), param.end());
+
+            dsaa::sort(arr.begin(), arr.end());
+
+            REQUIRE(dsaa::is_sorted(arr.begin(), arr.end(), std::less_equal<TestObject<int>>()));
+        }
+    }
+
+    SECTION("Sorted, reversed, organ-pipe and many-duplicates sequences.")
+    {
+        const int arr_size(5000);
+        dsaa::DynamicArray<int> sorted(arr_size, dsaa::default_init), reversed(arr_size, dsaa::default_init);
+        dsaa::DynamicArray<int> organ_pipe(arr_size, dsaa::default_init), duplicates(dsaa::random::random_range_ints<int>(arr_size, 0, 3));
+        for (int i(0); i != arr_size; ++i)
+        {
+            sorted[i] = i;
+            reversed[i] = arr_size - i;
+            organ_pipe[i] = i < arr_size / 2 ? i : arr_size - i;
+        }
+
+        for (auto *arr : {&sorted, &reversed, &organ_pipe, &duplicates})
+        {
+            dsaa::sort(arr->begin(), arr->end());
+            REQUIRE(dsaa::is_sorted(arr->begin(), arr->end()));
+        }
+    }
+
+    SECTION("A large random sequence with a custom comparator.")
+    {
+        dsaa::DynamicArray<double> arr(dsaa::random::random_range_reals<double>(100000, -1.0, 1.0));
+        dsaa::DynamicArray<double> expected(arr);
+        std::sort(expected.begin(), expected.end(), std::greater<double>());
+
+        dsaa::sort(arr.begin(), arr.end(), std::greater<double>());
+
+        for (size_t i(0); i != arr.size(); ++i)
+            REQUIRE(arr[i] == expected[i]);
+    }
+
+    SECTION("The heap sort fallback.")
+    {
+        dsaa::DynamicArray<int> param(dsaa::random::random_range_ints<int>(1000, -100, 100));
+        dsaa::DynamicArray<TestObject<int>> arr(param.begin(), param.end());
+
+        dsaa::detail::introsort_loop(arr.begin(), arr.end(), 0, std::less<TestObject<int>>());
+
+        REQUIRE(dsaa::is_sorted(arr.begin(), arr.end(), std::less_equal<TestObject<int>>()));
+    }
+}
+
+TEST_CASE("Test lsd_radix_sort.", "[Sort]")
+{
+    SECTION("Signed and unsigned integers of every width.")
+    {
+        auto check([](auto p_zero, auto p_lo, auto p_hi)
+                   {
+                       using Int = decltype(p_zero);
+                       for (size_t arr_size : {0, 1, 2, 50, 1000})
+                       {
+                           dsaa::DynamicArray<Int> arr;
+                           for (auto value : dsaa::random::random_range_ints<long long>(arr_size, p_lo, p_hi))
+                               arr.insert_last(static_cast<Int>(value));
+                           dsaa::DynamicArray<Int> expected(arr);
+                           std::sort(expected.begin(), expected.end());
+
+                           dsaa::lsd_radix_sort(arr.begin(), arr.end());
+
+                           REQUIRE(std::equal(arr.begin(), arr.end(), expected.begin(), expected.end()));
+                       } });
+
+        check(int8_t(), -128, 127);
+        check(uint8_t(), 0, 255);
+        check(int16_t(), -30000, 30000);
+        check(uint16_t(), 0, 65535);
+        check(int32_t(), -2000000000, 2000000000);
+        check(uint32_t(), 0, 4000000000);
+        check(int64_t(), std::numeric_limits<long long>::min(), std::numeric_limits<long long>::max());
+        check(uint64_t(), 0, std::numeric_limits<long long>::max());
+    }
+
+    SECTION("8, 11 and 16 bit digits.")
+    {
+        dsaa::DynamicArray<long long> source(dsaa::random::random_range_ints<long long>(5000, std::numeric_limits<long long>::min(), std::numeric_limits<long long>::max()));
+        dsaa::DynamicArray<long long> expected(source);
+        std::sort(expected.begin(), expected.end());
+
+        dsaa::DynamicArray<long long> arr8(source), arr11(source), arr16(source);
+        dsaa::lsd_radix_sort<8>(arr8.begin(), arr8.end());
+        dsaa::lsd_radix_sort<11>(arr11.begin(), arr11.end());
+        dsaa::lsd_radix_sort<16>(arr16.begin(), arr16.end());
+
+        REQUIRE(std::equal(arr8.begin(), arr8.end(), expected.begin(), expected.end()));
+        REQUIRE(std::equal(arr11.begin(), arr11.end(), expected.begin(), expected.end()));
+        REQUIRE(std::equal(arr16.begin(), arr16.end(), expected.begin(), expected.end()));
+    }
+
+    SECTION("Floats and doubles, negatives and infinities included.")
+    {
+        dsaa::DynamicArray<double> doubles(dsaa::random::random_range_reals<double>(3000, -1e6, 1e6));
+        for (double special : {0.0, -0.0, -std::numeric_limits<double>::infinity(), std::numeric_limits<double>::infinity(),
+                               std::numeric_limits<double>::min(), -std::numeric_limits<double>::max()})
+            doubles.insert_last(special);
+        dsaa::DynamicArray<float> floats(doubles.begin(), doubles.end());
+
+        dsaa::lsd_radix_sort(doubles.begin(), doubles.end());
+        dsaa::lsd_radix_sort<11>(floats.begin(), floats.end());
+
+        REQUIRE(dsaa::is_sorted(doubles.begin(), doubles.end()));
+        REQUIRE(dsaa::is_sorted(floats.begin(), floats.end()));
+        REQUIRE(doubles[0] == -std::numeric_limits<double>::infinity());
+        REQUIRE(doubles[doubles.size() - 1] == std::numeric_limits<double>::infinity());
+    }
+
+    SECTION("Records by a key field are sorted stably.")
+    {
+        using Pair = std::pair<int, int>;
+        dsaa::DynamicArray<int> keys(dsaa::random::random_range_ints<int>(5000, -50, 50));
+        dsaa::DynamicArray<Pair> arr;
+        for (size_t i(0); i != keys.size(); ++i)
+            arr.insert_last(Pair(keys[i], static_cast<int>(i)));
+        dsaa::DynamicArray<Pair> expected(arr);
+        std::stable_sort(expected.begin(), expected.end(), [](const Pair &p_lhs, const Pair &p_rhs)
+                         { return p_lhs.first < p_rhs.first; });
+
+        dsaa::lsd_radix_sort(arr.begin(), arr.end(), &Pair::first);
+
+        REQUIRE(std::equal(arr.begin(), arr.end(), expected.begin(), expected.end()));
+    }
+
+    SECTION("Objects are moved, not lost, when passes are skipped.")
+    {
+        {
+            dsaa::DynamicArray<int> param(dsaa::random::random_range_ints<int>(1000, 0, 300));
+            dsaa::DynamicArray<TestObject<int>> arr(param.begin(), param.end());
+
+            dsaa::lsd_radix_sort(arr.begin(), arr.end(), [](const TestObject<int> &p_object) noexcept
+                                 { return p_object.value(); });
+
+            REQUIRE(dsaa::is_sorted(arr.begin(), arr.end(), std::less_equal<TestObject<int>>()));
+            REQUIRE(dsaa::TestObject::livecount == 1000);
+        }
+        REQUIRE(dsaa::TestObject::livecount == 0);
+    }
+}
+
 TEST_CASE("Test counting_sort.", "[Sort]")
 {
     SECTION("An ordinary sequence.")
@@ -2265,6 +2598,26 @@ TEST_CASE("Test radix_sort.", "[Sort]")
             REQUIRE(*arr2_iter == *arr_iter);
     }
 
+    SECTION("All elements zero, no pass runs.")
+    {
+        dsaa::DynamicArray<int> arr(size_t(1000), 0);
+        dsaa::radix_sort(arr.begin(), arr.end(), std::less<int>());
+        REQUIRE(std::all_of(arr.begin(), arr.end(), [](int p_value)
+                            { return p_value == 0; }));
+
+        dsaa::DynamicArray<int> descending(size_t(1000), 0);
+        dsaa::radix_sort(descending.begin(), descending.end(), std::greater<int>());
+        REQUIRE(std::all_of(descending.begin(), descending.end(), [](int p_value)
+                            { return p_value == 0; }));
+
+        dsaa::DynamicArray<int> single(size_t(1), 0);
+        dsaa::radix_sort(single.begin(), single.end(), std::less<int>());
+        REQUIRE(single[0] == 0);
+        single[0] = 7;
+        dsaa::radix_sort(single.begin(), single.end(), std::less<int>());
+        REQUIRE(single[0] == 7);
+    }
+
     SECTION("Difference element at begining.")
     {
         size_t arr_size(267);
@@ -2520,6 +2873,215 @@ TEST_CASE("Test radix_sort.", "[Sort]")
 }
 
 
+TEST_CASE("Test bucket_sort_uniform_distribution.", "[Sort]")
+{
+    SECTION("An ordinary sequence.")
+    {
+        size_t arr_size(245);
+        dsaa::DynamicArray<double> arr(dsaa::random::random_range_reals<double>(arr_size, 0.0, 0.999));
+
+        dsaa::DynamicArray<double> arr2(arr);
+
+        dsaa::bucket_sort_uniform_distribution(arr.begin(), arr.end(), std::less<double>());
+        REQUIRE(dsaa::is_sorted(arr.begin(), arr.end(), std::less_equal<double>()));
+
+        std::sort(arr2.begin(), arr2.end(), std::less<double>());
+        auto arr_iter(arr.begin());
+        auto arr2_iter(arr2.begin());
+        for (; arr2.end() != arr2_iter; ++arr2_iter, ++arr_iter)
+            REQUIRE(*arr2_iter == *arr_iter);
+    }
+
+    SECTION("Descending order with empty buckets in between.")
+    {
+        dsaa::DynamicArray<double> arr({0.1, 0.85, 0.3, 0.05, 0.9, 0.35, 0.6, 0.12});
+
+        dsaa::bucket_sort_uniform_distribution(arr.begin(), arr.end(), std::greater<double>());
+        REQUIRE(dsaa::is_sorted(arr.begin(), arr.end(), std::greater_equal<double>()));
+        REQUIRE(arr[0] == 0.9);
+        REQUIRE(arr[7] == 0.05);
+    }
+
+    SECTION("Crowded buckets spill to the heap.")
+    {
+        size_t arr_size(200);
+        dsaa::DynamicArray<double> arr(dsaa::random::random_range_reals<double>(arr_size, 0.0, 0.05));
+
+        dsaa::bucket_sort_uniform_distribution(arr.begin(), arr.end(), std::greater<double>());
+        REQUIRE(dsaa::is_sorted(arr.begin(), arr.end(), std::greater_equal<double>()));
+    }
+
+    SECTION("Both ends of the range.")
+    {
+        dsaa::DynamicArray<double> arr{1.0, 0.5, 0.0, 1.0, 0.25};
+
+        dsaa::bucket_sort_uniform_distribution(arr.begin(), arr.end(), std::less<double>());
+        REQUIRE(dsaa::is_sorted(arr.begin(), arr.end(), std::less_equal<double>()));
+        REQUIRE(arr[4] == 1.0);
+    }
+}
+
+
+TEST_CASE("Test sort_by_key.", "[Sort]")
+{
+    SECTION("Integer keys are computed once and sorted stably.")
+    {
+        for (size_t arr_size : {0, 1, 2, 50, 1000})
+        {
+            dsaa::DynamicArray<int> param(dsaa::random::random_range_ints<int>(arr_size, -1000, 1000));
+            dsaa::DynamicArray<TestObject<int>> arr(param.begin(), param.end());
+            size_t calls(0);
+            auto key([&calls](const TestObject<int> &p_elem) noexcept
+                     { ++calls; return p_elem.value() / 10; });
+
+            dsaa::sort_by_key(arr.begin(), arr.end(), key);
+
+            std::stable_sort(param.begin(), param.end(), [](int p_lhs, int p_rhs)
+                             { return p_lhs / 10 < p_rhs / 10; });
+            REQUIRE(calls == (arr_size < 2 ? 0 : arr_size));
+            for (size_t i(0); i != arr_size; ++i)
+                REQUIRE(arr[i] == TestObject<int>(param[i]));
+        }
+    }
+
+    SECTION("String keys with a comparator.")
+    {
+        dsaa::DynamicArray<int> param(dsaa::random::random_range_ints<int>(500, 0, 300));
+        dsaa::DynamicArray<int> arr(param);
+        auto key([](int p_elem) noexcept
+                 { return std::to_string(p_elem % 100); });
+
+        dsaa::sort_by_key(arr.begin(), arr.end(), key, std::greater<std::string>());
+
+        std::stable_sort(param.begin(), param.end(), [&key](int p_lhs, int p_rhs)
+                         { return key(p_lhs) > key(p_rhs); });
+        REQUIRE(std::equal(arr.begin(), arr.end(), param.begin()));
+    }
+
+    SECTION("A member as key.")
+    {
+        std::vector<std::pair<std::string, int>> arr{{"c", 3}, {"a", 1}, {"b", 1}, {"d", -2}};
+
+        dsaa::sort_by_key(arr.begin(), arr.end(), &std::pair<std::string, int>::second);
+
+        REQUIRE(arr[0].first == "d");
+        REQUIRE(arr[1].first == "a");
+        REQUIRE(arr[2].first == "b");
+        REQUIRE(arr[3].first == "c");
+    }
+}
+
+TEST_CASE("Test nth_element.", "[Sort]")
+{
+    SECTION("Every position of small and large sequences.")
+    {
+        for (size_t arr_size : {1, 2, 17, 100, 1000})
+            for (size_t nth(0); nth < arr_size; nth += 1 + arr_size / 20)
+            {
+                dsaa::DynamicArray<int> arr(dsaa::random::random_range_ints<int>(arr_size, -50, 50));
+                dsaa::DynamicArray<int> sorted(arr);
+                std::sort(sorted.begin(), sorted.end());
+
+                auto nth_iter(dsaa::nth_element(arr.begin(), arr.begin() + nth, arr.end()));
+
+                REQUIRE(nth_iter == arr.begin() + nth);
+                REQUIRE(*nth_iter == sorted[nth]);
+                REQUIRE(std::all_of(arr.begin(), nth_iter, [&nth_iter](int value)
+                                    { return !(*nth_iter < value); }));
+                REQUIRE(std::all_of(nth_iter, arr.end(), [&nth_iter](int value)
+                                    { return !(value < *nth_iter); }));
+            }
+    }
+
+    SECTION("Two interleaved halves, with a comparator.")
+    {
+        const int arr_size(10000);
+        dsaa::DynamicArray<int> arr(arr_size, dsaa::default_init);
+        for (int i(0); i != arr_size; ++i)
+            arr[i] = i < arr_size / 2 ? 2 * i + 1 : 2 * (i - arr_size / 2);
+
+        dsaa::nth_element(arr.begin(), arr.begin() + arr_size / 2, arr.end(), std::greater<int>());
+
+        REQUIRE(arr[arr_size / 2] == arr_size / 2 - 1);
+    }
+
+    SECTION("p_nth is p_last.")
+    {
+        dsaa::DynamicArray<TestObject<int>> arr({3, 1, 2});
+
+        REQUIRE(dsaa::nth_element(arr.begin(), arr.end(), arr.end()) == arr.end());
+    }
+}
+
+TEST_CASE("Test partial_sort.", "[Sort]")
+{
+    for (size_t arr_size : {0, 1, 5, 100, 2000})
+        for (size_t middle : {size_t(0), size_t(1), arr_size / 3, arr_size})
+        {
+            if (arr_size < middle)
+                continue;
+            dsaa::DynamicArray<int> param(dsaa::random::random_range_ints<int>(arr_size, -100, 100));
+            dsaa::DynamicArray<TestObject<int>> arr(param.begin(), param.end());
+            std::sort(param.begin(), param.end(), std::greater<int>());
+
+            auto middle_iter(dsaa::partial_sort(arr.begin(), arr.begin() + middle, arr.end(), std::greater<TestObject<int>>()));
+
+            REQUIRE(middle_iter == arr.begin() + middle);
+            for (size_t i(0); i != middle; ++i)
+                REQUIRE(arr[i] == TestObject<int>(param[i]));
+        }
+}
+
+TEST_CASE("Test top_k.", "[Sort]")
+{
+    SECTION("The greatest elements of a sequence, the greatest first.")
+    {
+        dsaa::DynamicArray<int> arr(dsaa::random::random_range_ints<int>(5000, 0, 1000));
+        dsaa::DynamicArray<int> sorted(arr);
+        std::sort(sorted.begin(), sorted.end(), std::greater<int>());
+
+        for (size_t k : {0, 1, 100, 4999, 5000, 6000})
+        {
+            dsaa::DynamicArray<int> top(dsaa::top_k(arr.begin(), arr.end(), k));
+
+            REQUIRE(top.size() == std::min<size_t>(k, arr.size()));
+            REQUIRE(std::equal(top.begin(), top.end(), sorted.begin()));
+        }
+    }
+
+    SECTION("A single pass over an input range, with a comparator.")
+    {
+        std::istringstream stream("5 3 9 1 7 3 8");
+
+        dsaa::DynamicArray<int> top(dsaa::top_k(std::istream_iterator<int>(stream), std::istream_iterator<int>(), 3, std::greater<int>()));
+
+        REQUIRE(top.size() == 3);
+        REQUIRE(top[0] == 1);
+        REQUIRE(top[1] == 3);
+        REQUIRE(top[2] == 3);
+    }
+
+    SECTION("A capturing comparator orders the heap.")
+    {
+        dsaa::DynamicArray<int> arr(dsaa::random::random_range_ints<int>(3000, -1000, 1000));
+        const int target(dsaa::random::random_range_int<int>(-1000, 1000));
+        // The greatest elements are the ones closest to target.
+        auto closer([target](int p_lhs, int p_rhs)
+                    { return std::make_pair(std::abs(p_rhs - target), p_rhs) < std::make_pair(std::abs(p_lhs - target), p_lhs); });
+        dsaa::DynamicArray<int> sorted(arr);
+        std::sort(sorted.begin(), sorted.end(), [&closer](int p_lhs, int p_rhs)
+                  { return closer(p_rhs, p_lhs); });
+
+        for (size_t k : {1, 10, 500})
+        {
+            dsaa::DynamicArray<int> top(dsaa::top_k(arr.begin(), arr.end(), k, closer));
+
+            REQUIRE(top.size() == k);
+            REQUIRE(std::equal(top.begin(), top.end(), sorted.begin()));
+        }
+    }
+}
+
 #include "MinHeap.h"
 TEST_CASE("Test dsaa::heap_property for dsaa::MinHeap.", "[dsaa::heap_property]")
 {
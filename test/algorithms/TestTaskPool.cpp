@@ -0,0 +1,74 @@
+#ifndef DSAA_TEST_TASK_POOL_H
+#define DSAA_TEST_TASK_POOL_H
+
+#include <atomic>
+#include <stdexcept>
+
+#include "Catch2/Catch.hpp"
+#include "algorithms/TaskPool.h"
+
+TEST_CASE("Test TaskPool and TaskGroup.", "[TaskPool]")
+{
+    SECTION("Thread count.")
+    {
+        dsaa::TaskPool pool(3);
+        REQUIRE(pool.thread_count() == 3);
+
+        dsaa::TaskPool single(1);
+        REQUIRE(single.thread_count() == 1);
+        REQUIRE(!single.try_run_one());
+    }
+
+    SECTION("Every task runs once.")
+    {
+        for (size_t thread_count : {1, 2, 4})
+        {
+            dsaa::TaskPool pool(thread_count);
+            std::atomic<int> sum(0);
+            dsaa::TaskGroup group(pool);
+            for (int i(1); i <= 1000; ++i)
+                group.run([&sum, i]()
+                          { sum += i; });
+            group.wait();
+
+            REQUIRE(sum == 500500);
+        }
+    }
+
+    SECTION("Nested groups.")
+    {
+        dsaa::TaskPool pool(4);
+        std::atomic<int> count(0);
+        dsaa::TaskGroup group(pool);
+        for (int i(0); i != 16; ++i)
+            group.run([&pool, &count]()
+                      {
+                          dsaa::TaskGroup inner(pool);
+                          for (int j(0); j != 16; ++j)
+                              inner.run([&count]()
+                                        { ++count; });
+                          inner.wait(); });
+        group.wait();
+
+        REQUIRE(count == 256);
+    }
+
+    SECTION("The first exception is rethrown by wait.")
+    {
+        dsaa::TaskPool pool(2);
+        std::atomic<int> count(0);
+        dsaa::TaskGroup group(pool);
+        for (int i(0); i != 10; ++i)
+            group.run([&count, i]()
+                      {
+                          ++count;
+                          if (i == 5)
+                              throw std::runtime_error("task"); });
+
+        REQUIRE_THROWS_AS(group.wait(), std::runtime_error);
+        REQUIRE(count == 10);
+        REQUIRE_NOTHROW(group.wait());
+    }
+}
+
+#endif // !DSAA_TEST_TASK_POOL_H
@@ -5,11 +5,24 @@
 #include "arrays/DynamicArray.h"
 #include "algorithms/Random.h"
 #include "test/TestObject.h"
+#include "lists/SinglyLinkList.h"
+#include "lists/DoublyLinkList.h"
+#include "Queue.h"
 
 using iterator = dsaa::DynamicArray<TestObject<int>>::iterator;
 using const_iterator = dsaa::DynamicArray<TestObject<int>>::const_iterator;
 using reserve_iterator = dsaa::DynamicArray<TestObject<int>>::reverse_iterator;
 
+TEST_CASE("Test DynamicArray iterators are plain pointers.", "[DynamicArray]")
+{
+    REQUIRE(sizeof(iterator) == sizeof(TestObject<int> *));
+    REQUIRE(sizeof(const_iterator) == sizeof(TestObject<int> *));
+    REQUIRE(std::is_trivially_copyable_v<iterator>);
+    REQUIRE(std::is_trivially_copyable_v<const_iterator>);
+    REQUIRE(!std::is_polymorphic_v<dsaa::DynamicArray<int>>);
+    REQUIRE(std::is_final_v<dsaa::DynamicArray<int>>);
+}
+
 TEST_CASE("Test DynamicArray const_iterator default constructor.", "[DynamicArray]")
 {
     const_iterator iter;
@@ -769,6 +782,65 @@ TEST_CASE("Test DynamicArray resize function.", "[DynamicArray]")
     }
 }
 
+TEST_CASE("Test DynamicArray default-initializing resize functions.", "[DynamicArray]")
+{
+    size_t arr_size(dsaa::random::random_range_int<int>(10, 20));
+    dsaa::DynamicArray<int> param(dsaa::random::random_range_ints<int>(arr_size));
+
+    SECTION("Test DynamicArray constructor with dsaa::default_init.")
+    {
+        dsaa::DynamicArray<int> arr(arr_size, dsaa::default_init);
+
+        REQUIRE(arr.size() == arr_size);
+        REQUIRE(arr.capacity() == arr_size);
+    }
+
+    SECTION("Test DynamicArray constructor with dsaa::default_init and class type.")
+    {
+        int live(dsaa::TestObject::livecount);
+        {
+            dsaa::DynamicArray<TestObject<int>> arr(arr_size, dsaa::default_init);
+
+            REQUIRE(arr.size() == arr_size);
+            REQUIRE(dsaa::TestObject::livecount == live + static_cast<int>(arr_size));
+        }
+        REQUIRE(dsaa::TestObject::livecount == live);
+    }
+
+    SECTION("Test DynamicArray resize_uninitialized keeps old elements.")
+    {
+        dsaa::DynamicArray<int> arr(param);
+        arr.resize_uninitialized(2 * arr_size);
+
+        REQUIRE(arr.size() == 2 * arr_size);
+        for (size_t i(0); i != arr_size; ++i)
+            REQUIRE(arr[i] == param[i]);
+
+        arr.resize_uninitialized(1);
+        REQUIRE(arr.size() == 1);
+        REQUIRE(arr[0] == param[0]);
+    }
+
+    SECTION("Test DynamicArray resize_default_init with class type.")
+    {
+        int live(dsaa::TestObject::livecount);
+        {
+            dsaa::DynamicArray<TestObject<int>> arr(param.begin(), param.end());
+            arr.resize_default_init(2 * arr_size);
+
+            REQUIRE(arr.size() == 2 * arr_size);
+            REQUIRE(dsaa::TestObject::livecount == live + 2 * static_cast<int>(arr_size));
+            for (size_t i(0); i != arr_size; ++i)
+                REQUIRE(arr[i].value() == param[i]);
+
+            arr.resize_default_init(3);
+            REQUIRE(arr.size() == 3);
+            REQUIRE(dsaa::TestObject::livecount == live + 3);
+        }
+        REQUIRE(dsaa::TestObject::livecount == live);
+    }
+}
+
 TEST_CASE("Test DynamicArray insert_last with parameter value.", "[DynamicArray]")
 {
     size_t arr_size(dsaa::random::random_range_int<int>(10, 20));
@@ -920,6 +992,89 @@ TEST_CASE("Test DynamicArray emplace_last using parameter pack.", "[DynamicArray
     REQUIRE(*arr_iter == value);
 }
 
+TEST_CASE("Test DynamicArray batch appends.", "[DynamicArray]")
+{
+    size_t arr_size(dsaa::random::random_range_int<int>(10, 20));
+    dsaa::DynamicArray<int> param(dsaa::random::random_range_ints<int>(arr_size));
+    dsaa::DynamicArray<TestObject<int>> arr(param.begin(), param.end());
+    dsaa::DynamicArray<int> source(dsaa::random::random_range_ints<int>(50));
+
+    SECTION("emplace_last_unchecked after reserve.")
+    {
+        arr.reserve(arr.size() + source.size());
+        size_t capacity(arr.capacity());
+        for (auto i(source.begin()); i != source.end(); ++i)
+            REQUIRE(arr.emplace_last_unchecked(*i) == TestObject<int>(*i));
+
+        REQUIRE(arr.capacity() == capacity);
+        REQUIRE(arr.size() == param.size() + source.size());
+        REQUIRE(arr.last() == TestObject<int>(source.last()));
+    }
+
+    SECTION("append_builder reserves once and commits on destruction.")
+    {
+        {
+            auto builder(arr.append_builder(source.size() + 5));
+            REQUIRE(arr.capacity() == param.size() + source.size() + 5);
+            REQUIRE(builder.remaining() == source.size() + 5);
+
+            builder.insert_last_unchecked(source.begin(), source.end() - 10);
+            REQUIRE(arr.size() == param.size());
+            builder.commit();
+            REQUIRE(arr.size() == param.size() + source.size() - 10);
+
+            builder.insert_last_unchecked(source.begin() + (source.size() - 10), source.end());
+            builder.emplace_last_unchecked(7);
+            REQUIRE(builder.remaining() == 4);
+        }
+
+        REQUIRE(arr.size() == param.size() + source.size() + 1);
+        for (size_t i(0); i != param.size(); ++i)
+            REQUIRE(arr[i] == TestObject<int>(param[i]));
+        for (size_t i(0); i != source.size(); ++i)
+            REQUIRE(arr[param.size() + i] == TestObject<int>(source[i]));
+        REQUIRE(arr.last() == TestObject<int>(7));
+    }
+
+    SECTION("append_from node containers allocates exactly.")
+    {
+        dsaa::SinglyLinkList<TestObject<int>> singly(source.begin(), source.end());
+        dsaa::DoublyLinkList<TestObject<int>> doubly(source.begin(), source.end());
+        dsaa::Queue<TestObject<int>> queue;
+        for (auto i(source.begin()); i != source.end(); ++i)
+            queue.insert(TestObject<int>(*i));
+
+        arr.shrink_to_fit();
+        arr.append_from(singly);
+        REQUIRE(arr.capacity() == param.size() + source.size());
+        arr.append_from(doubly);
+        REQUIRE(arr.capacity() == param.size() + 2 * source.size());
+        arr.append_from(queue);
+        REQUIRE(arr.capacity() == param.size() + 3 * source.size());
+
+        REQUIRE(arr.size() == param.size() + 3 * source.size());
+        for (size_t round(0); round != 3; ++round)
+            for (size_t i(0); i != source.size(); ++i)
+                REQUIRE(arr[param.size() + round * source.size() + i] == TestObject<int>(source[i]));
+    }
+
+#ifdef PARAM_CHECK
+    SECTION("Appending past the reserved space is rejected.")
+    {
+        dsaa::DynamicArray<int> ints;
+        auto builder(ints.append_builder(2));
+        builder.insert_last_unchecked(source.begin(), source.begin() + static_cast<std::ptrdiff_t>(builder.remaining()));
+
+        REQUIRE_THROWS_AS(builder.emplace_last_unchecked(7), std::out_of_range);
+        builder.commit();
+        REQUIRE(ints.size() == ints.capacity());
+
+        REQUIRE_THROWS_AS(ints.emplace_last_unchecked(7), std::out_of_range);
+        REQUIRE(ints.size() == 2);
+    }
+#endif
+}
+
 TEST_CASE("Test DynamicArray insert_at with one parameter's value.", "[DynamicArray]")
 {
     size_t arr_size(dsaa::random::random_range_int<int>(10, 20));
@@ -0,0 +1,144 @@
+#ifndef DSAA_TEST_GROWTH_POLICY_H
+#define DSAA_TEST_GROWTH_POLICY_H
+
+#include "Catch2/Catch.hpp"
+#include "arrays/GrowthPolicy.h"
+#include "arrays/DynamicArray.h"
+#include "arrays/SmallDynamicArray.h"
+#include "test/TestObject.h"
+
+namespace
+{
+    // A user supplied policy: grows to the next power of two.
+    struct PowerOfTwoGrowth
+    {
+        size_t operator()(size_t, size_t p_required) const
+        {
+            size_t result(1);
+            while (result < p_required)
+                result *= 2;
+            return result;
+        }
+    };
+}
+
+TEST_CASE("Test growth policies.", "[GrowthPolicy]")
+{
+    SECTION("DoublingGrowth.")
+    {
+        dsaa::DoublingGrowth policy;
+        REQUIRE(policy(0, 1) == 8);
+        REQUIRE(policy(8, 9) == 16);
+        REQUIRE(policy(8, 100) == 100);
+    }
+
+    SECTION("HalfGrowth.")
+    {
+        dsaa::HalfGrowth policy;
+        REQUIRE(policy(0, 1) == 8);
+        REQUIRE(policy(8, 9) == 12);
+        REQUIRE(policy(100, 101) == 150);
+        REQUIRE(policy(100, 500) == 500);
+    }
+
+    SECTION("ChunkGrowth.")
+    {
+        dsaa::ChunkGrowth<64> policy;
+        REQUIRE(policy(0, 1) == 64);
+        REQUIRE(policy(64, 65) == 128);
+        REQUIRE(policy(64, 200) == 256);
+    }
+}
+
+TEST_CASE("Test DynamicArray with a growth policy.", "[DynamicArray][GrowthPolicy]")
+{
+    SECTION("insert_last follows HalfGrowth.")
+    {
+        dsaa::DynamicArray<int, std::allocator<int>, dsaa::HalfGrowth> arr;
+        for (int i(0); i != 9; ++i)
+            arr.insert_last(i);
+
+        REQUIRE(arr.capacity() == 12);
+        for (int i(0); i != 9; ++i)
+            REQUIRE(arr[i] == i);
+    }
+
+    SECTION("insert_at follows ChunkGrowth.")
+    {
+        dsaa::DynamicArray<TestObject<int>, std::allocator<TestObject<int>>, dsaa::ChunkGrowth<4>> arr;
+        for (int i(0); i != 5; ++i)
+            arr.insert_at(arr.cbegin(), TestObject<int>(i));
+
+        REQUIRE(arr.capacity() == 8);
+        REQUIRE(arr.first() == TestObject<int>(4));
+        REQUIRE(arr.last() == TestObject<int>(0));
+    }
+
+    SECTION("A user supplied policy.")
+    {
+        dsaa::DynamicArray<int, std::allocator<int>, PowerOfTwoGrowth> arr;
+        for (int i(0); i != 3; ++i)
+            arr.insert_last(i);
+        REQUIRE(arr.capacity() == 4);
+        arr.emplace_last(3);
+        arr.emplace_last(4);
+        REQUIRE(arr.capacity() == 8);
+    }
+
+    SECTION("CountingGrowth counts reallocations and relocated bytes.")
+    {
+        dsaa::DynamicArray<int, std::allocator<int>, dsaa::CountingGrowth<dsaa::DoublingGrowth>> arr;
+        for (int i(0); i != 17; ++i)
+            arr.emplace_last(i);
+
+        // Capacity went 8, 16, 32.
+        REQUIRE(arr.growth_policy().reallocations() == 3);
+        REQUIRE(arr.growth_policy().bytes_relocated() == (8 + 16) * sizeof(int));
+        REQUIRE(arr.growth_policy().bytes_allocated() == (8 + 16 + 32) * sizeof(int));
+
+        arr.growth_policy().reset();
+        arr.shrink_to_fit();
+        REQUIRE(arr.growth_policy().reallocations() == 1);
+        REQUIRE(arr.growth_policy().bytes_relocated() == 17 * sizeof(int));
+        REQUIRE(arr.growth_policy().bytes_allocated() == 17 * sizeof(int));
+    }
+
+    SECTION("Assignment takes the policy but not its counters.")
+    {
+        using Counted = dsaa::DynamicArray<int, std::allocator<int>, dsaa::CountingGrowth<dsaa::HalfGrowth>>;
+        Counted source;
+        for (int i(0); i != 17; ++i)
+            source.emplace_last(i);
+
+        // Assigned with and without room for the elements.
+        Counted small, large;
+        large.reserve(64);
+        small = source;
+        large = source;
+        REQUIRE(source.growth_policy().reallocations() == 3);
+        REQUIRE(small.growth_policy().reallocations() == 0);
+        REQUIRE(large.growth_policy().reallocations() == 0);
+
+        Counted moved;
+        moved.emplace_last(0);
+        moved = std::move(small);
+        REQUIRE(moved.growth_policy().reallocations() == 0);
+        REQUIRE(moved.growth_policy().bytes_relocated() == 0);
+        REQUIRE(moved.growth_policy().bytes_allocated() == 0);
+        // Capacity 17, then grown by half.
+        moved.emplace_last(17);
+        REQUIRE(moved.capacity() == 25);
+        REQUIRE(moved.growth_policy().reallocations() == 1);
+
+        dsaa::SmallDynamicArray<int, 4, std::allocator<int>, dsaa::CountingGrowth<dsaa::DoublingGrowth>> inline_source, inline_copy;
+        for (int i(0); i != 5; ++i)
+            inline_source.emplace_last(i);
+        inline_copy.reserve(64);
+        inline_copy = inline_source;
+        REQUIRE(inline_source.growth_policy().reallocations() == 1);
+        REQUIRE(inline_copy.growth_policy().reallocations() == 0);
+        REQUIRE(inline_copy.growth_policy().bytes_allocated() == 0);
+    }
+}
+
+#endif //!DSAA_TEST_GROWTH_POLICY_H
@@ -0,0 +1,203 @@
+#ifndef DSAA_TEST_MAPPED_ARRAY_H
+#define DSAA_TEST_MAPPED_ARRAY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "Catch2/Catch.hpp"
+#include "arrays/MappedDynamicArray.h"
+#include "memory/Serialize.h"
+#include "algorithms/Sort.h"
+#include "algorithms/Search.h"
+#include "algorithms/Random.h"
+
+namespace
+{
+    // Removes the backing file when a test ends.
+    struct TemporaryFile
+    {
+        std::string path;
+
+        explicit TemporaryFile(const char *p_name) : path((std::filesystem::temp_directory_path() / p_name).string())
+        {
+            std::filesystem::remove(path);
+        }
+        ~TemporaryFile() { std::filesystem::remove(path); }
+    };
+}
+
+TEST_CASE("Test MappedDynamicArray on a new file.", "[MappedDynamicArray]")
+{
+    TemporaryFile file("dsaa_test_mapped_new.bin");
+    dsaa::MappedDynamicArray<int> arr(file.path);
+
+    REQUIRE(arr.empty());
+    REQUIRE(arr.capacity() == 0);
+    REQUIRE(arr.begin() == arr.end());
+    REQUIRE(arr.path() == file.path);
+    REQUIRE(std::filesystem::exists(file.path));
+
+    for (int i(0); i != 100; ++i)
+        arr.insert_last(i);
+
+    REQUIRE(arr.size() == 100);
+    REQUIRE(arr.capacity() >= 100);
+    REQUIRE(arr.first() == 0);
+    REQUIRE(arr.last() == 99);
+    for (int i(0); i != 100; ++i)
+        REQUIRE(arr[i] == i);
+    REQUIRE_THROWS_AS(arr.at(100), std::out_of_range);
+}
+
+TEST_CASE("Test MappedDynamicArray reserve, resize and shrink_to_fit.", "[MappedDynamicArray]")
+{
+    TemporaryFile file("dsaa_test_mapped_reserve.bin");
+    dsaa::MappedDynamicArray<double> arr(file.path);
+
+    arr.resize(10, 1.5);
+    REQUIRE(arr.size() == 10);
+    for (auto i : arr)
+        REQUIRE(i == 1.5);
+
+    arr.reserve(1 << 16);
+    REQUIRE(arr.capacity() == (1 << 16));
+    REQUIRE(arr.size() == 10);
+    REQUIRE(arr[9] == 1.5);
+    REQUIRE(std::filesystem::file_size(file.path) >= (1 << 16) * sizeof(double));
+
+    arr.shrink_to_fit();
+    REQUIRE(arr.capacity() == 10);
+    REQUIRE(std::filesystem::file_size(file.path) < 1024);
+    REQUIRE(arr[0] == 1.5);
+
+    arr.resize(3);
+    REQUIRE(arr.size() == 3);
+    arr.clear();
+    REQUIRE(arr.empty());
+}
+
+TEST_CASE("Test MappedDynamicArray reopens saved elements.", "[MappedDynamicArray]")
+{
+    TemporaryFile file("dsaa_test_mapped_reopen.bin");
+    dsaa::DynamicArray<int> param(dsaa::random::random_range_ints<int>(1000));
+    {
+        dsaa::MappedDynamicArray<int> arr(file.path, dsaa::MappedMode::truncate);
+        arr.insert_last(param.begin(), param.end());
+        arr.sync();
+    }
+
+    SECTION("open_or_create maps the saved elements.")
+    {
+        dsaa::MappedDynamicArray<int> arr(file.path);
+
+        REQUIRE(arr.size() == param.size());
+        for (size_t i(0); i != param.size(); ++i)
+            REQUIRE(arr[i] == param[i]);
+    }
+
+    SECTION("truncate discards them.")
+    {
+        dsaa::MappedDynamicArray<int> arr(file.path, dsaa::MappedMode::truncate);
+
+        REQUIRE(arr.empty());
+    }
+
+    SECTION("A different element type is rejected.")
+    {
+        REQUIRE_THROWS_AS(dsaa::MappedDynamicArray<double>(file.path), std::runtime_error);
+        // The file is left as it was.
+        dsaa::MappedDynamicArray<int> arr(file.path);
+        REQUIRE(arr.size() == param.size());
+    }
+
+    SECTION("A foreign file is rejected.")
+    {
+        {
+            std::ofstream stream(file.path, std::ios::trunc);
+            stream << "not an array";
+        }
+        REQUIRE_THROWS_AS(dsaa::MappedDynamicArray<int>(file.path), std::runtime_error);
+    }
+
+    SECTION("A saved Matrix or an oversized count is rejected.")
+    {
+        dsaa::save(file.path, dsaa::Matrix<int>(2, 3));
+        REQUIRE_THROWS_AS(dsaa::MappedDynamicArray<int>(file.path), std::runtime_error);
+
+        dsaa::save(file.path, param);
+        {
+            std::fstream stream(file.path, std::ios::in | std::ios::out | std::ios::binary);
+            const uint64_t count(param.size() + 1);
+            stream.seekp(offsetof(dsaa::BinaryHeader, extents));
+            stream.write(reinterpret_cast<const char *>(&count), sizeof(count));
+        }
+        REQUIRE_THROWS_AS(dsaa::MappedDynamicArray<int>(file.path), std::runtime_error);
+    }
+}
+
+TEST_CASE("Test MappedDynamicArray files are those of save and load.", "[MappedDynamicArray]")
+{
+    TemporaryFile file("dsaa_test_mapped_serialize.bin");
+    dsaa::DynamicArray<int> param(dsaa::random::random_range_ints<int>(1000));
+
+    SECTION("A saved DynamicArray is mapped.")
+    {
+        dsaa::save(file.path, param);
+
+        dsaa::MappedDynamicArray<int> arr(file.path);
+        REQUIRE(arr.size() == param.size());
+        for (size_t i(0); i != param.size(); ++i)
+            REQUIRE(arr[i] == param[i]);
+    }
+
+    SECTION("A closed MappedDynamicArray is loaded and viewed, its spare capacity ignored.")
+    {
+        {
+            dsaa::MappedDynamicArray<int> arr(file.path, dsaa::MappedMode::truncate);
+            arr.insert_last(param.begin(), param.end());
+            arr.reserve(4 * param.size());
+        }
+
+        dsaa::DynamicArray<int> loaded;
+        dsaa::load(file.path, loaded);
+        dsaa::MappedView<int> view(file.path);
+
+        REQUIRE(loaded.size() == param.size());
+        REQUIRE(view.size() == param.size());
+        for (size_t i(0); i != param.size(); ++i)
+        {
+            REQUIRE(loaded[i] == param[i]);
+            REQUIRE(view[i] == param[i]);
+        }
+    }
+}
+
+TEST_CASE("Test MappedDynamicArray with algorithms.", "[MappedDynamicArray]")
+{
+    TemporaryFile file("dsaa_test_mapped_sort.bin");
+    dsaa::DynamicArray<int> param(dsaa::random::random_range_ints<int>(500, -1000, 1000));
+    dsaa::MappedDynamicArray<int> arr(file.path);
+    arr.insert_last(param.begin(), param.end());
+    arr.advise(dsaa::MappedAdvice::sequential);
+
+    dsaa::merge_sort(arr.begin(), arr.end());
+    REQUIRE(dsaa::is_sorted(arr.begin(), arr.end()));
+
+    arr.advise(dsaa::MappedAdvice::random);
+    REQUIRE(*dsaa::binary_search(arr.begin(), arr.end(), param[7]) == param[7]);
+
+    SECTION("Moving keeps the mapping.")
+    {
+        int *data(arr.data());
+        dsaa::MappedDynamicArray<int> other(std::move(arr));
+
+        REQUIRE(other.data() == data);
+        REQUIRE(other.size() == param.size());
+        REQUIRE(arr.size() == 0);
+    }
+}
+
+#endif //!DSAA_TEST_MAPPED_ARRAY_H
@@ -0,0 +1,317 @@
+#ifndef DSAA_TEST_SMALL_ARRAY_H
+#define DSAA_TEST_SMALL_ARRAY_H
+
+#include <string>
+
+#include "Catch2/Catch.hpp"
+#include "arrays/SmallDynamicArray.h"
+#include "memory/ArenaAllocator.h"
+#include "algorithms/Sort.h"
+#include "algorithms/Random.h"
+#include "test/TestObject.h"
+
+namespace
+{
+    // Counts the elements it has handed out and not yet taken back in a shared ledger. Two of them are equal when they
+    // share a ledger, and they do not propagate on move assignment.
+    template <typename Elem>
+    struct LedgerAllocator
+    {
+        using value_type = Elem;
+        using propagate_on_container_move_assignment = std::false_type;
+        using is_always_equal = std::false_type;
+
+        LedgerAllocator() noexcept = default;
+        explicit LedgerAllocator(long &p_ledger) noexcept : m_ledger(&p_ledger) {}
+        template <typename Other>
+        LedgerAllocator(const LedgerAllocator<Other> &p_other) noexcept : m_ledger(p_other.m_ledger) {}
+
+        Elem *allocate(size_t p_size)
+        {
+            *m_ledger += static_cast<long>(p_size);
+            return std::allocator<Elem>().allocate(p_size);
+        }
+
+        void deallocate(Elem *p_pointer, size_t p_size) noexcept
+        {
+            *m_ledger -= static_cast<long>(p_size);
+            std::allocator<Elem>().deallocate(p_pointer, p_size);
+        }
+
+        long *m_ledger = nullptr;
+    };
+
+    template <typename Elem1, typename Elem2>
+    bool operator==(const LedgerAllocator<Elem1> &p_lhs, const LedgerAllocator<Elem2> &p_rhs) noexcept { return p_lhs.m_ledger == p_rhs.m_ledger; }
+    template <typename Elem1, typename Elem2>
+    bool operator!=(const LedgerAllocator<Elem1> &p_lhs, const LedgerAllocator<Elem2> &p_rhs) noexcept { return p_lhs.m_ledger != p_rhs.m_ledger; }
+}
+
+TEST_CASE("Test SmallDynamicArray default constructor.", "[SmallDynamicArray]")
+{
+    dsaa::SmallDynamicArray<int, 4> arr;
+
+    REQUIRE(arr.empty());
+    REQUIRE(arr.is_small());
+    REQUIRE(arr.capacity() == 4);
+    REQUIRE(arr.inline_capacity() == 4);
+    REQUIRE(arr.begin() == arr.end());
+}
+
+TEST_CASE("Test SmallDynamicArray stays inline until it outgrows its buffer.", "[SmallDynamicArray]")
+{
+    dsaa::SmallDynamicArray<int, 4> arr;
+    for (int i(0); i != 4; ++i)
+        arr.insert_last(i);
+
+    REQUIRE(arr.is_small());
+    REQUIRE(arr.size() == 4);
+
+    arr.insert_last(4);
+    REQUIRE(!arr.is_small());
+    REQUIRE(arr.capacity() == 8);
+    for (int i(0); i != 5; ++i)
+        REQUIRE(arr[i] == i);
+
+    SECTION("shrink_to_fit moves elements back inline.")
+    {
+        arr.erase_last();
+        arr.shrink_to_fit();
+
+        REQUIRE(arr.is_small());
+        REQUIRE(arr.capacity() == 4);
+        for (int i(0); i != 4; ++i)
+            REQUIRE(arr[i] == i);
+    }
+
+    SECTION("shrink_to_fit on the heap.")
+    {
+        arr.insert_last(5);
+        arr.shrink_to_fit();
+
+        REQUIRE(!arr.is_small());
+        REQUIRE(arr.capacity() == 6);
+    }
+}
+
+TEST_CASE("Test SmallDynamicArray constructors.", "[SmallDynamicArray]")
+{
+    SECTION("Size and value.")
+    {
+        dsaa::SmallDynamicArray<std::string, 2> arr(3, "abc");
+        REQUIRE(arr.size() == 3);
+        for (auto &i : arr)
+            REQUIRE(i == "abc");
+    }
+
+    SECTION("std::initializer_list.")
+    {
+        dsaa::SmallDynamicArray<int, 8> arr{1, 2, 3};
+        REQUIRE(arr.is_small());
+        REQUIRE(arr.size() == 3);
+        REQUIRE(arr.first() == 1);
+        REQUIRE(arr.last() == 3);
+    }
+
+    SECTION("Pair of IIterator.")
+    {
+        dsaa::DynamicArray<int> param(dsaa::random::random_range_ints<int>(20));
+        dsaa::SmallDynamicArray<int, 8> arr(param.begin(), param.end());
+        REQUIRE(arr.size() == param.size());
+        for (size_t i(0); i != param.size(); ++i)
+            REQUIRE(arr[i] == param[i]);
+    }
+}
+
+TEST_CASE("Test SmallDynamicArray copy and move.", "[SmallDynamicArray]")
+{
+    int live(dsaa::TestObject::livecount);
+    {
+        size_t arr_size = GENERATE(2, 10);
+        dsaa::SmallDynamicArray<TestObject<int>, 4> param;
+        for (size_t i(0); i != arr_size; ++i)
+            param.emplace_last(static_cast<int>(i));
+
+        SECTION("Copy constructor.")
+        {
+            dsaa::SmallDynamicArray<TestObject<int>, 4> arr(param);
+            REQUIRE(arr.size() == arr_size);
+            REQUIRE(arr.is_small() == param.is_small());
+            for (size_t i(0); i != arr_size; ++i)
+                REQUIRE(arr[i].value() == static_cast<int>(i));
+        }
+
+        SECTION("Move constructor.")
+        {
+            bool small(param.is_small());
+            const TestObject<int> *data(param.data());
+            dsaa::SmallDynamicArray<TestObject<int>, 4> arr(std::move(param));
+
+            REQUIRE(param.empty());
+            REQUIRE(param.is_small());
+            REQUIRE(arr.size() == arr_size);
+            REQUIRE(arr.is_small() == small);
+            // A heap buffer is stolen instead of moved element by element.
+            if (!small)
+                REQUIRE(arr.data() == data);
+            for (size_t i(0); i != arr_size; ++i)
+                REQUIRE(arr[i].value() == static_cast<int>(i));
+        }
+
+        SECTION("Move assignment.")
+        {
+            dsaa::SmallDynamicArray<TestObject<int>, 4> arr(7, TestObject<int>(-1));
+            arr = std::move(param);
+
+            REQUIRE(param.empty());
+            REQUIRE(arr.size() == arr_size);
+            for (size_t i(0); i != arr_size; ++i)
+                REQUIRE(arr[i].value() == static_cast<int>(i));
+        }
+
+        SECTION("Copy assignment.")
+        {
+            dsaa::SmallDynamicArray<TestObject<int>, 4> arr{TestObject<int>(-1)};
+            arr = param;
+
+            REQUIRE(arr.size() == arr_size);
+            for (size_t i(0); i != arr_size; ++i)
+                REQUIRE(arr[i].value() == static_cast<int>(i));
+        }
+
+        SECTION("swap.")
+        {
+            dsaa::SmallDynamicArray<TestObject<int>, 4> arr{TestObject<int>(-1)};
+            arr.swap(param);
+
+            REQUIRE(param.size() == 1);
+            REQUIRE(param[0].value() == -1);
+            REQUIRE(arr.size() == arr_size);
+            for (size_t i(0); i != arr_size; ++i)
+                REQUIRE(arr[i].value() == static_cast<int>(i));
+        }
+    }
+    REQUIRE(dsaa::TestObject::livecount == live);
+}
+
+TEST_CASE("Test SmallDynamicArray moves between allocators.", "[SmallDynamicArray]")
+{
+    int live(dsaa::TestObject::livecount);
+    {
+        SECTION("Move assignment propagates an arena allocator.")
+        {
+            dsaa::MonotonicArena arena;
+            using Array = dsaa::SmallDynamicArray<TestObject<int>, 4, dsaa::ArenaAllocator<TestObject<int>>>;
+            Array param{dsaa::ArenaAllocator<TestObject<int>>(arena)};
+            for (int i(0); i != 10; ++i)
+                param.emplace_last(i);
+            const TestObject<int> *data(param.data());
+
+            // Not bound to an arena, so it frees through std::allocator.
+            Array arr;
+            arr.emplace_last(-1);
+            arr = std::move(param);
+
+            REQUIRE(arr.get_allocator() == dsaa::ArenaAllocator<TestObject<int>>(arena));
+            REQUIRE(arr.data() == data);
+            REQUIRE(arr.size() == 10);
+            for (int i(0); i != 10; ++i)
+                REQUIRE(arr[i].value() == i);
+        }
+
+        using Array = dsaa::SmallDynamicArray<TestObject<int>, 4, LedgerAllocator<TestObject<int>>>;
+        long ledger(0), other_ledger(0);
+        {
+            Array param{LedgerAllocator<TestObject<int>>(ledger)};
+            for (int i(0); i != 10; ++i)
+                param.emplace_last(i);
+            const TestObject<int> *data(param.data());
+
+            SECTION("Move assignment without propagation relocates into its own storage.")
+            {
+                Array arr{LedgerAllocator<TestObject<int>>(other_ledger)};
+                arr = std::move(param);
+
+                REQUIRE(arr.get_allocator() == LedgerAllocator<TestObject<int>>(other_ledger));
+                REQUIRE(arr.data() != data);
+                REQUIRE(param.empty());
+                REQUIRE(param.is_small());
+                REQUIRE(ledger == 0);
+                REQUIRE(arr.size() == 10);
+                for (int i(0); i != 10; ++i)
+                    REQUIRE(arr[i].value() == i);
+            }
+
+            SECTION("Move construction with another allocator relocates into its own storage.")
+            {
+                Array arr(std::move(param), LedgerAllocator<TestObject<int>>(other_ledger));
+
+                REQUIRE(arr.data() != data);
+                REQUIRE(param.empty());
+                REQUIRE(ledger == 0);
+                REQUIRE(arr.size() == 10);
+                for (int i(0); i != 10; ++i)
+                    REQUIRE(arr[i].value() == i);
+            }
+
+            SECTION("Move construction with an equal allocator steals the block.")
+            {
+                Array arr(std::move(param), LedgerAllocator<TestObject<int>>(ledger));
+
+                REQUIRE(arr.data() == data);
+                REQUIRE(other_ledger == 0);
+            }
+        }
+        REQUIRE(ledger == 0);
+        REQUIRE(other_ledger == 0);
+    }
+    REQUIRE(dsaa::TestObject::livecount == live);
+}
+
+TEST_CASE("Test SmallDynamicArray insert_at and erase.", "[SmallDynamicArray]")
+{
+    int live(dsaa::TestObject::livecount);
+    {
+        dsaa::SmallDynamicArray<TestObject<int>, 4> arr;
+        for (int i(0); i != 6; ++i)
+            arr.insert_at(arr.cbegin(), TestObject<int>(i));
+
+        REQUIRE(arr.size() == 6);
+        for (int i(0); i != 6; ++i)
+            REQUIRE(arr[i].value() == 5 - i);
+
+        arr.insert_at(arr.cbegin() + 1, {TestObject<int>(10), TestObject<int>(11)});
+        REQUIRE(arr.size() == 8);
+        REQUIRE(arr[1].value() == 10);
+        REQUIRE(arr[2].value() == 11);
+        REQUIRE(arr[3].value() == 4);
+
+        arr.erase(arr.cbegin() + 1, arr.cbegin() + 3);
+        REQUIRE(arr.size() == 6);
+        REQUIRE(arr[1].value() == 4);
+
+        arr.erase_at(arr.cbegin());
+        REQUIRE(arr.size() == 5);
+        REQUIRE(arr.first().value() == 4);
+        REQUIRE(arr.last().value() == 0);
+
+        arr.resize(2);
+        REQUIRE(arr.size() == 2);
+        arr.shrink_to_fit();
+        REQUIRE(arr.is_small());
+        REQUIRE(arr[1].value() == 3);
+    }
+    REQUIRE(dsaa::TestObject::livecount == live);
+}
+
+TEST_CASE("Test SmallDynamicArray with algorithms.", "[SmallDynamicArray]")
+{
+    dsaa::DynamicArray<int> param(dsaa::random::random_range_ints<int>(30));
+    dsaa::SmallDynamicArray<int, 16> arr(param.begin(), param.end());
+
+    dsaa::insertion_sort(arr.begin(), arr.end());
+
+    REQUIRE(dsaa::is_sorted(arr.begin(), arr.end()));
+}
+
+#endif //!DSAA_TEST_SMALL_ARRAY_H
@@ -717,6 +717,30 @@ TEST_CASE("Test AVLTree erase", "[AVLTree]")
                                               REQUIRE(*heights_iter++ == value->height());
                                           });
     }
+
+    SECTION("Erase random elements keeps the tree balanced")
+    {
+        dsaa::DynamicArray<int> values(dsaa::random::random_range_ints<int>(300, 0, 100));
+        dsaa::AVLTree<int> tree;
+        for (auto i(values.begin()); i != values.end(); ++i)
+            tree.insert(*i);
+
+        for (auto i(values.begin()); i != values.end(); ++i)
+        {
+            dsaa::AVLTreeNode<int> *node = tree.iterative_search(tree.root(), *i);
+            REQUIRE(node != nullptr);
+            tree.erase(node);
+
+            tree.recursive_postorder_tree_walk(tree.root(), [&tree](dsaa::AVLTreeNode<int> *&value)
+                                               {
+                                                   REQUIRE(-1 <= tree.balance_factor(value));
+                                                   REQUIRE(tree.balance_factor(value) <= 1);
+                                                   REQUIRE((!value->left() || value->left()->parent() == value));
+                                                   REQUIRE((!value->right() || value->right()->parent() == value));
+                                               });
+        }
+        REQUIRE(tree.size() == 0);
+    }
 }
 
 TEST_CASE("Test AVLTree copy constructor", "[AVLTree]")
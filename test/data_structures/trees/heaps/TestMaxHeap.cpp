@@ -9,6 +9,14 @@ using const_iterator = dsaa::MaxHeap<TestObject<int>>::const_iterator;
 using iterator = dsaa::MaxHeap<TestObject<int>>::iterator;
 using reserve_iterator = dsaa::MaxHeap<TestObject<int>>::reverse_iterator;
 
+TEST_CASE("Test MaxHeap iterators are plain pointers.", "[MaxHeap]")
+{
+    REQUIRE(sizeof(iterator) == sizeof(TestObject<int> *));
+    REQUIRE(std::is_trivially_copyable_v<iterator>);
+    REQUIRE(std::is_trivially_copyable_v<const_iterator>);
+    REQUIRE(!std::is_polymorphic_v<dsaa::MaxHeap<int>>);
+}
+
 TEST_CASE("Test MaxHeap const_iterator default constructor.", "[MaxHeap]")
 {
     const_iterator iter;
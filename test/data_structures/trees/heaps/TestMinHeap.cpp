@@ -9,6 +9,14 @@ using const_iterator = dsaa::MinHeap<TestObject<int>>::const_iterator;
 using iterator = dsaa::MinHeap<TestObject<int>>::iterator;
 using reserve_iterator = dsaa::MinHeap<TestObject<int>>::reverse_iterator;
 
+TEST_CASE("Test MinHeap iterators are plain pointers.", "[MinHeap]")
+{
+    REQUIRE(sizeof(iterator) == sizeof(TestObject<int> *));
+    REQUIRE(std::is_trivially_copyable_v<iterator>);
+    REQUIRE(std::is_trivially_copyable_v<const_iterator>);
+    REQUIRE(!std::is_polymorphic_v<dsaa::MinHeap<int>>);
+}
+
 TEST_CASE("Test MinHeap const_iterator default constructor.", "[MinHeap]")
 {
     const_iterator iter;
@@ -0,0 +1,129 @@
+#ifndef DSAA_TEST_ARENA_ALLOCATOR_H
+#define DSAA_TEST_ARENA_ALLOCATOR_H
+
+#include <cstdint>
+
+#include "Catch2/Catch.hpp"
+#include "memory/ArenaAllocator.h"
+#include "arrays/DynamicArray.h"
+#include "lists/SinglyLinkList.h"
+#include "binary_trees/RedBlackTree.h"
+#include "Queue.h"
+#include "test/TestObject.h"
+
+TEST_CASE("Test MonotonicArena.", "[ArenaAllocator]")
+{
+    dsaa::MonotonicArena arena(256);
+
+    SECTION("Allocations are aligned and do not overlap.")
+    {
+        char *first(static_cast<char *>(arena.allocate(3, 1)));
+        uint64_t *second(static_cast<uint64_t *>(arena.allocate(sizeof(uint64_t), alignof(uint64_t))));
+        void *third(arena.allocate(64, 64));
+
+        REQUIRE(reinterpret_cast<uintptr_t>(second) % alignof(uint64_t) == 0);
+        REQUIRE(reinterpret_cast<uintptr_t>(third) % 64 == 0);
+        REQUIRE(first + 3 <= reinterpret_cast<char *>(second));
+        REQUIRE(reinterpret_cast<char *>(second + 1) <= static_cast<char *>(third));
+        REQUIRE(arena.used() == 3 + sizeof(uint64_t) + 64);
+    }
+
+    SECTION("Requests larger than a chunk.")
+    {
+        unsigned char *block(static_cast<unsigned char *>(arena.allocate(10000)));
+        for (size_t i(0); i != 10000; ++i)
+            block[i] = static_cast<unsigned char>(i);
+        REQUIRE(arena.capacity() >= 10000);
+        REQUIRE(block[9999] == static_cast<unsigned char>(9999));
+    }
+
+    SECTION("Reset keeps the largest chunk and reuses it.")
+    {
+        for (size_t i(0); i != 100; ++i)
+            (void)arena.allocate(100);
+        void *first(nullptr);
+        arena.reset();
+        size_t capacity(arena.capacity());
+        REQUIRE(arena.used() == 0);
+        REQUIRE(capacity != 0);
+
+        first = arena.allocate(100);
+        arena.reset();
+        REQUIRE(arena.allocate(100) == first);
+        REQUIRE(arena.capacity() == capacity);
+
+        arena.release();
+        REQUIRE(arena.capacity() == 0);
+    }
+}
+
+TEST_CASE("Test containers with ArenaAllocator.", "[ArenaAllocator]")
+{
+    dsaa::MonotonicArena arena;
+
+    SECTION("SinglyLinkList.")
+    {
+        dsaa::SinglyLinkList<int, dsaa::ArenaAllocator<dsaa::SinglyLinkListNode<int>>> list(arena);
+        for (int i(0); i != 1000; ++i)
+            list.insert_last(i);
+
+        REQUIRE(list.size() == 1000);
+        REQUIRE(arena.used() == 1000 * sizeof(dsaa::SinglyLinkListNode<int>));
+        int expected(0);
+        for (auto i(list.begin()); i != list.end(); ++i, ++expected)
+            REQUIRE(*i == expected);
+
+        auto copy(list);
+        REQUIRE(copy.get_allocator() == list.get_allocator());
+        REQUIRE(arena.used() == 2000 * sizeof(dsaa::SinglyLinkListNode<int>));
+    }
+
+    SECTION("Queue and RedBlackTree.")
+    {
+        dsaa::Queue<int, dsaa::ArenaAllocator<dsaa::QueueNode<int>>> queue(arena);
+        dsaa::RedBlackTree<int, dsaa::ArenaAllocator<dsaa::RedBlackTreeNode<int>>> tree(arena);
+        for (int i(0); i != 100; ++i)
+        {
+            queue.insert(i);
+            tree.insert(i);
+        }
+
+        for (int i(0); i != 100; ++i)
+            REQUIRE(queue.extract() == i);
+        REQUIRE(tree.size() == 100);
+        REQUIRE(tree.iterative_minimum(tree.root())->value() == 0);
+        REQUIRE(tree.iterative_maximum(tree.root())->value() == 99);
+    }
+
+    SECTION("DynamicArray.")
+    {
+        dsaa::DynamicArray<int, dsaa::ArenaAllocator<int>> arr(arena);
+        for (int i(0); i != 1000; ++i)
+            arr.insert_last(i);
+        for (int i(0); i != 1000; ++i)
+            REQUIRE(arr[i] == i);
+    }
+
+    SECTION("Elements are still destroyed by their container.")
+    {
+        int live(dsaa::TestObject::livecount);
+        {
+            dsaa::SinglyLinkList<TestObject<int>, dsaa::ArenaAllocator<dsaa::SinglyLinkListNode<TestObject<int>>>> list(arena);
+            for (int i(0); i != 10; ++i)
+                list.insert_last(TestObject<int>(i));
+            REQUIRE(dsaa::TestObject::livecount == live + 10);
+        }
+        REQUIRE(dsaa::TestObject::livecount == live);
+        arena.reset();
+    }
+
+    SECTION("Without an arena.")
+    {
+        dsaa::SinglyLinkList<int, dsaa::ArenaAllocator<dsaa::SinglyLinkListNode<int>>> list{1, 2, 3};
+        REQUIRE(list.get_allocator().arena() == nullptr);
+        REQUIRE(list.size() == 3);
+        REQUIRE(arena.used() == 0);
+    }
+}
+
+#endif //!DSAA_TEST_ARENA_ALLOCATOR_H
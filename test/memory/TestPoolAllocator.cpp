@@ -0,0 +1,112 @@
+#ifndef DSAA_TEST_POOL_ALLOCATOR_H
+#define DSAA_TEST_POOL_ALLOCATOR_H
+
+#include <cstdint>
+
+#include "Catch2/Catch.hpp"
+#include "memory/PoolAllocator.h"
+#include "arrays/DynamicArray.h"
+#include "lists/DoublyLinkList.h"
+#include "binary_trees/AVLTree.h"
+#include "Stack.h"
+
+TEST_CASE("Test BlockPool.", "[PoolAllocator]")
+{
+    dsaa::BlockPool pool(20, 8, 4);
+    REQUIRE(pool.block_size() == 24);
+    REQUIRE(pool.block_alignment() == 8);
+    REQUIRE(pool.fits(24, 8));
+    REQUIRE_FALSE(pool.fits(25, 8));
+    REQUIRE_FALSE(pool.fits(8, 16));
+
+    SECTION("Blocks are aligned and distinct.")
+    {
+        void *blocks[10];
+        for (size_t i(0); i != 10; ++i)
+        {
+            blocks[i] = pool.allocate();
+            REQUIRE(reinterpret_cast<uintptr_t>(blocks[i]) % 8 == 0);
+            for (size_t k(0); k != i; ++k)
+                REQUIRE(blocks[k] != blocks[i]);
+        }
+        REQUIRE(pool.capacity() == 12);
+    }
+
+    SECTION("Freed blocks are reused first.")
+    {
+        void *first(pool.allocate());
+        void *second(pool.allocate());
+        pool.deallocate(first);
+        REQUIRE(pool.allocate() == first);
+        pool.deallocate(second);
+        REQUIRE(pool.allocate() == second);
+    }
+
+    SECTION("Reset hands out the same chunks again.")
+    {
+        void *first(pool.allocate());
+        for (size_t i(0); i != 9; ++i)
+            (void)pool.allocate();
+        pool.reset();
+        REQUIRE(pool.allocate() == first);
+        for (size_t i(0); i != 9; ++i)
+            (void)pool.allocate();
+        REQUIRE(pool.capacity() == 12);
+
+        pool.release();
+        REQUIRE(pool.capacity() == 0);
+    }
+}
+
+TEST_CASE("Test containers with PoolAllocator.", "[PoolAllocator]")
+{
+    SECTION("DoublyLinkList reuses its erased nodes.")
+    {
+        using Node = dsaa::DoublyLinkListNode<int>;
+        dsaa::BlockPool pool(sizeof(Node), alignof(Node));
+        dsaa::DoublyLinkList<int, dsaa::PoolAllocator<Node>> list(pool);
+        for (int i(0); i != 1000; ++i)
+            list.insert_last(i);
+        size_t capacity(pool.capacity());
+
+        for (int round(0); round != 10; ++round)
+        {
+            for (int i(0); i != 500; ++i)
+                list.erase_first();
+            for (int i(0); i != 500; ++i)
+                list.insert_last(i);
+        }
+        REQUIRE(list.size() == 1000);
+        REQUIRE(pool.capacity() == capacity);
+    }
+
+    SECTION("Stack and AVLTree.")
+    {
+        dsaa::BlockPool pool(64);
+        dsaa::Stack<int, dsaa::PoolAllocator<dsaa::StackNode<int>>> stack(pool);
+        dsaa::AVLTree<int, dsaa::PoolAllocator<dsaa::AVLTreeNode<int>>> tree(pool);
+        for (int i(0); i != 100; ++i)
+        {
+            stack.insert(i);
+            tree.insert(i);
+        }
+
+        for (int i(99); i != -1; --i)
+            REQUIRE(stack.extract() == i);
+        REQUIRE(tree.size() == 100);
+        REQUIRE(tree.iterative_minimum(tree.root())->value() == 0);
+    }
+
+    SECTION("Arrays bypass the pool.")
+    {
+        dsaa::BlockPool pool(sizeof(int));
+        dsaa::DynamicArray<int, dsaa::PoolAllocator<int>> arr(pool);
+        for (int i(0); i != 1000; ++i)
+            arr.insert_last(i);
+        for (int i(0); i != 1000; ++i)
+            REQUIRE(arr[i] == i);
+        REQUIRE(pool.capacity() <= 256);
+    }
+}
+
+#endif //!DSAA_TEST_POOL_ALLOCATOR_H
@@ -0,0 +1,82 @@
+#ifndef DSAA_TEST_REALLOC_ALLOCATOR_H
+#define DSAA_TEST_REALLOC_ALLOCATOR_H
+
+#include <cstdint>
+
+#include "Catch2/Catch.hpp"
+#include "memory/ReallocAllocator.h"
+#include "arrays/DynamicArray.h"
+
+// A small threshold so the tests cross from malloc to mmap quickly.
+using SmallThresholdAllocator = dsaa::ReallocAllocator<uint64_t, 4096>;
+
+TEST_CASE("Test ReallocAllocator reallocate.", "[ReallocAllocator]")
+{
+    SmallThresholdAllocator allocator;
+
+    SECTION("Below the threshold.")
+    {
+        uint64_t *block(allocator.allocate(16));
+        for (uint64_t i(0); i != 16; ++i)
+            block[i] = i;
+
+        block = allocator.reallocate(block, 16, 64);
+        for (uint64_t i(0); i != 16; ++i)
+            REQUIRE(block[i] == i);
+
+        allocator.deallocate(block, 64);
+    }
+
+    SECTION("Crossing and above the threshold.")
+    {
+        uint64_t *block(allocator.allocate(256));
+        for (uint64_t i(0); i != 256; ++i)
+            block[i] = i;
+
+        block = allocator.reallocate(block, 256, 1024);
+        REQUIRE(SmallThresholdAllocator::is_mapped(1024));
+        block = allocator.reallocate(block, 1024, 100000);
+        for (uint64_t i(0); i != 256; ++i)
+            REQUIRE(block[i] == i);
+
+        block = allocator.reallocate(block, 100000, 8);
+        for (uint64_t i(0); i != 8; ++i)
+            REQUIRE(block[i] == i);
+
+        allocator.deallocate(block, 8);
+    }
+
+    SECTION("From nothing.")
+    {
+        uint64_t *block(allocator.reallocate(nullptr, 0, 10));
+        REQUIRE(block != nullptr);
+        allocator.deallocate(block, 10);
+    }
+}
+
+TEST_CASE("Test DynamicArray growing through ReallocAllocator.", "[DynamicArray][ReallocAllocator]")
+{
+    dsaa::DynamicArray<uint64_t, SmallThresholdAllocator, dsaa::CountingGrowth<>> arr;
+    const uint64_t count(200000);
+    for (uint64_t i(0); i != count; ++i)
+        arr.insert_last(i);
+
+    REQUIRE(arr.size() == count);
+    REQUIRE(0 < arr.growth_policy().reallocations());
+    REQUIRE(arr.growth_policy().bytes_relocated() == 0);
+    REQUIRE(arr.growth_policy().bytes_allocated() >= count * sizeof(uint64_t));
+    bool intact(true);
+    for (uint64_t i(0); i != count; ++i)
+        intact = intact && arr[i] == i;
+    REQUIRE(intact);
+
+    arr.erase(arr.get_iterator(10), arr.end());
+    arr.shrink_to_fit();
+    REQUIRE(arr.capacity() == 10);
+    REQUIRE(arr.last() == 9);
+
+    dsaa::DynamicArray<uint64_t, SmallThresholdAllocator, dsaa::CountingGrowth<>> copy(arr);
+    REQUIRE(copy.size() == 10);
+}
+
+#endif //!DSAA_TEST_REALLOC_ALLOCATOR_H
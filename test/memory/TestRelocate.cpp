@@ -0,0 +1,219 @@
+#ifndef DSAA_TEST_RELOCATE_H
+#define DSAA_TEST_RELOCATE_H
+
+#include <stdexcept>
+#include <string>
+
+#include "Catch2/Catch.hpp"
+#include "memory/Relocate.h"
+#include "arrays/DynamicArray.h"
+#include "algorithms/Random.h"
+#include "test/TestObject.h"
+
+namespace
+{
+    // Copyable type whose move may throw, so relocation has to fall back to copying.
+    struct ThrowingMove
+    {
+        // Copies and moves left before one throws, none throws while negative.
+        static inline int throw_after = -1;
+        static inline int live = 0;
+
+        int value;
+
+        ThrowingMove(int p_value = 0) noexcept : value(p_value) { ++live; }
+        ThrowingMove(const ThrowingMove &p_other) : value(p_other.value)
+        {
+            count_down();
+            ++live;
+        }
+        ThrowingMove(ThrowingMove &&p_other) : value(p_other.value)
+        {
+            count_down();
+            ++live;
+        }
+        ~ThrowingMove() { --live; }
+        ThrowingMove &operator=(const ThrowingMove &p_other)
+        {
+            count_down();
+            value = p_other.value;
+            return *this;
+        }
+
+        static void count_down()
+        {
+            if (throw_after >= 0 && throw_after-- == 0)
+                throw std::runtime_error("ThrowingMove copy failed.\n");
+        }
+    };
+}
+
+TEST_CASE("Test dsaa::is_trivially_relocatable.", "[Relocate]")
+{
+    REQUIRE(dsaa::is_trivially_relocatable_v<int>);
+    REQUIRE(dsaa::is_trivially_relocatable_v<double>);
+    REQUIRE(!dsaa::is_trivially_relocatable_v<std::string>);
+    REQUIRE(!dsaa::is_trivially_relocatable_v<TestObject<int>>);
+    REQUIRE(dsaa::is_memcpy_relocatable_v<int, std::allocator<int>>);
+    REQUIRE(!dsaa::is_memcpy_relocatable_v<TestObject<int>, std::allocator<TestObject<int>>>);
+}
+
+TEST_CASE("Test dsaa::uninitialized_relocate.", "[Relocate]")
+{
+    SECTION("Trivially copyable elements.")
+    {
+        std::allocator<int> allocator;
+        int source[5]{1, 2, 3, 4, 5};
+        int destination[5]{};
+
+        dsaa::uninitialized_relocate(allocator, source, 5, destination);
+
+        for (int i(0); i != 5; ++i)
+            REQUIRE(destination[i] == i + 1);
+    }
+
+    SECTION("Nothrow movable elements.")
+    {
+        std::allocator<TestObject<int>> allocator;
+        int live(dsaa::TestObject::livecount);
+        TestObject<int> *source(std::allocator_traits<std::allocator<TestObject<int>>>::allocate(allocator, 5));
+        TestObject<int> *destination(std::allocator_traits<std::allocator<TestObject<int>>>::allocate(allocator, 5));
+        for (int i(0); i != 5; ++i)
+            std::allocator_traits<std::allocator<TestObject<int>>>::construct(allocator, &source[i], i);
+
+        dsaa::uninitialized_relocate(allocator, source, 5, destination);
+
+        REQUIRE(dsaa::TestObject::livecount == live + 5);
+        for (int i(0); i != 5; ++i)
+        {
+            REQUIRE(destination[i].value() == i);
+            std::allocator_traits<std::allocator<TestObject<int>>>::destroy(allocator, &destination[i]);
+        }
+        REQUIRE(dsaa::TestObject::livecount == live);
+
+        std::allocator_traits<std::allocator<TestObject<int>>>::deallocate(allocator, source, 5);
+        std::allocator_traits<std::allocator<TestObject<int>>>::deallocate(allocator, destination, 5);
+    }
+}
+
+TEST_CASE("Test DynamicArray relocation with trivially copyable elements.", "[DynamicArray][Relocate]")
+{
+    size_t arr_size(dsaa::random::random_range_int<int>(10, 20));
+    dsaa::DynamicArray<int> param(dsaa::random::random_range_ints<int>(arr_size));
+    dsaa::DynamicArray<int> arr(param);
+
+    SECTION("insert_at the begining position.")
+    {
+        arr.insert_at(arr.cbegin(), -1);
+
+        REQUIRE(arr.size() == param.size() + 1);
+        REQUIRE(arr[0] == -1);
+        for (size_t i(0); i != param.size(); ++i)
+            REQUIRE(arr[i + 1] == param[i]);
+    }
+
+    SECTION("insert_at into an empty container.")
+    {
+        dsaa::DynamicArray<int> empty;
+        empty.insert_at(empty.cbegin(), {1, 2, 3});
+
+        REQUIRE(empty.size() == 3);
+        REQUIRE(empty[0] == 1);
+        REQUIRE(empty[2] == 3);
+    }
+
+    SECTION("insert_at an element of the container itself.")
+    {
+        while (arr.size() != arr.capacity())
+            arr.insert_last(0);
+        int value(arr.last());
+
+        arr.insert_at(arr.cbegin(), arr.last());
+
+        REQUIRE(arr.first() == value);
+    }
+
+    SECTION("erase range from midle.")
+    {
+        size_t index(arr.size() / 2);
+        arr.erase(arr.get_iterator(1), arr.get_iterator(index));
+
+        REQUIRE(arr.size() == param.size() - (index - 1));
+        REQUIRE(arr[0] == param[0]);
+        for (size_t i(1); i != arr.size(); ++i)
+            REQUIRE(arr[i] == param[i + index - 1]);
+    }
+}
+
+TEST_CASE("Test DynamicArray relocation with elements whose move may throw.", "[DynamicArray][Relocate]")
+{
+    dsaa::DynamicArray<ThrowingMove> arr;
+    for (int i(0); i != 20; ++i)
+        arr.insert_at(arr.cbegin(), ThrowingMove(i));
+
+    REQUIRE(arr.size() == 20);
+    for (int i(0); i != 20; ++i)
+        REQUIRE(arr[i].value == 19 - i);
+
+    arr.erase_at(arr.cbegin());
+    REQUIRE(arr.size() == 19);
+    REQUIRE(arr[0].value == 18);
+}
+
+TEST_CASE("Test relocation when a copy throws.", "[DynamicArray][Relocate]")
+{
+    using Traits = std::allocator_traits<std::allocator<ThrowingMove>>;
+    std::allocator<ThrowingMove> allocator;
+    int live(ThrowingMove::live);
+
+    SECTION("relocate_right and relocate_left destroy the whole range.")
+    {
+        ThrowingMove *storage(Traits::allocate(allocator, 8));
+        for (int i(0); i != 5; ++i)
+            Traits::construct(allocator, &storage[i], i);
+
+        ThrowingMove::throw_after = 2;
+        REQUIRE_THROWS_AS(dsaa::relocate_right(allocator, storage, 5, 3), std::runtime_error);
+        REQUIRE(ThrowingMove::live == live);
+
+        for (int i(0); i != 5; ++i)
+            Traits::construct(allocator, &storage[i + 3], i);
+        ThrowingMove::throw_after = 2;
+        REQUIRE_THROWS_AS(dsaa::relocate_left(allocator, storage + 3, 5, 3), std::runtime_error);
+        REQUIRE(ThrowingMove::live == live);
+
+        ThrowingMove::throw_after = -1;
+        Traits::deallocate(allocator, storage, 8);
+    }
+
+    SECTION("DynamicArray keeps the elements before the failed shift.")
+    {
+        {
+            dsaa::DynamicArray<ThrowingMove> arr;
+            arr.reserve(16);
+            for (int i(0); i != 10; ++i)
+                arr.insert_last(ThrowingMove(i));
+
+            ThrowingMove::throw_after = 3;
+            REQUIRE_THROWS_AS(arr.insert_at(arr.get_iterator(4), ThrowingMove(-1)), std::runtime_error);
+            ThrowingMove::throw_after = -1;
+            REQUIRE(arr.size() == 4);
+            for (int i(0); i != 4; ++i)
+                REQUIRE(arr[i].value == i);
+            REQUIRE(ThrowingMove::live == live + 4);
+
+            for (int i(4); i != 10; ++i)
+                arr.insert_last(ThrowingMove(i));
+#ifdef PARAM_CHECK
+            ThrowingMove::throw_after = 2;
+            REQUIRE_THROWS_AS(arr.erase_at(arr.get_iterator(2)), std::runtime_error);
+            ThrowingMove::throw_after = -1;
+            REQUIRE(arr.size() == 2);
+            REQUIRE(ThrowingMove::live == live + 2);
+#endif
+        }
+        REQUIRE(ThrowingMove::live == live);
+    }
+}
+
+#endif //!DSAA_TEST_RELOCATE_H
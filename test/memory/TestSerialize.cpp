@@ -0,0 +1,250 @@
+#ifndef DSAA_TEST_SERIALIZE_H
+#define DSAA_TEST_SERIALIZE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "Catch2/Catch.hpp"
+#include "memory/Serialize.h"
+#include "algorithms/Random.h"
+
+namespace
+{
+    std::string temporary_path(const char *p_name)
+    {
+        return (std::filesystem::temp_directory_path() / p_name).string();
+    }
+
+    // Returns p_bytes, saved data, with extent p_extent of its header replaced by p_value.
+    std::string with_extent(std::string p_bytes, size_t p_extent, uint64_t p_value)
+    {
+        std::memcpy(&p_bytes[offsetof(dsaa::BinaryHeader, extents) + p_extent * sizeof(uint64_t)], &p_value, sizeof(p_value));
+        return p_bytes;
+    }
+
+    void write_file(const std::string &p_path, const std::string &p_bytes)
+    {
+        std::ofstream file(p_path, std::ios::binary | std::ios::trunc);
+        file.write(p_bytes.data(), static_cast<std::streamsize>(p_bytes.size()));
+    }
+
+    // A stream that can not seek, so its length is unknown to load.
+    class UnseekableBuffer : public std::stringbuf
+    {
+    public:
+        explicit UnseekableBuffer(const std::string &p_bytes) : std::stringbuf(p_bytes) {}
+
+    protected:
+        pos_type seekoff(off_type, std::ios_base::seekdir, std::ios_base::openmode) override { return pos_type(off_type(-1)); }
+        pos_type seekpos(pos_type, std::ios_base::openmode) override { return pos_type(off_type(-1)); }
+    };
+}
+
+TEST_CASE("Test save and load of DynamicArray.", "[Serialize]")
+{
+    dsaa::DynamicArray<int> param(dsaa::random::random_range_ints<int>(dsaa::random::random_range_int<int>(1, 1000)));
+
+    SECTION("Through a stream.")
+    {
+        std::stringstream stream;
+        dsaa::save(stream, param);
+        REQUIRE(stream.str().size() == dsaa::BinaryHeader::header_size + param.size() * sizeof(int));
+
+        dsaa::DynamicArray<int> arr{1, 2, 3};
+        dsaa::load(stream, arr);
+
+        REQUIRE(arr.size() == param.size());
+        for (size_t i(0); i != param.size(); ++i)
+            REQUIRE(arr[i] == param[i]);
+    }
+
+    SECTION("Through a file.")
+    {
+        std::string path(temporary_path("dsaa_test_serialize_array.bin"));
+        dsaa::save(path, param);
+
+        dsaa::DynamicArray<int> arr;
+        dsaa::load(path, arr);
+        std::filesystem::remove(path);
+
+        REQUIRE(arr.size() == param.size());
+        for (size_t i(0); i != param.size(); ++i)
+            REQUIRE(arr[i] == param[i]);
+    }
+
+    SECTION("An empty array.")
+    {
+        std::stringstream stream;
+        dsaa::save(stream, dsaa::DynamicArray<int>());
+
+        dsaa::DynamicArray<int> arr{1, 2, 3};
+        dsaa::load(stream, arr);
+        REQUIRE(arr.empty());
+    }
+
+    SECTION("Mismatched element type, rank or truncated data is rejected.")
+    {
+        std::stringstream stream;
+        dsaa::save(stream, param);
+        std::string bytes(stream.str());
+
+        dsaa::DynamicArray<double> doubles;
+        std::stringstream as_double(bytes);
+        REQUIRE_THROWS_AS(dsaa::load(as_double, doubles), std::runtime_error);
+
+        dsaa::Matrix<int> matrix(1, 1);
+        std::stringstream as_matrix(bytes);
+        REQUIRE_THROWS_AS(dsaa::load(as_matrix, matrix), std::runtime_error);
+
+        dsaa::DynamicArray<int> arr;
+        std::stringstream truncated(bytes.substr(0, bytes.size() - 1));
+        REQUIRE_THROWS_AS(dsaa::load(truncated, arr), std::runtime_error);
+        REQUIRE(arr.empty());
+
+        std::stringstream garbage("not a dsaa binary file, not a dsaa binary file, not a dsaa binary file");
+        REQUIRE_THROWS_AS(dsaa::load(garbage, arr), std::runtime_error);
+    }
+
+    SECTION("A truncated file is rejected.")
+    {
+        std::stringstream stream;
+        dsaa::save(stream, param);
+        std::string path(temporary_path("dsaa_test_serialize_truncated.bin"));
+        write_file(path, stream.str().substr(0, stream.str().size() - 2));
+
+        dsaa::DynamicArray<int> arr;
+        REQUIRE_THROWS_AS(dsaa::load(path, arr), std::runtime_error);
+        REQUIRE(arr.empty());
+        REQUIRE_THROWS_AS(dsaa::MappedView<int>(path), std::runtime_error);
+        std::filesystem::remove(path);
+    }
+
+    SECTION("An oversized count is rejected before allocating.")
+    {
+        std::stringstream stream;
+        dsaa::save(stream, param);
+        const std::string bytes(with_extent(stream.str(), 0, uint64_t(1) << 61));
+
+        dsaa::DynamicArray<int> arr;
+        std::stringstream seekable(bytes);
+        REQUIRE_THROWS_AS(dsaa::load(seekable, arr), std::runtime_error);
+        REQUIRE(arr.capacity() == 0);
+
+        UnseekableBuffer buffer(bytes);
+        std::istream unseekable(&buffer);
+        REQUIRE_THROWS_AS(dsaa::load(unseekable, arr), std::runtime_error);
+        REQUIRE(arr.empty());
+
+        std::string path(temporary_path("dsaa_test_serialize_oversized.bin"));
+        write_file(path, bytes);
+        REQUIRE_THROWS_AS(dsaa::MappedView<int>(path), std::runtime_error);
+        std::filesystem::remove(path);
+    }
+
+    SECTION("A stream that can not seek.")
+    {
+        std::stringstream stream;
+        dsaa::save(stream, param);
+        UnseekableBuffer buffer(stream.str());
+        std::istream unseekable(&buffer);
+
+        dsaa::DynamicArray<int> arr;
+        dsaa::load(unseekable, arr);
+
+        REQUIRE(arr.size() == param.size());
+        for (size_t i(0); i != param.size(); ++i)
+            REQUIRE(arr[i] == param[i]);
+    }
+}
+
+TEST_CASE("Test save and load of Matrix.", "[Serialize]")
+{
+    dsaa::Matrix<double> param(3, 5);
+    for (size_t i(0); i != param.row_size(); ++i)
+        for (size_t k(0); k != param.column_size(); ++k)
+            param[i][k] = dsaa::random::random_range_real<double>(-1.0, 1.0);
+
+    std::stringstream stream;
+    dsaa::save(stream, param);
+
+    dsaa::Matrix<double> matrix(7, 2);
+    dsaa::load(stream, matrix);
+
+    REQUIRE(matrix.row_size() == 3);
+    REQUIRE(matrix.column_size() == 5);
+    for (size_t i(0); i != param.row_size(); ++i)
+        for (size_t k(0); k != param.column_size(); ++k)
+            REQUIRE(matrix[i][k] == param[i][k]);
+
+    SECTION("Extents whose product overflows are rejected.")
+    {
+        std::stringstream saved;
+        dsaa::save(saved, param);
+        // 2^32 rows of 2^32 columns wrap around to no elements at all, which an unchecked product would accept.
+        const std::string bytes(with_extent(with_extent(saved.str(), 0, uint64_t(1) << 32), 1, uint64_t(1) << 32));
+
+        std::stringstream overflowing(bytes);
+        REQUIRE_THROWS_AS(dsaa::load(overflowing, matrix), std::runtime_error);
+        UnseekableBuffer buffer(bytes);
+        std::istream unseekable(&buffer);
+        REQUIRE_THROWS_AS(dsaa::load(unseekable, matrix), std::runtime_error);
+
+        std::string path(temporary_path("dsaa_test_serialize_overflow.bin"));
+        write_file(path, bytes);
+        REQUIRE_THROWS_AS(dsaa::MappedView<double>(path), std::runtime_error);
+        std::filesystem::remove(path);
+    }
+}
+
+TEST_CASE("Test MappedView.", "[Serialize]")
+{
+    std::string path(temporary_path("dsaa_test_serialize_view.bin"));
+
+    SECTION("View of a saved DynamicArray.")
+    {
+        dsaa::DynamicArray<int> param(dsaa::random::random_range_ints<int>(100));
+        dsaa::save(path, param);
+        {
+            dsaa::MappedView<int> view(path);
+
+            REQUIRE(view.rank() == 1);
+            REQUIRE(view.size() == param.size());
+            REQUIRE(view.column_size() == param.size());
+            size_t index(0);
+            for (auto i(view.begin()); i != view.end(); ++i, ++index)
+                REQUIRE(*i == param[index]);
+
+            dsaa::MappedView<int> other(std::move(view));
+            REQUIRE(view.empty());
+            REQUIRE(other[99] == param[99]);
+        }
+        REQUIRE_THROWS_AS(dsaa::MappedView<double>(path), std::runtime_error);
+    }
+
+    SECTION("View of a saved Matrix.")
+    {
+        dsaa::Matrix<int> param(4, 3);
+        for (size_t i(0); i != param.row_size(); ++i)
+            for (size_t k(0); k != param.column_size(); ++k)
+                param[i][k] = static_cast<int>(10 * i + k);
+        dsaa::save(path, param);
+
+        dsaa::MappedView<int> view(path);
+        REQUIRE(view.rank() == 2);
+        REQUIRE(view.row_size() == 4);
+        REQUIRE(view.column_size() == 3);
+        REQUIRE(view.size() == 12);
+        for (size_t i(0); i != param.row_size(); ++i)
+            for (size_t k(0); k != param.column_size(); ++k)
+                REQUIRE(view.row(i)[k] == param[i][k]);
+    }
+
+    std::filesystem::remove(path);
+}
+
+#endif //!DSAA_TEST_SERIALIZE_H